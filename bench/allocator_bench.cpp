@@ -0,0 +1,57 @@
+#include <benchmark/benchmark.h>
+#include "../src/fibonacci_heap.h"
+#include "../src/pool_allocator.h"
+#include <random>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Inserta n claves y las extrae todas, midiendo el costo por operación
+ * con el allocator global y con pool_allocator
+ */
+template < typename Heap >
+static void BM_insert_extract(benchmark::State& state) {
+    size_t n = state.range(0);
+    mt19937 gen(42);
+    vector<unsigned int> keys(n);
+    for (size_t i = 0; i < n; ++i) {
+        keys[i] = gen();
+    }
+    Heap f;
+    for (auto _ : state) {
+        for (size_t i = 0; i < n; ++i) {
+            f.insert(keys[i]);
+        }
+        while(!f.empty()){
+            f.extract_min();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * n * 2);
+}
+
+/**
+ * Mantiene el heap en tamaño n alternando insert y extract_min, como una cola de scheduler
+ */
+template < typename Heap >
+static void BM_steady_state(benchmark::State& state) {
+    size_t n = state.range(0);
+    mt19937 gen(42);
+    Heap f;
+    for (size_t i = 0; i < n; ++i) {
+        f.insert(gen());
+    }
+    for (auto _ : state) {
+        f.insert(gen());
+        f.extract_min();
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+
+using global_new_heap = fibonacci_heap<unsigned int>;
+using pool_heap = fibonacci_heap<unsigned int, less<unsigned int>, pool_allocator<unsigned int> >;
+
+BENCHMARK_TEMPLATE(BM_insert_extract, global_new_heap)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_insert_extract, pool_heap)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_steady_state, global_new_heap)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_steady_state, pool_heap)->RangeMultiplier(10)->Range(1000, 1000000);
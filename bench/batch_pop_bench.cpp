@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+#include "../src/fibonacci_heap.h"
+#include <iterator>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Tick de un dispatcher: se insertan k claves nuevas y se sacan las k menores con pop_min
+ */
+static void BM_tick_pop_loop(benchmark::State& state) {
+    size_t n = state.range(0);
+    size_t k = state.range(1);
+    mt19937 gen(42);
+    fibonacci_heap<unsigned int> f;
+    for (size_t i = 0; i < n; ++i) {
+        f.insert(gen());
+    }
+    f.insert(0);
+    f.extract_min();
+    vector<unsigned int> out;
+    out.reserve(k);
+    for (auto _ : state) {
+        for (size_t i = 0; i < k; ++i) {
+            f.insert(gen());
+        }
+        out.clear();
+        for (size_t i = 0; i < k; ++i) {
+            out.push_back(f.pop_min());
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * k);
+}
+
+/**
+ * El mismo tick sacando las k menores con un solo pop_k
+ */
+static void BM_tick_pop_k(benchmark::State& state) {
+    size_t n = state.range(0);
+    size_t k = state.range(1);
+    mt19937 gen(42);
+    fibonacci_heap<unsigned int> f;
+    for (size_t i = 0; i < n; ++i) {
+        f.insert(gen());
+    }
+    f.insert(0);
+    f.extract_min();
+    vector<unsigned int> out;
+    out.reserve(k);
+    for (auto _ : state) {
+        for (size_t i = 0; i < k; ++i) {
+            f.insert(gen());
+        }
+        out.clear();
+        f.pop_k(k, back_inserter(out));
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * k);
+}
+
+BENCHMARK(BM_tick_pop_loop)->Ranges({{1000, 1000000}, {8, 512}});
+BENCHMARK(BM_tick_pop_k)->Ranges({{1000, 1000000}, {8, 512}});
@@ -0,0 +1,169 @@
+#include <benchmark/benchmark.h>
+#include "../src/blocking_fibonacci_heap.h"
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Lo que se escribe a mano: std::priority_queue detrás de un mutex con una sola condition_variable para
+ * "cambió algo". Como productores y consumidores esperan en la misma variable, cada push y cada pop
+ * tienen que despertar a todos (con notify_one el aviso le puede caer a alguien del otro tipo y perderse)
+ */
+class shared_cv_priority_queue {
+public:
+    explicit shared_cv_priority_queue(size_t capacity) : capacity(capacity), is_closed(false) {}
+
+    bool push(unsigned int x) {
+        unique_lock<mutex> guard(lock);
+        changed.wait(guard, [this]{ return is_closed || heap.size() < capacity; });
+        if(is_closed){
+            return false;
+        }
+        heap.push(x);
+        guard.unlock();
+        changed.notify_all();
+        return true;
+    }
+
+    bool pop_wait(unsigned int& out) {
+        unique_lock<mutex> guard(lock);
+        changed.wait(guard, [this]{ return is_closed || !heap.empty(); });
+        if(heap.empty()){
+            return false;
+        }
+        out = heap.top();
+        heap.pop();
+        guard.unlock();
+        changed.notify_all();
+        return true;
+    }
+
+    void close() {
+        {
+            lock_guard<mutex> guard(lock);
+            is_closed = true;
+        }
+        changed.notify_all();
+    }
+
+private:
+    mutex lock;
+    condition_variable changed;
+    priority_queue<unsigned int, vector<unsigned int>, greater<unsigned int> > heap;
+    size_t capacity;
+    bool is_closed;
+};
+
+/**
+ * std::priority_queue con el mismo esquema de avisos que blocking_fibonacci_heap (dos variables y notify_one
+ * solo si alguien espera), para separar cuánto aporta el esquema de avisos y cuánto el heap
+ */
+class split_cv_priority_queue {
+public:
+    explicit split_cv_priority_queue(size_t capacity) : capacity(capacity), consumers(0), producers(0), is_closed(false) {}
+
+    bool push(unsigned int x) {
+        unique_lock<mutex> guard(lock);
+        ++producers;
+        not_full.wait(guard, [this]{ return is_closed || heap.size() < capacity; });
+        --producers;
+        if(is_closed){
+            return false;
+        }
+        heap.push(x);
+        bool wake = consumers > 0;
+        guard.unlock();
+        if(wake){
+            not_empty.notify_one();
+        }
+        return true;
+    }
+
+    bool pop_wait(unsigned int& out) {
+        unique_lock<mutex> guard(lock);
+        ++consumers;
+        not_empty.wait(guard, [this]{ return is_closed || !heap.empty(); });
+        --consumers;
+        if(heap.empty()){
+            return false;
+        }
+        out = heap.top();
+        heap.pop();
+        bool wake = producers > 0;
+        guard.unlock();
+        if(wake){
+            not_full.notify_one();
+        }
+        return true;
+    }
+
+    void close() {
+        {
+            lock_guard<mutex> guard(lock);
+            is_closed = true;
+        }
+        not_empty.notify_all();
+        not_full.notify_all();
+    }
+
+private:
+    mutex lock;
+    condition_variable not_empty;
+    condition_variable not_full;
+    priority_queue<unsigned int, vector<unsigned int>, greater<unsigned int> > heap;
+    size_t capacity;
+    size_t consumers;
+    size_t producers;
+    bool is_closed;
+};
+
+using fibonacci_blocking_queue = blocking_fibonacci_heap<unsigned int>;
+
+/**
+ * Pool de workers: t productores y t consumidores sobre una cola de capacidad 256 pasan 40000 claves al azar;
+ * los productores cierran al terminar y los consumidores vacian. Incluye crear y juntar los hilos
+ */
+template < typename Queue >
+static void BM_blocking_worker_pool(benchmark::State& state) {
+    const int threads = static_cast<int>(state.range(0));
+    const int total = 40000;
+    for (auto _ : state) {
+        Queue q(256);
+        vector<thread> consumers;
+        for (int c = 0; c < threads; ++c) {
+            consumers.emplace_back([&q]{
+                unsigned int x;
+                while (q.pop_wait(x)) {
+                    benchmark::DoNotOptimize(x);
+                }
+            });
+        }
+        vector<thread> producers;
+        for (int p = 0; p < threads; ++p) {
+            producers.emplace_back([&q, p, threads, total]{
+                mt19937 gen(static_cast<unsigned int>(p));
+                for (int i = 0; i < total / threads; ++i) {
+                    q.push(gen());
+                }
+            });
+        }
+        for (auto& t : producers) {
+            t.join();
+        }
+        q.close();
+        for (auto& t : consumers) {
+            t.join();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * total);
+}
+
+BENCHMARK_TEMPLATE(BM_blocking_worker_pool, shared_cv_priority_queue)->RangeMultiplier(4)->Range(1, 16)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_blocking_worker_pool, split_cv_priority_queue)->RangeMultiplier(4)->Range(1, 16)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_blocking_worker_pool, fibonacci_blocking_queue)->RangeMultiplier(4)->Range(1, 16)->UseRealTime()->Unit(benchmark::kMillisecond);
@@ -0,0 +1,53 @@
+#include <benchmark/benchmark.h>
+#include "../src/fibonacci_heap.h"
+#include "../src/pool_allocator.h"
+#include <random>
+#include <vector>
+
+using namespace std;
+
+static vector<unsigned int> random_keys(size_t n) {
+    mt19937 gen(42);
+    vector<unsigned int> keys(n);
+    for (size_t i = 0; i < n; ++i) {
+        keys[i] = gen();
+    }
+    return keys;
+}
+
+/**
+ * Construir un heap de n claves con n llamadas a insert
+ */
+template < typename Heap >
+static void BM_build_by_insert(benchmark::State& state) {
+    vector<unsigned int> keys = random_keys(state.range(0));
+    for (auto _ : state) {
+        Heap f;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            f.insert(keys[i]);
+        }
+        benchmark::DoNotOptimize(f.minimum());
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+/**
+ * Construir un heap de n claves con el constructor por rango
+ */
+template < typename Heap >
+static void BM_build_from_range(benchmark::State& state) {
+    vector<unsigned int> keys = random_keys(state.range(0));
+    for (auto _ : state) {
+        Heap f(keys.begin(), keys.end());
+        benchmark::DoNotOptimize(f.minimum());
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+using global_new_heap = fibonacci_heap<unsigned int>;
+using pool_heap = fibonacci_heap<unsigned int, less<unsigned int>, pool_allocator<unsigned int> >;
+
+BENCHMARK_TEMPLATE(BM_build_by_insert, global_new_heap)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_build_from_range, global_new_heap)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_build_by_insert, pool_heap)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_build_from_range, pool_heap)->RangeMultiplier(10)->Range(1000, 1000000);
@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+#include "../src/compact_fibonacci_heap.h"
+#include "../src/fibonacci_heap.h"
+#include <random>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Insertar n claves al azar y sacarlas todas: casi todo el tiempo se va en consolidate()
+ */
+template < typename Heap >
+static void BM_compact_fill_and_drain(benchmark::State& state) {
+    size_t n = state.range(0);
+    mt19937 gen(5);
+    vector<unsigned int> keys(n);
+    for (size_t i = 0; i < n; ++i) {
+        keys[i] = gen();
+    }
+    for (auto _ : state) {
+        Heap f;
+        for (size_t i = 0; i < n; ++i) {
+            f.insert(keys[i]);
+        }
+        while (!f.empty()) {
+            f.extract_min();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+/**
+ * Heap de n claves consolidado y después decrementos al azar con un extract_min cada 8,
+ * como en Dijkstra: ejercita cut() y cascading_cut() sobre árboles grandes.
+ * Cada clave lleva su posición en los 20 bits bajos para saber qué handles ya no valen
+ */
+template < typename Heap >
+static void BM_compact_decrease_heavy(benchmark::State& state) {
+    const unsigned int id_bits = 20;
+    size_t n = state.range(0);
+    mt19937_64 gen(9);
+    for (auto _ : state) {
+        state.PauseTiming();
+        Heap f;
+        vector<typename Heap::handle> handles;
+        vector<unsigned long long> keys(n);
+        vector<bool> alive(n, true);
+        handles.reserve(n);
+        for (size_t i = 0; i < n; ++i) {
+            keys[i] = ((gen() >> 24) << id_bits) | i;
+            handles.push_back(f.insert(keys[i]));
+        }
+        alive[f.pop_min() & ((1U << id_bits) - 1)] = false;
+        state.ResumeTiming();
+        for (size_t i = 0; i < n && !f.empty(); ++i) {
+            size_t j = gen() % n;
+            unsigned long long delta = (1 + gen() % 0x10000) << id_bits;
+            if(alive[j] && keys[j] > delta){
+                keys[j] -= delta;
+                f.decrease_key(handles[j], keys[j]);
+            }
+            if(i % 8 == 7){
+                alive[f.pop_min() & ((1U << id_bits) - 1)] = false;
+            }
+        }
+        benchmark::DoNotOptimize(f.size());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+using pointer_heap = fibonacci_heap<unsigned int>;
+using compact_heap = compact_fibonacci_heap<unsigned int>;
+using pointer_heap64 = fibonacci_heap<unsigned long long>;
+using compact_heap64 = compact_fibonacci_heap<unsigned long long>;
+
+BENCHMARK_TEMPLATE(BM_compact_fill_and_drain, pointer_heap)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_compact_fill_and_drain, compact_heap)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_compact_decrease_heavy, pointer_heap64)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_compact_decrease_heavy, compact_heap64)->RangeMultiplier(10)->Range(1000, 1000000);
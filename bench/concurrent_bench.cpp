@@ -0,0 +1,66 @@
+#include <benchmark/benchmark.h>
+#include "../src/concurrent_fibonacci_heap.h"
+#include "../src/fibonacci_heap.h"
+#include <mutex>
+#include <random>
+
+using namespace std;
+
+/**
+ * Lo que se usaba antes: un fibonacci_heap detrás de un único mutex
+ */
+class global_mutex_heap {
+public:
+    void insert(unsigned int x) {
+        lock_guard<mutex> guard(lock);
+        heap.insert(x);
+    }
+
+    bool try_pop(unsigned int& out) {
+        lock_guard<mutex> guard(lock);
+        if(heap.empty()){
+            return false;
+        }
+        out = heap.pop_min();
+        return true;
+    }
+
+private:
+    mutex lock;
+    fibonacci_heap<unsigned int> heap;
+};
+
+/**
+ * Todos los hilos insertan y uno de cada cuatro además consume: por iteración cada hilo inserta 8 claves
+ * y los consumidores sacan 8 minimos. Mide cómo escala insert cuando los productores comparten la cola
+ */
+template < typename Heap >
+static void BM_concurrent_producers(benchmark::State& state) {
+    static Heap* shared = nullptr;
+    if(state.thread_index() == 0){
+        shared = new Heap();
+    }
+    mt19937 gen(static_cast<unsigned int>(state.thread_index()));
+    bool consumer = state.thread_index() % 4 == 0;
+    unsigned int x;
+    for (auto _ : state) {
+        for (int i = 0; i < 8; ++i) {
+            shared->insert(gen());
+        }
+        if(consumer){
+            for (int i = 0; i < 8; ++i) {
+                benchmark::DoNotOptimize(shared->try_pop(x));
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 8);
+    if(state.thread_index() == 0){
+        delete shared;
+        shared = nullptr;
+    }
+}
+
+using concurrent_heap = concurrent_fibonacci_heap<unsigned int>;
+
+BENCHMARK_TEMPLATE(BM_concurrent_producers, global_mutex_heap)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_concurrent_producers, concurrent_heap)->ThreadRange(1, 64)->UseRealTime();
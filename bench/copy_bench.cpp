@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+#include "../src/fibonacci_heap.h"
+#include "../src/pool_allocator.h"
+#include <random>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Heap de n claves ya consolidado (se extrajo el minimo una vez)
+ */
+template < typename Heap >
+static Heap consolidated_heap(size_t n, vector<unsigned int>& keys) {
+    mt19937 gen(42);
+    Heap f;
+    keys.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+        keys[i] = gen();
+        f.insert(keys[i]);
+    }
+    f.extract_min();
+    return f;
+}
+
+/**
+ * Copia que conserva la forma de los árboles seguida del primer extract_min
+ */
+template < typename Heap >
+static void BM_copy_and_pop(benchmark::State& state) {
+    vector<unsigned int> keys;
+    Heap f = consolidated_heap<Heap>(state.range(0), keys);
+    for (auto _ : state) {
+        Heap copy(f);
+        copy.extract_min();
+        benchmark::DoNotOptimize(copy.minimum());
+    }
+    state.SetItemsProcessed(state.iterations() * f.size());
+}
+
+/**
+ * Lo que costaba antes copiar: reinsertar cada clave en una lista de raíces plana
+ * y consolidar todo en el primer extract_min
+ */
+template < typename Heap >
+static void BM_reinsert_and_pop(benchmark::State& state) {
+    vector<unsigned int> keys;
+    Heap f = consolidated_heap<Heap>(state.range(0), keys);
+    for (auto _ : state) {
+        Heap copy;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            copy.insert(keys[i]);
+        }
+        copy.extract_min();
+        benchmark::DoNotOptimize(copy.minimum());
+    }
+    state.SetItemsProcessed(state.iterations() * f.size());
+}
+
+using global_new_heap = fibonacci_heap<unsigned int>;
+using pool_heap = fibonacci_heap<unsigned int, less<unsigned int>, pool_allocator<unsigned int> >;
+
+BENCHMARK_TEMPLATE(BM_copy_and_pop, global_new_heap)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_copy_and_pop, pool_heap)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_reinsert_and_pop, global_new_heap)->RangeMultiplier(10)->Range(1000, 1000000);
@@ -0,0 +1,593 @@
+#include "../../src/indexed_fibonacci_heap.h"
+#include "../../src/keyed_fibonacci_heap.h"
+#include "../../src/radix_heap.h"
+#include <sys/resource.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <queue>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*
+ * Dijkstra sobre grafos generados o leídos de archivos DIMACS (.gr), comparando
+ * keyed_fibonacci_heap (insert / decrease_key / extract_min con handles), indexed_fibonacci_heap (lo mismo
+ * direccionado por vértice, sin handles), radix_heap (las mismas operaciones
+ * sin comparar, aprovechando que las distancias extraídas no decrecen) y
+ * std::priority_queue con borrado perezoso (se encolan duplicados y se descartan al sacarlos).
+ *
+ * Uso:
+ *   dijkstra_bench grid <ancho> <alto> [opciones]
+ *   dijkstra_bench gnm <n> <m> [opciones]
+ *   dijkstra_bench powerlaw <n> <aristas_por_nodo> [opciones]
+ *   dijkstra_bench file <grafo.gr> [opciones]
+ * Opciones:
+ *   --sources k     cantidad de orígenes aleatorios (1 por defecto)
+ *   --seed s        semilla del generador (42 por defecto)
+ *   --max-weight w  peso máximo de las aristas generadas (1000 por defecto)
+ *   --queue q       fib, indexed, radix, pq o all (all por defecto). both es fib y pq, como antes de que hubiera más colas.
+ *                   El pico de RSS es del proceso entero, para medirlo por cola hay que correr cada una por separado
+ */
+
+using namespace std;
+
+using vertex = uint32_t;
+using distance_type = uint64_t;
+
+static const distance_type infinity_distance = numeric_limits<distance_type>::max();
+
+/**
+ * Grafo dirigido en formato CSR: las aristas que salen de v son [offsets[v], offsets[v + 1])
+ */
+struct graph {
+    vector<uint64_t> offsets;
+    vector<vertex> targets;
+    vector<uint32_t> weights;
+
+    vertex vertices() const {
+        return static_cast<vertex>(offsets.size() - 1);
+    }
+
+    uint64_t edges() const {
+        return targets.size();
+    }
+};
+
+struct edge {
+    vertex from;
+    vertex to;
+    uint32_t weight;
+};
+
+/**
+ * @brief Armar el grafo CSR a partir de una lista de aristas
+ *
+ * \complexity{\O(n + m)}
+ */
+static graph from_edges(vertex n, const vector<edge>& edges) {
+    graph g;
+    g.offsets.assign(static_cast<size_t>(n) + 1, 0);
+    for (size_t i = 0; i < edges.size(); ++i) {
+        ++g.offsets[edges[i].from + 1];
+    }
+    for (vertex v = 0; v < n; ++v) {
+        g.offsets[v + 1] += g.offsets[v];
+    }
+    g.targets.resize(edges.size());
+    g.weights.resize(edges.size());
+    vector<uint64_t> next(g.offsets.begin(), g.offsets.end() - 1);
+    for (size_t i = 0; i < edges.size(); ++i) {
+        uint64_t pos = next[edges[i].from]++;
+        g.targets[pos] = edges[i].to;
+        g.weights[pos] = edges[i].weight;
+    }
+    return g;
+}
+
+/**
+ * Grilla de ancho x alto con aristas en ambos sentidos entre vecinos horizontales y verticales
+ */
+static graph grid_graph(vertex width, vertex height, uint32_t max_weight, mt19937_64& gen) {
+    uniform_int_distribution<uint32_t> weight(1, max_weight);
+    vector<edge> edges;
+    edges.reserve(static_cast<size_t>(width) * height * 4);
+    for (vertex y = 0; y < height; ++y) {
+        for (vertex x = 0; x < width; ++x) {
+            vertex v = y * width + x;
+            if(x + 1 < width){
+                edges.push_back(edge{v, v + 1, weight(gen)});
+                edges.push_back(edge{v + 1, v, weight(gen)});
+            }
+            if(y + 1 < height){
+                edges.push_back(edge{v, v + width, weight(gen)});
+                edges.push_back(edge{v + width, v, weight(gen)});
+            }
+        }
+    }
+    return from_edges(width * height, edges);
+}
+
+/**
+ * G(n, m): m aristas dirigidas con extremos uniformes
+ */
+static graph gnm_graph(vertex n, uint64_t m, uint32_t max_weight, mt19937_64& gen) {
+    // Sin vértices n - 1 da la vuelta y las aristas apuntarían fuera del grafo
+    if(n == 0){
+        throw invalid_argument("gnm needs at least one vertex");
+    }
+    uniform_int_distribution<vertex> node(0, n - 1);
+    uniform_int_distribution<uint32_t> weight(1, max_weight);
+    vector<edge> edges;
+    edges.reserve(m);
+    for (uint64_t i = 0; i < m; ++i) {
+        edges.push_back(edge{node(gen), node(gen), weight(gen)});
+    }
+    return from_edges(n, edges);
+}
+
+/**
+ * Grafo de ley de potencias por conexión preferencial (Barabási-Albert):
+ * cada nodo nuevo se une a k nodos elegidos con probabilidad proporcional a su grado, en ambos sentidos
+ */
+static graph powerlaw_graph(vertex n, vertex k, uint32_t max_weight, mt19937_64& gen) {
+    uniform_int_distribution<uint32_t> weight(1, max_weight);
+    vector<edge> edges;
+    vector<vertex> endpoints;
+    edges.reserve(static_cast<size_t>(n) * k * 2);
+    endpoints.reserve(static_cast<size_t>(n) * k * 2);
+    vertex seed_nodes = min<vertex>(n, k + 1);
+    for (vertex v = 1; v < seed_nodes; ++v) {
+        edges.push_back(edge{v - 1, v, weight(gen)});
+        edges.push_back(edge{v, v - 1, weight(gen)});
+        endpoints.push_back(v - 1);
+        endpoints.push_back(v);
+    }
+    for (vertex v = seed_nodes; v < n; ++v) {
+        for (vertex j = 0; j < k; ++j) {
+            vertex u = endpoints.empty() ? 0 : endpoints[gen() % endpoints.size()];
+            edges.push_back(edge{v, u, weight(gen)});
+            edges.push_back(edge{u, v, weight(gen)});
+            endpoints.push_back(u);
+            endpoints.push_back(v);
+        }
+    }
+    return from_edges(n, edges);
+}
+
+/**
+ * @brief Leer grafo en formato DIMACS del 9th Implementation Challenge
+ * Líneas "c ..." comentarios, "p sp n m" encabezado, "a u v w" aristas con vértices desde 1
+ *
+ * \complexity{\O(n + m)}
+ */
+static graph dimacs_graph(const string& path) {
+    ifstream in(path);
+    if(!in){
+        throw runtime_error("cannot open " + path);
+    }
+    vertex n = 0;
+    vector<edge> edges;
+    string line;
+    while (getline(in, line)) {
+        if(line.empty() || line[0] == 'c'){
+            continue;
+        }
+        istringstream fields(line);
+        char kind;
+        fields >> kind;
+        if(kind == 'p'){
+            string format;
+            uint64_t m;
+            fields >> format >> n >> m;
+            edges.reserve(m);
+        }else if(kind == 'a'){
+            uint64_t u, v, w;
+            fields >> u >> v >> w;
+            if(!fields || u == 0 || v == 0 || u > n || v > n){
+                throw runtime_error("bad arc line: " + line);
+            }
+            edges.push_back(edge{static_cast<vertex>(u - 1), static_cast<vertex>(v - 1), static_cast<uint32_t>(w)});
+        }
+    }
+    if(n == 0){
+        throw runtime_error("missing 'p sp n m' line in " + path);
+    }
+    return from_edges(n, edges);
+}
+
+/**
+ * Bytes pedidos por una cola: actuales y pico
+ */
+struct memory_counter {
+    size_t current;
+    size_t peak;
+};
+
+/**
+ * Allocator que lleva la cuenta de memoria en un memory_counter y pide con el allocator global
+ */
+template < typename T >
+struct counting_allocator {
+    using value_type = T;
+
+    explicit counting_allocator(memory_counter* counter) : counter(counter) {}
+
+    template < typename U >
+    counting_allocator(const counting_allocator<U>& other) : counter(other.counter) {}
+
+    T* allocate(size_t n) {
+        counter->current += n * sizeof(T);
+        counter->peak = max(counter->peak, counter->current);
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, size_t n) {
+        counter->current -= n * sizeof(T);
+        ::operator delete(p);
+    }
+
+    template < typename U >
+    bool operator==(const counting_allocator<U>& other) const {
+        return counter == other.counter;
+    }
+
+    template < typename U >
+    bool operator!=(const counting_allocator<U>& other) const {
+        return counter != other.counter;
+    }
+
+    memory_counter* counter;
+};
+
+/**
+ * Comparador de distancias que cuenta cuántas veces se lo llama
+ */
+struct counting_less {
+    bool operator()(distance_type a, distance_type b) const {
+        ++*comparisons;
+        return a < b;
+    }
+
+    uint64_t* comparisons;
+};
+
+/**
+ * Resultado de correr Dijkstra desde varios orígenes con una cola
+ */
+struct run_stats {
+    double seconds;
+    uint64_t inserts;
+    uint64_t decreases;
+    uint64_t extracts;
+    uint64_t comparisons;
+    size_t queue_peak_bytes;
+    distance_type checksum;
+
+    uint64_t operations() const {
+        return inserts + decreases + extracts;
+    }
+};
+
+/**
+ * @brief Dijkstra con keyed_fibonacci_heap: un nodo por vértice alcanzado, decrease_key al relajar
+ */
+static run_stats dijkstra_fibonacci(const graph& g, const vector<vertex>& sources) {
+    using heap_type = keyed_fibonacci_heap<distance_type, vertex, counting_less, counting_allocator<pair<const distance_type, vertex> > >;
+    run_stats res = run_stats();
+    memory_counter memory = memory_counter();
+    vector<distance_type> dist(g.vertices());
+    // Posición del handle de cada vértice en handles, no_handle si no se alcanzó o ya salió del heap
+    const uint32_t no_handle = numeric_limits<uint32_t>::max();
+    vector<uint32_t> slot(g.vertices());
+    vector<heap_type::handle> handles;
+    auto start = chrono::steady_clock::now();
+    for (size_t s = 0; s < sources.size(); ++s) {
+        heap_type heap(counting_less{&res.comparisons}, counting_allocator<pair<const distance_type, vertex> >(&memory));
+        fill(dist.begin(), dist.end(), infinity_distance);
+        fill(slot.begin(), slot.end(), no_handle);
+        handles.clear();
+        dist[sources[s]] = 0;
+        slot[sources[s]] = 0;
+        handles.push_back(heap.insert(0, sources[s]));
+        ++res.inserts;
+        while (!heap.empty()) {
+            vertex u = heap.minimum_value();
+            heap.extract_min();
+            ++res.extracts;
+            slot[u] = no_handle;
+            for (uint64_t e = g.offsets[u]; e < g.offsets[u + 1]; ++e) {
+                vertex v = g.targets[e];
+                distance_type d = dist[u] + g.weights[e];
+                if(d < dist[v]){
+                    if(dist[v] == infinity_distance){
+                        slot[v] = static_cast<uint32_t>(handles.size());
+                        handles.push_back(heap.insert(d, v));
+                        ++res.inserts;
+                    }else if(slot[v] != no_handle){
+                        heap.decrease_key(handles[slot[v]], d);
+                        ++res.decreases;
+                    }
+                    dist[v] = d;
+                }
+            }
+        }
+        for (vertex v = 0; v < g.vertices(); ++v) {
+            res.checksum += dist[v] == infinity_distance ? 0 : dist[v];
+        }
+    }
+    res.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    res.queue_peak_bytes = memory.peak + handles.capacity() * sizeof(heap_type::handle);
+    return res;
+}
+
+/**
+ * @brief Dijkstra con indexed_fibonacci_heap: los nodos de todos los vértices se piden una vez y el vértice hace de handle
+ */
+static run_stats dijkstra_indexed(const graph& g, const vector<vertex>& sources) {
+    using heap_type = indexed_fibonacci_heap<distance_type, counting_less, counting_allocator<distance_type> >;
+    run_stats res = run_stats();
+    memory_counter memory = memory_counter();
+    vector<distance_type> dist(g.vertices());
+    auto start = chrono::steady_clock::now();
+    heap_type heap(g.vertices(), counting_less{&res.comparisons}, counting_allocator<distance_type>(&memory));
+    for (size_t s = 0; s < sources.size(); ++s) {
+        fill(dist.begin(), dist.end(), infinity_distance);
+        dist[sources[s]] = 0;
+        heap.insert(sources[s], 0);
+        ++res.inserts;
+        while (!heap.empty()) {
+            vertex u = static_cast<vertex>(heap.min_id());
+            heap.extract_min();
+            ++res.extracts;
+            for (uint64_t e = g.offsets[u]; e < g.offsets[u + 1]; ++e) {
+                vertex v = g.targets[e];
+                distance_type d = dist[u] + g.weights[e];
+                if(d < dist[v]){
+                    if(dist[v] == infinity_distance){
+                        heap.insert(v, d);
+                        ++res.inserts;
+                    }else if(heap.contains(v)){
+                        heap.decrease_key(v, d);
+                        ++res.decreases;
+                    }
+                    dist[v] = d;
+                }
+            }
+        }
+        for (vertex v = 0; v < g.vertices(); ++v) {
+            res.checksum += dist[v] == infinity_distance ? 0 : dist[v];
+        }
+    }
+    res.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    res.queue_peak_bytes = memory.peak;
+    return res;
+}
+
+/**
+ * @brief Dijkstra con radix_heap: igual que dijkstra_fibonacci pero los nodos se ubican por bits y no por comparaciones
+ */
+static run_stats dijkstra_radix(const graph& g, const vector<vertex>& sources) {
+    using heap_type = radix_heap<distance_type, vertex, counting_allocator<pair<const distance_type, vertex> > >;
+    run_stats res = run_stats();
+    memory_counter memory = memory_counter();
+    vector<distance_type> dist(g.vertices());
+    const uint32_t no_handle = numeric_limits<uint32_t>::max();
+    vector<uint32_t> slot(g.vertices());
+    vector<heap_type::handle> handles;
+    auto start = chrono::steady_clock::now();
+    for (size_t s = 0; s < sources.size(); ++s) {
+        heap_type heap{counting_allocator<pair<const distance_type, vertex> >(&memory)};
+        fill(dist.begin(), dist.end(), infinity_distance);
+        fill(slot.begin(), slot.end(), no_handle);
+        handles.clear();
+        dist[sources[s]] = 0;
+        slot[sources[s]] = 0;
+        handles.push_back(heap.insert(0, sources[s]));
+        ++res.inserts;
+        while (!heap.empty()) {
+            vertex u = heap.pop_min().second;
+            ++res.extracts;
+            slot[u] = no_handle;
+            for (uint64_t e = g.offsets[u]; e < g.offsets[u + 1]; ++e) {
+                vertex v = g.targets[e];
+                distance_type d = dist[u] + g.weights[e];
+                if(d < dist[v]){
+                    if(dist[v] == infinity_distance){
+                        slot[v] = static_cast<uint32_t>(handles.size());
+                        handles.push_back(heap.insert(d, v));
+                        ++res.inserts;
+                    }else if(slot[v] != no_handle){
+                        heap.decrease_key(handles[slot[v]], d);
+                        ++res.decreases;
+                    }
+                    dist[v] = d;
+                }
+            }
+        }
+        for (vertex v = 0; v < g.vertices(); ++v) {
+            res.checksum += dist[v] == infinity_distance ? 0 : dist[v];
+        }
+    }
+    res.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    res.queue_peak_bytes = memory.peak + handles.capacity() * sizeof(heap_type::handle);
+    return res;
+}
+
+/**
+ * @brief Dijkstra con std::priority_queue: se encola un par nuevo en cada mejora y se descartan los viejos al sacarlos
+ */
+static run_stats dijkstra_priority_queue(const graph& g, const vector<vertex>& sources) {
+    using entry = pair<distance_type, vertex>;
+    run_stats res = run_stats();
+    memory_counter memory = memory_counter();
+    uint64_t* comparisons = &res.comparisons;
+    auto later = [comparisons](const entry& a, const entry& b){
+        ++*comparisons;
+        return a.first > b.first;
+    };
+    using queue_type = priority_queue<entry, vector<entry, counting_allocator<entry> >, decltype(later)>;
+    vector<distance_type> dist(g.vertices());
+    auto start = chrono::steady_clock::now();
+    for (size_t s = 0; s < sources.size(); ++s) {
+        queue_type queue(later, vector<entry, counting_allocator<entry> >(counting_allocator<entry>(&memory)));
+        fill(dist.begin(), dist.end(), infinity_distance);
+        dist[sources[s]] = 0;
+        queue.push(entry(0, sources[s]));
+        ++res.inserts;
+        while (!queue.empty()) {
+            entry top = queue.top();
+            queue.pop();
+            ++res.extracts;
+            vertex u = top.second;
+            if(top.first != dist[u]){
+                continue;
+            }
+            for (uint64_t e = g.offsets[u]; e < g.offsets[u + 1]; ++e) {
+                vertex v = g.targets[e];
+                distance_type d = dist[u] + g.weights[e];
+                if(d < dist[v]){
+                    dist[v] = d;
+                    queue.push(entry(d, v));
+                    ++res.inserts;
+                }
+            }
+        }
+        for (vertex v = 0; v < g.vertices(); ++v) {
+            res.checksum += dist[v] == infinity_distance ? 0 : dist[v];
+        }
+    }
+    res.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    res.queue_peak_bytes = memory.peak;
+    return res;
+}
+
+/**
+ * @returns pico de memoria residente del proceso en KiB
+ */
+static long peak_rss_kib() {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#if defined(__APPLE__)
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+}
+
+static void print_stats(const char* name, const run_stats& s) {
+    printf("%-16s %10.3f s %14.0f ops/s  ins %11llu  dec %11llu  ext %11llu  cmp %13llu  queue peak %10.1f KiB  process peak RSS %8ld KiB  checksum %llu\n",
+           name, s.seconds, s.operations() / s.seconds,
+           static_cast<unsigned long long>(s.inserts), static_cast<unsigned long long>(s.decreases), static_cast<unsigned long long>(s.extracts),
+           static_cast<unsigned long long>(s.comparisons), s.queue_peak_bytes / 1024.0, peak_rss_kib(),
+           static_cast<unsigned long long>(s.checksum));
+}
+
+static void usage(const char* program) {
+    fprintf(stderr,
+            "usage: %s grid <width> <height> | gnm <n> <m> | powerlaw <n> <edges_per_node> | file <graph.gr>\n"
+            "       [--sources k] [--seed s] [--max-weight w] [--queue fib|indexed|radix|pq|both|all]\n", program);
+}
+
+int main(int argc, char** argv) {
+    if(argc < 3){
+        usage(argv[0]);
+        return 1;
+    }
+    string kind = argv[1];
+    int first_option = kind == "file" ? 3 : 4;
+    if(argc < first_option){
+        usage(argv[0]);
+        return 1;
+    }
+    size_t source_count = 1;
+    uint64_t seed = 42;
+    uint32_t max_weight = 1000;
+    string queue = "all";
+    for (int i = first_option; i + 1 < argc; i += 2) {
+        string option = argv[i];
+        if(option == "--sources"){
+            source_count = strtoull(argv[i + 1], nullptr, 10);
+        }else if(option == "--seed"){
+            seed = strtoull(argv[i + 1], nullptr, 10);
+        }else if(option == "--max-weight"){
+            max_weight = static_cast<uint32_t>(strtoul(argv[i + 1], nullptr, 10));
+        }else if(option == "--queue"){
+            queue = argv[i + 1];
+            if(queue != "fib" && queue != "indexed" && queue != "radix" && queue != "pq" && queue != "both" && queue != "all"){
+                usage(argv[0]);
+                return 1;
+            }
+        }else{
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    mt19937_64 gen(seed);
+    graph g;
+    try{
+        auto build_start = chrono::steady_clock::now();
+        if(kind == "grid"){
+            g = grid_graph(strtoul(argv[2], nullptr, 10), strtoul(argv[3], nullptr, 10), max_weight, gen);
+        }else if(kind == "gnm"){
+            g = gnm_graph(strtoul(argv[2], nullptr, 10), strtoull(argv[3], nullptr, 10), max_weight, gen);
+        }else if(kind == "powerlaw"){
+            g = powerlaw_graph(strtoul(argv[2], nullptr, 10), strtoul(argv[3], nullptr, 10), max_weight, gen);
+        }else if(kind == "file"){
+            g = dimacs_graph(argv[2]);
+        }else{
+            usage(argv[0]);
+            return 1;
+        }
+        printf("graph %s: %u vertices, %llu edges, built in %.3f s\n", kind.c_str(), g.vertices(),
+               static_cast<unsigned long long>(g.edges()), chrono::duration<double>(chrono::steady_clock::now() - build_start).count());
+    }catch(const exception& e){
+        fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+    if(g.vertices() == 0){
+        fprintf(stderr, "empty graph\n");
+        return 1;
+    }
+    vector<vertex> sources;
+    for (size_t i = 0; i < source_count; ++i) {
+        sources.push_back(static_cast<vertex>(gen() % g.vertices()));
+    }
+    run_stats fib = run_stats();
+    run_stats indexed = run_stats();
+    run_stats radix = run_stats();
+    run_stats pq = run_stats();
+    bool fib_and_pq = queue == "both" || queue == "all";
+    if(queue == "fib" || fib_and_pq){
+        fib = dijkstra_fibonacci(g, sources);
+        print_stats("fibonacci_heap", fib);
+    }
+    if(queue == "indexed" || queue == "all"){
+        indexed = dijkstra_indexed(g, sources);
+        print_stats("indexed_fib", indexed);
+    }
+    if(queue == "radix" || queue == "all"){
+        radix = dijkstra_radix(g, sources);
+        print_stats("radix_heap", radix);
+    }
+    if(queue == "pq" || fib_and_pq){
+        pq = dijkstra_priority_queue(g, sources);
+        print_stats("priority_queue", pq);
+    }
+    bool mismatch = (fib_and_pq && fib.checksum != pq.checksum) ||
+                    (queue == "all" && (indexed.checksum != pq.checksum || radix.checksum != pq.checksum));
+    if(mismatch){
+        fprintf(stderr, "distance mismatch between queues\n");
+        return 2;
+    }
+    return 0;
+}
@@ -0,0 +1,102 @@
+#include <benchmark/benchmark.h>
+#include "../src/dary_heap.h"
+#include "../src/fibonacci_heap.h"
+#include "../src/hollow_heap.h"
+#include "../src/pairing_heap.h"
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Mismos benchmarks para cada heap con la interfaz de fibonacci_heap
+ */
+using fibonacci_engine_heap = fibonacci_heap<uint64_t>;
+using pairing_engine_heap = pairing_heap<uint64_t>;
+using dary2_engine_heap = dary_heap<uint64_t, 2>;
+using dary4_engine_heap = dary_heap<uint64_t, 4>;
+using dary8_engine_heap = dary_heap<uint64_t, 8>;
+using hollow_engine_heap = hollow_heap<uint64_t>;
+
+/**
+ * Insertar range(0) claves al azar y sacarlas todas
+ */
+template < typename Heap >
+static void BM_engine_fill_and_drain(benchmark::State& state) {
+    size_t n = static_cast<size_t>(state.range(0));
+    mt19937_64 gen(1);
+    vector<uint64_t> keys(n);
+    for (size_t i = 0; i < n; ++i) {
+        keys[i] = gen();
+    }
+    for (auto _ : state) {
+        Heap h;
+        for (size_t i = 0; i < n; ++i) {
+            h.insert(keys[i]);
+        }
+        while (!h.empty()) {
+            h.extract_min();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n) * 2);
+}
+
+/**
+ * Carga con decrease_key, como Dijkstra: range(0) elementos y, hasta vaciar, range(1) decrease_key sobre
+ * elementos al azar por cada extract_min. 1 y 4 son grafos ralos, 10 es el caso dominado por decrease_key
+ */
+template < typename Heap >
+static void BM_engine_decrease_moderate(benchmark::State& state) {
+    size_t n = static_cast<size_t>(state.range(0));
+    size_t decreases = static_cast<size_t>(state.range(1));
+    mt19937_64 gen(2);
+    vector<uint64_t> keys(n);
+    for (size_t i = 0; i < n; ++i) {
+        keys[i] = (uint64_t(1) << 40) + (gen() >> 24);
+    }
+    int64_t ops = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        Heap h;
+        vector<typename Heap::handle> handles;
+        handles.reserve(n);
+        vector<size_t> alive(n);
+        vector<size_t> position(n);
+        state.ResumeTiming();
+        for (size_t i = 0; i < n; ++i) {
+            handles.push_back(h.insert((keys[i] << 20) | i));
+            alive[i] = i;
+            position[i] = i;
+        }
+        size_t live = n;
+        while (live > 0) {
+            for (size_t k = 0; k < decreases; ++k) {
+                size_t id = alive[gen() % live];
+                uint64_t key = *handles[id];
+                uint64_t lower = ((key >> 20) - 1 - gen() % 1024) << 20 | id;
+                h.decrease_key(handles[id], lower);
+            }
+            size_t id = static_cast<size_t>(h.minimum() & ((uint64_t(1) << 20) - 1));
+            h.extract_min();
+            size_t p = position[id];
+            alive[p] = alive[--live];
+            position[alive[p]] = p;
+        }
+        ops += static_cast<int64_t>(n * (decreases + 2));
+    }
+    state.SetItemsProcessed(ops);
+}
+
+BENCHMARK_TEMPLATE(BM_engine_fill_and_drain, fibonacci_engine_heap)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_engine_fill_and_drain, pairing_engine_heap)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_engine_decrease_moderate, fibonacci_engine_heap)->ArgsProduct({{10000, 1000000}, {1, 4, 10}});
+BENCHMARK_TEMPLATE(BM_engine_decrease_moderate, pairing_engine_heap)->ArgsProduct({{10000, 1000000}, {1, 4, 10}});
+BENCHMARK_TEMPLATE(BM_engine_fill_and_drain, dary2_engine_heap)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_engine_fill_and_drain, dary4_engine_heap)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_engine_fill_and_drain, dary8_engine_heap)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_engine_decrease_moderate, dary2_engine_heap)->ArgsProduct({{10000, 1000000}, {1, 4}});
+BENCHMARK_TEMPLATE(BM_engine_decrease_moderate, dary4_engine_heap)->ArgsProduct({{10000, 1000000}, {1, 4}});
+BENCHMARK_TEMPLATE(BM_engine_decrease_moderate, dary8_engine_heap)->ArgsProduct({{10000, 1000000}, {1, 4}});
+BENCHMARK_TEMPLATE(BM_engine_fill_and_drain, hollow_engine_heap)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_engine_decrease_moderate, hollow_engine_heap)->ArgsProduct({{10000, 1000000}, {1, 4, 10}});
@@ -0,0 +1,27 @@
+#include <benchmark/benchmark.h>
+#include "../src/fibonacci_heap.h"
+#include "../src/instrumented_fibonacci_heap.h"
+#include <random>
+
+using namespace std;
+
+/**
+ * Costo de medir cada operación: mismo ciclo insert + extract_min con y sin instrumentar
+ */
+template < typename Heap >
+static void BM_measured_steady_state(benchmark::State& state) {
+    size_t n = state.range(0);
+    mt19937 gen(42);
+    Heap f;
+    for (size_t i = 0; i < n; ++i) {
+        f.insert(gen());
+    }
+    for (auto _ : state) {
+        f.insert(gen());
+        f.extract_min();
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+
+BENCHMARK_TEMPLATE(BM_measured_steady_state, fibonacci_heap<unsigned int>)->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_measured_steady_state, instrumented_fibonacci_heap<unsigned int>)->Arg(1000)->Arg(100000);
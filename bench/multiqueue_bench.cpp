@@ -0,0 +1,109 @@
+#include <benchmark/benchmark.h>
+#include "../src/concurrent_fibonacci_heap.h"
+#include "../src/fibonacci_multiqueue.h"
+#include "../src/latency_histogram.h"
+#include <random>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Construcción de cada cola para t hilos
+ */
+template < typename Queue >
+static Queue* make_queue(int threads);
+
+template <>
+concurrent_fibonacci_heap<unsigned int>* make_queue<concurrent_fibonacci_heap<unsigned int> >(int threads) {
+    return new concurrent_fibonacci_heap<unsigned int>(static_cast<size_t>(threads));
+}
+
+template <>
+fibonacci_multiqueue<unsigned int>* make_queue<fibonacci_multiqueue<unsigned int> >(int threads) {
+    return new fibonacci_multiqueue<unsigned int>(2, static_cast<size_t>(threads));
+}
+
+/**
+ * Cada hilo alterna insert y try_pop sobre una cola compartida precargada con 100000 claves,
+ * como un scheduler de tareas en régimen estable
+ */
+template < typename Queue >
+static void BM_multiqueue_throughput(benchmark::State& state) {
+    static Queue* shared = nullptr;
+    if(state.thread_index() == 0){
+        shared = make_queue<Queue>(state.threads());
+        mt19937 gen(1);
+        for (int i = 0; i < 100000; ++i) {
+            shared->insert(gen());
+        }
+    }
+    mt19937 gen(static_cast<unsigned int>(state.thread_index() + 2));
+    unsigned int x;
+    for (auto _ : state) {
+        shared->insert(gen());
+        benchmark::DoNotOptimize(shared->try_pop(x));
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+    if(state.thread_index() == 0){
+        delete shared;
+        shared = nullptr;
+    }
+}
+
+using exact_queue = concurrent_fibonacci_heap<unsigned int>;
+using relaxed_queue = fibonacci_multiqueue<unsigned int>;
+
+BENCHMARK_TEMPLATE(BM_multiqueue_throughput, exact_queue)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_multiqueue_throughput, relaxed_queue)->ThreadRange(1, 64)->UseRealTime();
+
+/**
+ * Distribución del rank error (cuántas claves menores a la sacada seguían en la cola) con q colas.
+ * Un solo hilo alterna insert y try_pop sobre 100000 claves de 20 bits; las claves presentes se cuentan
+ * en un árbol de Fenwick para obtener el rank exacto. Se informa promedio, p50, p90, p99 y maximo
+ */
+static void BM_multiqueue_rank_error(benchmark::State& state) {
+    const unsigned int key_bits = 20;
+    const size_t domain = size_t(1) << key_bits;
+    size_t queues = static_cast<size_t>(state.range(0));
+    latency_histogram ranks;
+    for (auto _ : state) {
+        state.PauseTiming();
+        fibonacci_multiqueue<unsigned int> q(queues, 1);
+        vector<unsigned int> fenwick(domain + 1, 0);
+        auto add = [&fenwick, domain](unsigned int key, int delta){
+            for (size_t i = key + 1; i <= domain; i += i & (~i + 1)) {
+                fenwick[i] += delta;
+            }
+        };
+        auto smaller = [&fenwick](unsigned int key){
+            unsigned long long res = 0;
+            for (size_t i = key; i > 0; i -= i & (~i + 1)) {
+                res += fenwick[i];
+            }
+            return res;
+        };
+        mt19937 gen(7);
+        for (int i = 0; i < 100000; ++i) {
+            unsigned int k = gen() >> (32 - key_bits);
+            q.insert(k);
+            add(k, 1);
+        }
+        state.ResumeTiming();
+        unsigned int x;
+        for (int i = 0; i < 100000; ++i) {
+            unsigned int k = gen() >> (32 - key_bits);
+            q.insert(k);
+            add(k, 1);
+            q.try_pop(x);
+            ranks.record(smaller(x));
+            add(x, -1);
+        }
+    }
+    state.counters["mean"] = ranks.mean();
+    state.counters["p50"] = static_cast<double>(ranks.percentile(50));
+    state.counters["p90"] = static_cast<double>(ranks.percentile(90));
+    state.counters["p99"] = static_cast<double>(ranks.percentile(99));
+    state.counters["max"] = static_cast<double>(ranks.max());
+}
+
+BENCHMARK(BM_multiqueue_rank_error)->RangeMultiplier(4)->Range(2, 128)->Iterations(1)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,271 @@
+#include <benchmark/benchmark.h>
+#include "../src/fibonacci_heap.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Clave de 64 bytes: se compara por key y el resto solo ocupa lugar,
+ * como un registro de scheduler que se guarda entero en el heap
+ */
+struct record64 {
+    int64_t key;
+    char payload[56];
+
+    bool operator<(const record64& other) const {
+        return key < other.key;
+    }
+};
+
+static_assert(sizeof(record64) == 64, "record64 debe ocupar 64 bytes");
+
+/**
+ * Generación de claves aleatorias de cada tipo
+ */
+template < typename K >
+K make_key(mt19937_64& gen);
+
+template <>
+int make_key<int>(mt19937_64& gen) {
+    return static_cast<int>(gen() >> 34);
+}
+
+template <>
+record64 make_key<record64>(mt19937_64& gen) {
+    record64 r;
+    r.key = static_cast<int64_t>(gen() >> 2);
+    fill(r.payload, r.payload + sizeof(r.payload), 'x');
+    return r;
+}
+
+template <>
+string make_key<string>(mt19937_64& gen) {
+    // 24 caracteres entre 'b' y 'z' para que no entre en el small string buffer
+    string s(24, 'b');
+    for (size_t i = 0; i < s.size(); ++i) {
+        s[i] = static_cast<char>('b' + gen() % 25);
+    }
+    return s;
+}
+
+/**
+ * Clave estrictamente menor que k
+ */
+int decreased(int k, mt19937_64& gen) {
+    return k - 1 - static_cast<int>(gen() % 1000000);
+}
+
+record64 decreased(const record64& k, mt19937_64& gen) {
+    record64 r = k;
+    r.key -= 1 + static_cast<int64_t>(gen() % 1000000);
+    return r;
+}
+
+string decreased(const string& k, mt19937_64&) {
+    return "a" + k;
+}
+
+template < typename K >
+static vector<K> random_keys(size_t n) {
+    mt19937_64 gen(42);
+    vector<K> keys;
+    keys.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        keys.push_back(make_key<K>(gen));
+    }
+    return keys;
+}
+
+/**
+ * Heap con las claves ya consolidado, como queda después de usarlo un rato.
+ * Se consolida extrayendo una clave extra estrictamente menor, así los handles siguen siendo válidos
+ */
+template < typename K >
+static void fill_heap(fibonacci_heap<K>& f, const vector<K>& keys, vector<typename fibonacci_heap<K>::handle>* handles = nullptr) {
+    for (size_t i = 0; i < keys.size(); ++i) {
+        typename fibonacci_heap<K>::handle h = f.insert(keys[i]);
+        if(handles != nullptr){
+            handles->push_back(h);
+        }
+    }
+    mt19937_64 gen(1);
+    f.insert(decreased(*min_element(keys.begin(), keys.end()), gen));
+    f.extract_min();
+}
+
+template < typename K >
+static void BM_insert(benchmark::State& state) {
+    vector<K> keys = random_keys<K>(state.range(0));
+    for (auto _ : state) {
+        fibonacci_heap<K> f;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            f.insert(keys[i]);
+        }
+        state.PauseTiming();
+        f.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template < typename K >
+static void BM_extract_min(benchmark::State& state) {
+    vector<K> keys = random_keys<K>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        fibonacci_heap<K> f;
+        fill_heap(f, keys);
+        state.ResumeTiming();
+        while(!f.empty()){
+            f.extract_min();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template < typename K >
+static void BM_decrease_key(benchmark::State& state) {
+    vector<K> keys = random_keys<K>(state.range(0));
+    mt19937_64 gen(7);
+    vector<K> new_keys;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        new_keys.push_back(decreased(keys[i], gen));
+    }
+    vector<size_t> order(keys.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    shuffle(order.begin(), order.end(), gen);
+    for (auto _ : state) {
+        state.PauseTiming();
+        fibonacci_heap<K> f;
+        vector<typename fibonacci_heap<K>::handle> handles;
+        handles.reserve(keys.size());
+        fill_heap(f, keys, &handles);
+        state.ResumeTiming();
+        for (size_t i = 0; i < order.size(); ++i) {
+            f.decrease_key(handles[order[i]], new_keys[order[i]]);
+        }
+        state.PauseTiming();
+        f.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template < typename K >
+static void BM_delete_key(benchmark::State& state) {
+    vector<K> keys = random_keys<K>(state.range(0));
+    mt19937_64 gen(7);
+    vector<size_t> order(keys.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    shuffle(order.begin(), order.end(), gen);
+    order.resize(order.size() / 2);
+    for (auto _ : state) {
+        state.PauseTiming();
+        fibonacci_heap<K> f;
+        vector<typename fibonacci_heap<K>::handle> handles;
+        handles.reserve(keys.size());
+        fill_heap(f, keys, &handles);
+        state.ResumeTiming();
+        for (size_t i = 0; i < order.size(); ++i) {
+            f.delete_key(handles[order[i]]);
+        }
+        state.PauseTiming();
+        f.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * order.size());
+}
+
+/**
+ * join es \O(1), lo que cuesta es el primer extract_min que consolida las raíces de ambos heaps
+ */
+template < typename K >
+static void BM_join_then_extract(benchmark::State& state) {
+    vector<K> keys = random_keys<K>(state.range(0));
+    vector<K> first_half(keys.begin(), keys.begin() + keys.size() / 2);
+    vector<K> second_half(keys.begin() + keys.size() / 2, keys.end());
+    for (auto _ : state) {
+        state.PauseTiming();
+        fibonacci_heap<K> f1;
+        fibonacci_heap<K> f2;
+        fill_heap(f1, first_half);
+        fill_heap(f2, second_half);
+        state.ResumeTiming();
+        f1.join(f2);
+        f1.extract_min();
+        state.PauseTiming();
+        f1.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template < typename K >
+static void BM_copy(benchmark::State& state) {
+    vector<K> keys = random_keys<K>(state.range(0));
+    fibonacci_heap<K> f;
+    fill_heap(f, keys);
+    for (auto _ : state) {
+        fibonacci_heap<K> copy(f);
+        benchmark::DoNotOptimize(copy.minimum());
+        state.PauseTiming();
+        copy.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * f.size());
+}
+
+template < typename K >
+static void BM_clear(benchmark::State& state) {
+    vector<K> keys = random_keys<K>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        fibonacci_heap<K> f;
+        fill_heap(f, keys);
+        state.ResumeTiming();
+        f.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+/**
+ * Tamaño maximo de los heaps: 1e6 por defecto para que la corrida completa entre en memoria,
+ * con la variable de entorno FIB_BENCH_MAX_SIZE se puede llevar hasta 1e8
+ */
+static int64_t max_size() {
+    const char* env = getenv("FIB_BENCH_MAX_SIZE");
+    int64_t res = env != nullptr ? atoll(env) : 1000000;
+    return res >= 1000 ? res : 1000;
+}
+
+template < typename K >
+static void register_operations(const string& type) {
+    int64_t limit = max_size();
+    vector<pair<string, void (*)(benchmark::State&)> > operations = {
+        {"BM_insert", BM_insert<K>},
+        {"BM_extract_min", BM_extract_min<K>},
+        {"BM_decrease_key", BM_decrease_key<K>},
+        {"BM_delete_key", BM_delete_key<K>},
+        {"BM_join_then_extract", BM_join_then_extract<K>},
+        {"BM_copy", BM_copy<K>},
+        {"BM_clear", BM_clear<K>},
+    };
+    for (size_t i = 0; i < operations.size(); ++i) {
+        benchmark::internal::Benchmark* b = benchmark::RegisterBenchmark((operations[i].first + "<" + type + ">").c_str(), operations[i].second);
+        for (int64_t n = 1000; n <= limit; n *= 10) {
+            b->Arg(n);
+        }
+        b->Unit(benchmark::kMicrosecond);
+    }
+}
+
+static int registered = (register_operations<int>("int"), register_operations<record64>("record64"), register_operations<string>("string"), 0);
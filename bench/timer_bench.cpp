@@ -0,0 +1,259 @@
+#include <benchmark/benchmark.h>
+#include "../src/timer_queue.h"
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Rueda de timers jerárquica al estilo del kernel de Linux (Varghese y Lauck): 4 niveles de 256 listas,
+ * cada nivel cubre 256 veces más tiempo que el anterior. Programar y cancelar son \O(1) (listas doblemente
+ * enlazadas por índices); avanzar el reloj cuesta un paso por tick transcurrido más bajar de nivel los timers
+ * cada 256 ticks. Misma interfaz que timer_queue, salvo que un timer programado para un tick ya procesado
+ * se ejecuta en el próximo tick y no en la próxima llamada a run_expired
+ */
+class hierarchical_timer_wheel {
+public:
+    using time_type = uint64_t;
+    using callback_type = function<void()>;
+    using timer_id = uint64_t;
+
+    hierarchical_timer_wheel() : current(0), live(0) {
+        heads.assign(levels * slots_per_level, nil);
+    }
+
+    timer_id schedule(time_type deadline, callback_type callback) {
+        uint32_t i;
+        if(free_entries.empty()){
+            i = static_cast<uint32_t>(entries.size());
+            entries.push_back(entry());
+        }else{
+            i = free_entries.back();
+            free_entries.pop_back();
+        }
+        entry& e = entries[i];
+        e.deadline = deadline;
+        e.callback = std::move(callback);
+        e.active = true;
+        link(i);
+        ++live;
+        return (static_cast<timer_id>(e.generation) << 32) | i;
+    }
+
+    bool cancel(timer_id id) {
+        uint32_t i = find(id);
+        if(i == nil){
+            return false;
+        }
+        unlink(i);
+        release(i);
+        return true;
+    }
+
+    bool reschedule(timer_id id, time_type deadline) {
+        uint32_t i = find(id);
+        if(i == nil){
+            return false;
+        }
+        unlink(i);
+        entries[i].deadline = deadline;
+        link(i);
+        return true;
+    }
+
+    size_t run_expired(time_type now) {
+        size_t fired = 0;
+        while (current <= now) {
+            uint32_t index = static_cast<uint32_t>(current & slot_mask);
+            if(index == 0 && cascade(1) == 0 && cascade(2) == 0){
+                cascade(3);
+            }
+            uint32_t i = heads[index];
+            heads[index] = nil;
+            while (i != nil) {
+                uint32_t next = entries[i].next;
+                callback_type callback = std::move(entries[i].callback);
+                release(i);
+                ++fired;
+                callback();
+                i = next;
+            }
+            ++current;
+        }
+        return fired;
+    }
+
+    size_t size() const {
+        return live;
+    }
+
+private:
+    static const uint32_t nil = 0xFFFFFFFFU;
+    static const unsigned int level_bits = 8;
+    static const uint32_t slots_per_level = 1U << level_bits;
+    static const uint64_t slot_mask = slots_per_level - 1;
+    static const unsigned int levels = 4;
+
+    struct entry {
+        entry() : deadline(0), prev(nil), next(nil), generation(0), list(nil), active(false) {}
+
+        time_type deadline;
+        callback_type callback;
+        uint32_t prev;
+        uint32_t next;
+        uint32_t generation;
+        uint32_t list;
+        bool active;
+    };
+
+    uint32_t find(timer_id id) const {
+        uint32_t i = static_cast<uint32_t>(id & 0xFFFFFFFFU);
+        if(i >= entries.size() || !entries[i].active || entries[i].generation != static_cast<uint32_t>(id >> 32)){
+            return nil;
+        }
+        return i;
+    }
+
+    /**
+     * Lista donde va un timer según cuánto falta para que venza
+     */
+    uint32_t list_of(time_type deadline) const {
+        if(deadline < current){
+            return static_cast<uint32_t>(current & slot_mask);
+        }
+        uint64_t delta = deadline - current;
+        if(delta >= (uint64_t(1) << (levels * level_bits))){
+            deadline = current + (uint64_t(1) << (levels * level_bits)) - 1;
+            delta = deadline - current;
+        }
+        unsigned int level = 0;
+        while (delta >= (uint64_t(1) << ((level + 1) * level_bits))) {
+            ++level;
+        }
+        return level * slots_per_level + static_cast<uint32_t>((deadline >> (level * level_bits)) & slot_mask);
+    }
+
+    void link(uint32_t i) {
+        entry& e = entries[i];
+        e.list = list_of(e.deadline);
+        e.prev = nil;
+        e.next = heads[e.list];
+        if(e.next != nil){
+            entries[e.next].prev = i;
+        }
+        heads[e.list] = i;
+    }
+
+    void unlink(uint32_t i) {
+        entry& e = entries[i];
+        if(e.prev != nil){
+            entries[e.prev].next = e.next;
+        }else{
+            heads[e.list] = e.next;
+        }
+        if(e.next != nil){
+            entries[e.next].prev = e.prev;
+        }
+    }
+
+    void release(uint32_t i) {
+        entry& e = entries[i];
+        e.callback = nullptr;
+        e.active = false;
+        ++e.generation;
+        free_entries.push_back(i);
+        --live;
+    }
+
+    /**
+     * Bajar de nivel los timers de la lista que le toca ahora al nivel level
+     * @returns índice de esa lista dentro del nivel, 0 si el nivel siguiente también tiene que bajar
+     */
+    uint32_t cascade(unsigned int level) {
+        uint32_t index = static_cast<uint32_t>((current >> (level * level_bits)) & slot_mask);
+        uint32_t list = level * slots_per_level + index;
+        uint32_t i = heads[list];
+        heads[list] = nil;
+        while (i != nil) {
+            uint32_t next = entries[i].next;
+            link(i);
+            i = next;
+        }
+        return index;
+    }
+
+    time_type current;
+    size_t live;
+    vector<uint32_t> heads;
+    vector<entry> entries;
+    vector<uint32_t> free_entries;
+};
+
+const uint32_t hierarchical_timer_wheel::nil;
+
+/**
+ * Servicio de timeouts en régimen estable: por tick se programan 16 timeouts con duración al azar en [1, range(0)],
+ * se cancelan 14 timers pendientes al azar (conexiones que terminaron), se adelanta 1 y se avanza el reloj un tick.
+ * Caso favorable a la rueda: todo es \O(1) y el reloj avanza de a un tick
+ */
+template < typename Queue >
+static void BM_timer_cancel_heavy(benchmark::State& state) {
+    const uint64_t max_timeout = static_cast<uint64_t>(state.range(0));
+    Queue q;
+    mt19937_64 gen(1);
+    vector<typename Queue::timer_id> ids;
+    uint64_t now = 0;
+    uint64_t fired = 0;
+    for (auto _ : state) {
+        for (int k = 0; k < 16; ++k) {
+            ids.push_back(q.schedule(now + 1 + gen() % max_timeout, [&fired]{ ++fired; }));
+        }
+        for (int k = 0; k < 14 && !ids.empty(); ++k) {
+            size_t j = gen() % ids.size();
+            q.cancel(ids[j]);
+            ids[j] = ids.back();
+            ids.pop_back();
+        }
+        if(!ids.empty()){
+            q.reschedule(ids[gen() % ids.size()], now + 1);
+        }
+        q.run_expired(now);
+        ++now;
+    }
+    state.SetItemsProcessed(state.iterations() * 31);
+    state.counters["pending"] = static_cast<double>(q.size());
+    benchmark::DoNotOptimize(fired);
+}
+
+/**
+ * Timers dispersos: pocos timers pendientes (64) con vencimientos lejanos y el reloj avanzando de a range(0)
+ * ticks, como un scheduler que duerme hasta el próximo evento. Caso favorable al heap: la rueda recorre
+ * cada tick transcurrido aunque no haya nada que ejecutar
+ */
+template < typename Queue >
+static void BM_timer_sparse(benchmark::State& state) {
+    const uint64_t step = static_cast<uint64_t>(state.range(0));
+    Queue q;
+    mt19937_64 gen(2);
+    uint64_t now = 0;
+    uint64_t fired = 0;
+    for (int k = 0; k < 64; ++k) {
+        q.schedule(now + 1 + gen() % (64 * step), [&fired]{ ++fired; });
+    }
+    for (auto _ : state) {
+        now += step;
+        size_t n = q.run_expired(now);
+        for (size_t k = 0; k < n; ++k) {
+            q.schedule(now + 1 + gen() % (64 * step), [&fired]{ ++fired; });
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(fired));
+    benchmark::DoNotOptimize(fired);
+}
+
+BENCHMARK_TEMPLATE(BM_timer_cancel_heavy, timer_queue)->RangeMultiplier(32)->Range(1 << 5, 1 << 20);
+BENCHMARK_TEMPLATE(BM_timer_cancel_heavy, hierarchical_timer_wheel)->RangeMultiplier(32)->Range(1 << 5, 1 << 20);
+BENCHMARK_TEMPLATE(BM_timer_sparse, timer_queue)->RangeMultiplier(16)->Range(1, 1 << 16);
+BENCHMARK_TEMPLATE(BM_timer_sparse, hierarchical_timer_wheel)->RangeMultiplier(16)->Range(1, 1 << 16);
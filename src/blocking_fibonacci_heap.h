@@ -0,0 +1,202 @@
+#ifndef BLOCKING_FIBONACCI_HEAP_H
+#define BLOCKING_FIBONACCI_HEAP_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include "fibonacci_heap.h"
+
+/**
+ * Cola de prioridad bloqueante sobre fibonacci_heap para pools de workers.
+ * - pop_wait espera hasta que haya un elemento, pop_wait_for como mucho un tiempo, try_pop nunca espera
+ * - Con capacidad máxima push espera a que haya lugar (backpressure), try_push no espera
+ * - close() hace que los push fallen y despierta a todos; los pop siguen sacando lo que quedó
+ *   y recién fallan cuando la cola está cerrada y vacia
+ * - Cada push despierta a lo sumo un consumidor y cada pop a lo sumo un productor, y solo si hay alguno
+ *   esperando, así no se despiertan todos para pelear por un elemento. Solo close y drain usan notify_all:
+ *   drain libera muchos lugares de una vez y puede haber varios productores esperando
+ * - No hay handles. No se puede copiar ni mover
+ * Asume lo mismo de T, Compare y Allocator que fibonacci_heap
+ */
+template < typename T, typename Compare = std::less<T>, typename Allocator = std::allocator<T> >
+class blocking_fibonacci_heap {
+public:
+    using heap_type = fibonacci_heap<T, Compare, Allocator>;
+    using value_type = T;
+    using size_type = size_t;
+    using value_compare = Compare;
+    using allocator_type = Allocator;
+
+    /**
+     * @brief Construye cola vacia y abierta
+     * @param capacity cantidad máxima de elementos, 0 si no tiene límite
+     * @param comp comparador a usar
+     * @param alloc allocator a usar
+     *
+     * \complexity{\O(1)}
+     */
+    explicit blocking_fibonacci_heap(size_type capacity = 0, const value_compare& comp = value_compare(), const allocator_type& alloc = allocator_type());
+
+    blocking_fibonacci_heap(const blocking_fibonacci_heap&) = delete;
+    blocking_fibonacci_heap& operator=(const blocking_fibonacci_heap&) = delete;
+
+    /**
+     * @returns cantidad máxima de elementos, 0 si no tiene límite
+     *
+     * \complexity{\O(1)}
+     */
+    size_type capacity() const;
+
+    /**
+     * @returns cantidad de elementos en este momento
+     *
+     * \complexity{\O(1)} más la espera del lock
+     */
+    size_type size() const;
+
+    /**
+     * @returns true \IFF size() == 0
+     *
+     * \complexity{\O(1)} más la espera del lock
+     */
+    bool empty() const;
+
+    /**
+     * @returns true \IFF ya se llamó a close()
+     *
+     * \complexity{\O(1)} más la espera del lock
+     */
+    bool closed() const;
+
+    /**
+     * @brief Inserción esperando mientras la cola esté llena
+     * @param val elemento a insertar
+     *
+     * @returns false \IFF la cola está cerrada (antes o mientras se esperaba), y entonces no se insertó
+     *
+     * \complexity{\O(1)} más la espera
+     */
+    bool push(const value_type& val);
+    bool push(value_type&& val);
+
+    /**
+     * @brief Inserción construyendo el elemento, esperando mientras la cola esté llena
+     * @param args argumentos para el constructor de T
+     *
+     * @returns false \IFF la cola está cerrada, y entonces no se construyó nada
+     *
+     * \complexity{\O(1)} más la construcción de T y la espera
+     */
+    template < typename... Args >
+    bool emplace(Args&&... args);
+
+    /**
+     * @brief Inserción sin esperar
+     * @param val elemento a insertar
+     *
+     * @returns false \IFF la cola está llena o cerrada, y entonces no se insertó
+     *
+     * \complexity{\O(1)} más la espera del lock
+     */
+    bool try_push(const value_type& val);
+    bool try_push(value_type&& val);
+
+    /**
+     * @brief Remover el minimo esperando mientras la cola esté vacia y abierta
+     * @param out donde se mueve el minimo
+     *
+     * @returns false \IFF la cola está cerrada y vacia
+     *
+     * \complexity{\O(log(n) amortizado)} más la espera
+     */
+    bool pop_wait(value_type& out);
+
+    /**
+     * @brief Remover el minimo esperando como mucho timeout
+     * @param out donde se mueve el minimo
+     * @param timeout tiempo máximo de espera
+     *
+     * @returns false \IFF se venció el tiempo sin elementos o la cola está cerrada y vacia
+     *
+     * \complexity{\O(log(n) amortizado)} más la espera
+     */
+    template < typename Rep, typename Period >
+    bool pop_wait_for(value_type& out, const std::chrono::duration<Rep, Period>& timeout);
+
+    /**
+     * @brief Remover el minimo sin esperar
+     * @param out donde se mueve el minimo
+     *
+     * @returns false \IFF la cola está vacia
+     *
+     * \complexity{\O(log(n) amortizado)} más la espera del lock
+     */
+    bool try_pop(value_type& out);
+
+    /**
+     * @brief Remover todos los elementos en orden sin esperar, por ejemplo después de close()
+     * @param out iterador de salida donde se mueven los elementos
+     *
+     * @returns out avanzado una posición por elemento removido
+     *
+     * \complexity{\O(n log(n) amortizado)}
+     */
+    template < typename OutputIt >
+    OutputIt drain(OutputIt out);
+
+    /**
+     * @brief Cerrar la cola: los push fallan desde ahora y se despierta a todos los que esperan
+     * Los elementos que quedan se pueden seguir sacando
+     *
+     * \complexity{\O(1)} más los hilos despertados
+     */
+    void close();
+
+private:
+
+    /**
+     * @returns true \IFF no entra otro elemento
+     * \pre se tiene lock
+     *
+     * \complexity{\O(1)}
+     */
+    bool full() const;
+
+    /**
+     * @brief Insertar con lock tomado y despertar a un consumidor si hay alguno esperando
+     * @param guard lock tomado, se suelta antes de despertar
+     * @param args argumentos para el constructor de T
+     *
+     * \complexity{\O(1)} más la construcción de T
+     */
+    template < typename... Args >
+    void insert_and_notify(std::unique_lock<std::mutex>& guard, Args&&... args);
+
+    /**
+     * @brief Sacar el minimo con lock tomado y despertar a un productor si hay alguno esperando
+     * @param guard lock tomado, se suelta antes de despertar
+     * @param out donde se mueve el minimo
+     * \pre !heap.empty()
+     *
+     * \complexity{\O(log(n) amortizado)}
+     */
+    void pop_and_notify(std::unique_lock<std::mutex>& guard, value_type& out);
+
+    /** @{ */
+    mutable std::mutex lock;
+    std::condition_variable not_empty;
+    std::condition_variable not_full;
+    heap_type heap;
+    size_type max_size;
+    size_type waiting_consumers;
+    size_type waiting_producers;
+    bool is_closed;
+    /** @} */
+};
+
+#include "blocking_fibonacci_heap.hpp"
+
+#endif //BLOCKING_FIBONACCI_HEAP_H
@@ -0,0 +1,162 @@
+#include "blocking_fibonacci_heap.h"
+
+template<typename T, typename Compare, typename Allocator>
+blocking_fibonacci_heap<T, Compare, Allocator>::blocking_fibonacci_heap(size_type capacity, const value_compare &comp, const allocator_type &alloc) : heap(comp, alloc), max_size(capacity), waiting_consumers(0), waiting_producers(0), is_closed(false) {}
+
+template<typename T, typename Compare, typename Allocator>
+typename blocking_fibonacci_heap<T, Compare, Allocator>::size_type blocking_fibonacci_heap<T, Compare, Allocator>::capacity() const {
+    return max_size;
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename blocking_fibonacci_heap<T, Compare, Allocator>::size_type blocking_fibonacci_heap<T, Compare, Allocator>::size() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return heap.size();
+}
+
+template<typename T, typename Compare, typename Allocator>
+bool blocking_fibonacci_heap<T, Compare, Allocator>::empty() const {
+    return size() == 0;
+}
+
+template<typename T, typename Compare, typename Allocator>
+bool blocking_fibonacci_heap<T, Compare, Allocator>::closed() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return is_closed;
+}
+
+template<typename T, typename Compare, typename Allocator>
+bool blocking_fibonacci_heap<T, Compare, Allocator>::push(const value_type &val) {
+    return emplace(val);
+}
+
+template<typename T, typename Compare, typename Allocator>
+bool blocking_fibonacci_heap<T, Compare, Allocator>::push(value_type &&val) {
+    return emplace(std::move(val));
+}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename... Args>
+bool blocking_fibonacci_heap<T, Compare, Allocator>::emplace(Args &&... args) {
+    std::unique_lock<std::mutex> guard(lock);
+    if(!is_closed && full()){
+        ++waiting_producers;
+        not_full.wait(guard, [this]{ return is_closed || !full(); });
+        --waiting_producers;
+    }
+    if(is_closed){
+        return false;
+    }
+    insert_and_notify(guard, std::forward<Args>(args)...);
+    return true;
+}
+
+template<typename T, typename Compare, typename Allocator>
+bool blocking_fibonacci_heap<T, Compare, Allocator>::try_push(const value_type &val) {
+    std::unique_lock<std::mutex> guard(lock);
+    if(is_closed || full()){
+        return false;
+    }
+    insert_and_notify(guard, val);
+    return true;
+}
+
+template<typename T, typename Compare, typename Allocator>
+bool blocking_fibonacci_heap<T, Compare, Allocator>::try_push(value_type &&val) {
+    std::unique_lock<std::mutex> guard(lock);
+    if(is_closed || full()){
+        return false;
+    }
+    insert_and_notify(guard, std::move(val));
+    return true;
+}
+
+template<typename T, typename Compare, typename Allocator>
+bool blocking_fibonacci_heap<T, Compare, Allocator>::pop_wait(value_type &out) {
+    std::unique_lock<std::mutex> guard(lock);
+    if(heap.empty() && !is_closed){
+        ++waiting_consumers;
+        not_empty.wait(guard, [this]{ return is_closed || !heap.empty(); });
+        --waiting_consumers;
+    }
+    if(heap.empty()){
+        return false;
+    }
+    pop_and_notify(guard, out);
+    return true;
+}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename Rep, typename Period>
+bool blocking_fibonacci_heap<T, Compare, Allocator>::pop_wait_for(value_type &out, const std::chrono::duration<Rep, Period> &timeout) {
+    std::unique_lock<std::mutex> guard(lock);
+    if(heap.empty() && !is_closed){
+        ++waiting_consumers;
+        not_empty.wait_for(guard, timeout, [this]{ return is_closed || !heap.empty(); });
+        --waiting_consumers;
+    }
+    if(heap.empty()){
+        return false;
+    }
+    pop_and_notify(guard, out);
+    return true;
+}
+
+template<typename T, typename Compare, typename Allocator>
+bool blocking_fibonacci_heap<T, Compare, Allocator>::try_pop(value_type &out) {
+    std::unique_lock<std::mutex> guard(lock);
+    if(heap.empty()){
+        return false;
+    }
+    pop_and_notify(guard, out);
+    return true;
+}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename OutputIt>
+OutputIt blocking_fibonacci_heap<T, Compare, Allocator>::drain(OutputIt out) {
+    std::unique_lock<std::mutex> guard(lock);
+    out = heap.pop_k(heap.size(), out);
+    bool wake = waiting_producers > 0;
+    guard.unlock();
+    if(wake){
+        not_full.notify_all();
+    }
+    return out;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void blocking_fibonacci_heap<T, Compare, Allocator>::close() {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        is_closed = true;
+    }
+    not_empty.notify_all();
+    not_full.notify_all();
+}
+
+template<typename T, typename Compare, typename Allocator>
+bool blocking_fibonacci_heap<T, Compare, Allocator>::full() const {
+    return max_size != 0 && heap.size() >= max_size;
+}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename... Args>
+void blocking_fibonacci_heap<T, Compare, Allocator>::insert_and_notify(std::unique_lock<std::mutex> &guard, Args &&... args) {
+    heap.emplace(std::forward<Args>(args)...);
+    bool wake = waiting_consumers > 0;
+    guard.unlock();
+    if(wake){
+        not_empty.notify_one();
+    }
+}
+
+template<typename T, typename Compare, typename Allocator>
+void blocking_fibonacci_heap<T, Compare, Allocator>::pop_and_notify(std::unique_lock<std::mutex> &guard, value_type &out) {
+    out = heap.pop_min();
+    bool wake = waiting_producers > 0;
+    guard.unlock();
+    if(wake){
+        not_full.notify_one();
+    }
+}
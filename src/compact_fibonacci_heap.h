@@ -0,0 +1,490 @@
+#ifndef COMPACT_FIBONACCI_HEAP_H
+#define COMPACT_FIBONACCI_HEAP_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include "utils.h"
+
+/**
+ * Implementación de min_priority_queue sobre min_fibonacci_heap con los nodos en un arreglo contiguo.
+ * Los enlaces son índices de 32 bits y la marca va en el bit más alto del grado, así cada nodo ocupa
+ * 20 bytes más la clave (fibonacci_heap usa 4 punteros, grado y marca: 40 bytes más la clave en 64 bits),
+ * y consolidate() y los cortes recorren menos líneas de cache.
+ * - Los handles son índices: siguen valiendo cuando el arreglo crece y en las copias del heap
+ * - Las posiciones que se liberan se reusan en las siguientes inserciones
+ * - A lo sumo max_size() elementos
+ * Asume de T:
+ * - tiene constructor por movimiento o por copia (se usan al crecer el arreglo)
+ * Asume de Compare:
+ * - Compare()(a, b) (con complejidad cmp(T)) define una relación de orden débil, por defecto operador <
+ * - si es una clase vacía no ocupa lugar en el heap
+ * Asume de Allocator:
+ * - cumple los requisitos de allocator de la biblioteca estándar (se usa con rebind a Node, de a arreglos)
+ */
+template < typename T, typename Compare = std::less<T>, typename Allocator = std::allocator<T> >
+class compact_fibonacci_heap : private ebo_holder<Compare> {
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using value_compare = Compare;
+    using allocator_type = Allocator;
+
+    class handle;
+
+    /**
+     * @brief Construye heap vacio
+     * \complexity{\O(1)}
+     */
+    compact_fibonacci_heap();
+
+    /**
+     * @brief Construye heap vacio que ordena con comp
+     * @param comp comparador a usar
+     * @param alloc allocator a usar
+     *
+     * \complexity{\O(1)}
+     */
+    explicit compact_fibonacci_heap(const value_compare& comp, const allocator_type& alloc = allocator_type());
+
+    /**
+     * @brief Construye heap vacio que pide el arreglo a alloc
+     * @param alloc allocator a usar
+     *
+     * \complexity{\O(1)}
+     */
+    explicit compact_fibonacci_heap(const allocator_type& alloc);
+
+    /**
+     * @brief Destructor
+     * \complexity{\O(n)}
+     */
+    ~compact_fibonacci_heap();
+
+    /**
+     * @brief Constructor por copia, los handles de h valen para la copia
+     * \complexity{\O(n)}
+     */
+    compact_fibonacci_heap(const compact_fibonacci_heap& h);
+
+    /**
+     * @brief Operador de asignacion, los handles de h valen para este heap
+     * \complexity{\O(n)}
+     */
+    compact_fibonacci_heap& operator=(const compact_fibonacci_heap& h);
+
+    /**
+     * @brief Constructor por movimiento
+     * \complexity{\O(1)}
+     */
+    compact_fibonacci_heap(compact_fibonacci_heap&& h) noexcept;
+
+    /**
+     * @brief Operador de asignacion por movimiento
+     * \pre los allocators son iguales o se propagan al mover
+     * \complexity{\O(n)}
+     */
+    compact_fibonacci_heap& operator=(compact_fibonacci_heap&& h) noexcept;
+
+    /**
+     * @brief Remueve todos los elementos, el arreglo se conserva
+     *
+     * \complexity{\O(n)}
+     */
+    void clear();
+
+    /**
+     * @brief Intercambia los elementos de 2 heaps
+     * @param h heap a intercambiar
+     * \pre los allocators son iguales o se propagan al intercambiar
+     *
+     * \complexity{\O(1)}
+     */
+    void swap(compact_fibonacci_heap& h);
+
+    /**
+     * @brief Agrandar el arreglo para que entren k elementos sin volver a pedir memoria
+     * @param k cantidad de elementos
+     * \pre k \LEQ max_size()
+     *
+     * \complexity{\O(n)} si crece, \O(1) si no
+     */
+    void reserve(size_type k);
+
+    /**
+     * @returns cantidad de elementos que entran sin volver a pedir memoria
+     *
+     * \complexity{\O(1)}
+     */
+    size_type capacity() const;
+
+    /**
+     * @returns máxima cantidad de elementos (los índices son de 32 bits)
+     *
+     * \complexity{\O(1)}
+     */
+    static constexpr size_type max_size() { return 0xFFFFFFFEU; }
+
+    /**
+     * @returns bytes que ocupa cada posición del arreglo, enlaces y clave incluidos
+     *
+     * \complexity{\O(1)}
+     */
+    static constexpr size_type bytes_per_element() { return sizeof(Node); }
+
+    /**
+     * @brief Devuelve copia del allocator
+     *
+     * \complexity{\O(1)}
+     */
+    allocator_type get_allocator() const;
+
+    /**
+     * @brief Devuelve copia del comparador
+     *
+     * \complexity{\O(1)}
+     */
+    value_compare value_comp() const;
+
+    /**
+     * @returns true \IFF size() == 0
+     *
+     * \complexity{\O(1)}
+     */
+    bool empty() const;
+
+    /**
+     * @returns cantidad de elementos
+     *
+     * \complexity{\O(1)}
+     */
+    size_type size() const;
+
+    /**
+     * @brief Acceso al minimo elemento
+     * \pre !empty()
+     *
+     * @returns referencia constante al minimo
+     *
+     * \complexity{\O(1)}
+     */
+    const value_type& minimum() const;
+
+    /**
+     * @brief Acceso al elemento de un handle
+     * @param x handle que apunta al elemento
+     * \pre x apunta a un elemento de este heap
+     *
+     * @returns referencia constante al elemento, vale hasta la siguiente inserción
+     *
+     * \complexity{\O(1)}
+     */
+    const value_type& get(const handle& x) const;
+
+    /**
+     * @brief Inserción
+     * @param val elemento a insertar, puede ser un elemento de este mismo heap
+     * \pre size() < max_size()
+     *
+     * @returns handle que apunta al elemento insertado
+     *
+     * \complexity{\O(1)} amortizado
+     */
+    handle insert(const value_type& val);
+
+    /**
+     * @brief Inserción moviendo el elemento
+     * @param val elemento a insertar
+     * \pre size() < max_size()
+     *
+     * @returns handle que apunta al elemento insertado
+     *
+     * \complexity{\O(1)} amortizado
+     */
+    handle insert(value_type&& val);
+
+    /**
+     * @brief Inserción construyendo el elemento dentro del arreglo
+     * @param args argumentos para el constructor de T
+     * \pre size() < max_size()
+     *
+     * @returns handle que apunta al elemento insertado
+     *
+     * \complexity{\O(1)} amortizado más la construcción de T
+     */
+    template < typename... Args >
+    handle emplace(Args&&... args);
+
+    /**
+     * @brief Remover minimo
+     * \complexity{\O(log(n) amortizado)}
+     */
+    void extract_min();
+
+    /**
+     * @brief Remover minimo devolviéndolo
+     * \pre !empty()
+     *
+     * @returns el elemento que era el minimo
+     *
+     * \complexity{\O(log(n) amortizado)}
+     */
+    value_type pop_min();
+
+    /**
+     * @brief Eliminar elemento
+     * @param x handle que apunta al elemento a eliminar
+     *
+     * \complexity{\O(log(n) amortizado)}
+     */
+    void delete_key(handle& x);
+
+    /**
+     * @brief Decrementar elemento
+     * @param x handle que apunta al elemento a decrementar
+     * @param val nuevo valor del elemento
+     * \pre value_comp()(\P{val}, get(\P{x}))
+     *
+     * \complexity{\O(1) amortizado}
+     */
+    void decrease_key(const handle& x, const value_type& val);
+
+    /**
+     * @brief Decrementar elemento moviendo el nuevo valor
+     * @param x handle que apunta al elemento a decrementar
+     * @param val nuevo valor del elemento
+     * \pre value_comp()(\P{val}, get(\P{x}))
+     *
+     * \complexity{\O(1) amortizado}
+     */
+    void decrease_key(const handle& x, value_type&& val);
+
+    /**
+     * @brief Une 2 heaps moviendo los elementos de h a este heap
+     * Los handles de h dejan de valer. Si algo lanza una excepción ningún heap cambia
+     * @param h heap a unir que queda vacio
+     *
+     * \complexity{\O(m)} con m = h.size()
+     */
+    void join(compact_fibonacci_heap& h);
+
+private:
+
+    using compare_holder = ebo_holder<Compare>;
+    using index = std::uint32_t;
+
+    static const index nil = 0xFFFFFFFFU;
+    static const std::uint32_t mark_bit = 0x80000000U;
+    static const std::uint32_t free_slot = 0xFFFFFFFFU;
+    static const unsigned int degree_table_size = fibonacci_rank_bound(0xFFFFFFFEULL) + 1;
+
+    /**
+     * Posición del arreglo:
+     * - enlaces como índices (nil si no hay)
+     * - grado en los 31 bits bajos de degree_mark y marca en el más alto, free_slot si la posición está libre
+     * - la clave después, construida solo si la posición está ocupada
+     * En las posiciones libres right enlaza la lista de libres
+     */
+    struct Node {
+        index parent;
+        index child;
+        index left;
+        index right;
+        std::uint32_t degree_mark;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+
+        T& key() { return *reinterpret_cast<T*>(&storage); }
+        const T& key() const { return *reinterpret_cast<const T*>(&storage); }
+    };
+
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    /**
+     * @returns true \IFF el elemento en a va antes que el de b
+     *
+     * \complexity{\O(cmp(T))}
+     */
+    bool precedes(index a, index b) const;
+
+    /**
+     * @returns grado del nodo x
+     *
+     * \complexity{\O(1)}
+     */
+    std::uint32_t degree(index x) const;
+
+    /**
+     * @brief Construir un elemento en una posición libre, agrandando el arreglo si hace falta
+     * @param args argumentos para construir la clave
+     * Si la construcción lanza una excepción el heap no cambia
+     *
+     * @returns índice del nodo creado, que representa un heap de un elemento
+     *
+     * \complexity{\O(1)} amortizado más la construcción de T
+     */
+    template < typename... Args >
+    index create_node(Args&&... args);
+
+    /**
+     * @brief Destruir la clave de x y agregar su posición a la lista de libres
+     *
+     * \complexity{\O(1)}
+     */
+    void destroy_node(index x);
+
+    /**
+     * @brief Mover todas las posiciones a un arreglo nuevo y liberar el viejo
+     * @param fresh arreglo nuevo de new_capacity posiciones
+     * Si mover una clave lanza una excepción se destruye lo movido y el heap no cambia (fresh no se libera)
+     *
+     * \complexity{\O(n)}
+     */
+    void relocate(Node* fresh, index new_capacity);
+
+    /**
+     * @returns capacidad a usar cuando el arreglo se llena
+     *
+     * \complexity{\O(1)}
+     */
+    index grown_capacity() const;
+
+    /**
+     * @brief Copiar las posiciones de h manteniendo índices y forma de los árboles
+     * \pre slots == 0
+     *
+     * \complexity{\O(n)}
+     */
+    void copy_from(const compact_fibonacci_heap& h);
+
+    /**
+     * @brief Destruir las claves y devolver el arreglo al allocator
+     *
+     * \complexity{\O(n)}
+     */
+    void release();
+
+    /**
+     * @brief unir las listas de a y b
+     *
+     * \complexity{\O(1)}
+     */
+    void splice(index a, index b);
+
+    /**
+     * @brief Sacar x de la lista en la que está sin romperla y unirlo a si mismo
+     *
+     * \complexity{\O(1)}
+     */
+    void unlink(index x);
+
+    /**
+     * @brief Poner un nodo nuevo en la lista de raíces
+     *
+     * \complexity{\O(1)}
+     */
+    void push_root(index x);
+
+    /**
+     * @brief Sacar el minimo del bosque sin destruirlo
+     * \pre !empty()
+     *
+     * @returns índice del nodo sacado
+     *
+     * \complexity{\O(log(n) amortizado)}
+     */
+    index pop_root();
+
+    /**
+     * @brief Reubicar un nodo cuya clave acaba de decrementarse
+     *
+     * \complexity{\O(1) amortizado}
+     */
+    void decreased(index x);
+
+    /**
+     * @brief Unir árboles de igual grado hasta que no haya dos raíces del mismo grado y actualizar el minimo
+     *
+     * \complexity{\O(log(n) amortizado)}
+     */
+    void consolidate();
+
+    /**
+     * @brief Mover x de los hijos de parent a la lista de raíces
+     *
+     * \complexity{\O(1)}
+     */
+    void cut(index x, index parent);
+
+    /**
+     * @brief Cortar hacia arriba mientras los padres estén marcados, sin recursión
+     *
+     * \complexity{\O(1) amortizado}
+     */
+    void cascading_cut(index x);
+
+    /** @{ */
+    Node* nodes;
+    index slots;
+    index cap;
+    index free_head;
+    index min;
+    size_type n;
+    node_allocator alloc;
+    index degree_table[degree_table_size];
+    /** @} */
+};
+
+template<typename T, typename Compare, typename Allocator>
+class compact_fibonacci_heap<T, Compare, Allocator>::handle {
+public:
+
+    /**
+     * @brief Construye handle que no apunta a ningún elemento
+     */
+    handle();
+
+    /**
+     * @brief Comparacion entre handles
+     *
+     * @param other handle a comparar
+     *
+     * @returns true \IFF apuntan a la misma posición
+     *
+     * \complexity{\O(1)}
+     */
+    bool operator==(const handle &other) const;
+
+    /**
+     * @brief Comparacion entre handles
+     *
+     * @param other handle a comparar
+     *
+     * @returns false \IFF apuntan a la misma posición
+     *
+     * \complexity{\O(1)}
+     */
+    bool operator!=(const handle &other) const;
+
+private:
+
+    friend class compact_fibonacci_heap;
+
+    /**
+     * @brief Constructor
+     * @param i posición del arreglo a la que estará ligado
+     */
+    explicit handle(index i);
+
+    /** @{ */
+    index i;
+    /** @} */
+};
+
+#include "compact_fibonacci_heap.hpp"
+
+#endif //COMPACT_FIBONACCI_HEAP_H
@@ -0,0 +1,571 @@
+#include "compact_fibonacci_heap.h"
+
+template<typename T, typename Compare, typename Allocator>
+const typename compact_fibonacci_heap<T, Compare, Allocator>::index compact_fibonacci_heap<T, Compare, Allocator>::nil;
+
+template<typename T, typename Compare, typename Allocator>
+const std::uint32_t compact_fibonacci_heap<T, Compare, Allocator>::mark_bit;
+
+template<typename T, typename Compare, typename Allocator>
+const std::uint32_t compact_fibonacci_heap<T, Compare, Allocator>::free_slot;
+
+template<typename T, typename Compare, typename Allocator>
+const unsigned int compact_fibonacci_heap<T, Compare, Allocator>::degree_table_size;
+
+template<typename T, typename Compare, typename Allocator>
+compact_fibonacci_heap<T, Compare, Allocator>::compact_fibonacci_heap() : nodes(nullptr), slots(0), cap(0), free_head(nil), min(nil), n(0), alloc() {
+    std::fill(degree_table, degree_table + degree_table_size, nil);
+}
+
+template<typename T, typename Compare, typename Allocator>
+compact_fibonacci_heap<T, Compare, Allocator>::compact_fibonacci_heap(const value_compare &comp, const allocator_type &alloc) : compare_holder(comp), nodes(nullptr), slots(0), cap(0), free_head(nil), min(nil), n(0), alloc(alloc) {
+    std::fill(degree_table, degree_table + degree_table_size, nil);
+}
+
+template<typename T, typename Compare, typename Allocator>
+compact_fibonacci_heap<T, Compare, Allocator>::compact_fibonacci_heap(const allocator_type &alloc) : nodes(nullptr), slots(0), cap(0), free_head(nil), min(nil), n(0), alloc(alloc) {
+    std::fill(degree_table, degree_table + degree_table_size, nil);
+}
+
+template<typename T, typename Compare, typename Allocator>
+compact_fibonacci_heap<T, Compare, Allocator>::~compact_fibonacci_heap() {
+    release();
+}
+
+template<typename T, typename Compare, typename Allocator>
+compact_fibonacci_heap<T, Compare, Allocator>::compact_fibonacci_heap(const compact_fibonacci_heap &h) : compare_holder(h.compare_holder::get()), nodes(nullptr), slots(0), cap(0), free_head(nil), min(nil), n(0), alloc(node_traits::select_on_container_copy_construction(h.alloc)) {
+    std::fill(degree_table, degree_table + degree_table_size, nil);
+    copy_from(h);
+}
+
+template<typename T, typename Compare, typename Allocator>
+compact_fibonacci_heap<T, Compare, Allocator> &compact_fibonacci_heap<T, Compare, Allocator>::operator=(const compact_fibonacci_heap &h) {
+    if(this != &h){
+        clear();
+        compare_holder::get() = h.compare_holder::get();
+        if(node_traits::propagate_on_container_copy_assignment::value){
+            release();
+            alloc = h.alloc;
+        }
+        copy_from(h);
+    }
+    return *this;
+}
+
+template<typename T, typename Compare, typename Allocator>
+compact_fibonacci_heap<T, Compare, Allocator>::compact_fibonacci_heap(compact_fibonacci_heap &&h) noexcept : compare_holder(h.compare_holder::get()), nodes(h.nodes), slots(h.slots), cap(h.cap), free_head(h.free_head), min(h.min), n(h.n), alloc(h.alloc) {
+    std::fill(degree_table, degree_table + degree_table_size, nil);
+    h.nodes = nullptr;
+    h.slots = 0;
+    h.cap = 0;
+    h.free_head = nil;
+    h.min = nil;
+    h.n = 0;
+}
+
+template<typename T, typename Compare, typename Allocator>
+compact_fibonacci_heap<T, Compare, Allocator> &compact_fibonacci_heap<T, Compare, Allocator>::operator=(compact_fibonacci_heap &&h) noexcept {
+    release();
+    if(node_traits::propagate_on_container_move_assignment::value){
+        alloc = h.alloc;
+    }
+    assert(alloc == h.alloc);
+    swap(h);
+    return *this;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void compact_fibonacci_heap<T, Compare, Allocator>::clear() {
+    for (index i = 0; i < slots; ++i) {
+        if(nodes[i].degree_mark != free_slot){
+            node_traits::destroy(alloc, &nodes[i].key());
+        }
+    }
+    slots = 0;
+    free_head = nil;
+    min = nil;
+    n = 0;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void compact_fibonacci_heap<T, Compare, Allocator>::swap(compact_fibonacci_heap &h) {
+    if(node_traits::propagate_on_container_swap::value){
+        std::swap(alloc,h.alloc);
+    }
+    assert(alloc == h.alloc);
+    std::swap(compare_holder::get(),h.compare_holder::get());
+    std::swap(nodes,h.nodes);
+    std::swap(slots,h.slots);
+    std::swap(cap,h.cap);
+    std::swap(free_head,h.free_head);
+    std::swap(min,h.min);
+    std::swap(n,h.n);
+}
+
+template<typename T, typename Compare, typename Allocator>
+void compact_fibonacci_heap<T, Compare, Allocator>::reserve(size_type k) {
+    assert(k <= max_size());
+    if(k <= cap){
+        return;
+    }
+    index new_capacity = static_cast<index>(k);
+    Node* fresh = node_traits::allocate(alloc, new_capacity);
+    try{
+        relocate(fresh, new_capacity);
+    }catch(...){
+        node_traits::deallocate(alloc, fresh, new_capacity);
+        throw;
+    }
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename compact_fibonacci_heap<T, Compare, Allocator>::size_type compact_fibonacci_heap<T, Compare, Allocator>::capacity() const {
+    return cap;
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename compact_fibonacci_heap<T, Compare, Allocator>::allocator_type compact_fibonacci_heap<T, Compare, Allocator>::get_allocator() const {
+    return allocator_type(alloc);
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename compact_fibonacci_heap<T, Compare, Allocator>::value_compare compact_fibonacci_heap<T, Compare, Allocator>::value_comp() const {
+    return compare_holder::get();
+}
+
+template<typename T, typename Compare, typename Allocator>
+bool compact_fibonacci_heap<T, Compare, Allocator>::empty() const {
+    return min == nil;
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename compact_fibonacci_heap<T, Compare, Allocator>::size_type compact_fibonacci_heap<T, Compare, Allocator>::size() const {
+    return n;
+}
+
+template<typename T, typename Compare, typename Allocator>
+const typename compact_fibonacci_heap<T, Compare, Allocator>::value_type &compact_fibonacci_heap<T, Compare, Allocator>::minimum() const {
+    assert(!empty());
+    return nodes[min].key();
+}
+
+template<typename T, typename Compare, typename Allocator>
+const typename compact_fibonacci_heap<T, Compare, Allocator>::value_type &compact_fibonacci_heap<T, Compare, Allocator>::get(const handle &x) const {
+    assert(x.i < slots && nodes[x.i].degree_mark != free_slot);
+    return nodes[x.i].key();
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename compact_fibonacci_heap<T, Compare, Allocator>::handle compact_fibonacci_heap<T, Compare, Allocator>::insert(const value_type &val) {
+    index x = create_node(val);
+    push_root(x);
+    return handle(x);
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename compact_fibonacci_heap<T, Compare, Allocator>::handle compact_fibonacci_heap<T, Compare, Allocator>::insert(value_type &&val) {
+    index x = create_node(std::move(val));
+    push_root(x);
+    return handle(x);
+}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename... Args>
+typename compact_fibonacci_heap<T, Compare, Allocator>::handle compact_fibonacci_heap<T, Compare, Allocator>::emplace(Args &&... args) {
+    index x = create_node(std::forward<Args>(args)...);
+    push_root(x);
+    return handle(x);
+}
+
+template<typename T, typename Compare, typename Allocator>
+void compact_fibonacci_heap<T, Compare, Allocator>::extract_min() {
+    if(!empty()){
+        destroy_node(pop_root());
+    }
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename compact_fibonacci_heap<T, Compare, Allocator>::value_type compact_fibonacci_heap<T, Compare, Allocator>::pop_min() {
+    assert(!empty());
+    index x = pop_root();
+    value_type res(std::move(nodes[x].key()));
+    destroy_node(x);
+    return res;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void compact_fibonacci_heap<T, Compare, Allocator>::delete_key(handle &x) {
+    index parent = nodes[x.i].parent;
+    if(parent != nil){
+        cut(x.i,parent);
+        cascading_cut(parent);
+    }
+    min = x.i;
+    destroy_node(pop_root());
+}
+
+template<typename T, typename Compare, typename Allocator>
+void compact_fibonacci_heap<T, Compare, Allocator>::decrease_key(const handle &x, const value_type &val) {
+    assert(compare_holder::get()(val, get(x)));
+    nodes[x.i].key() = val;
+    decreased(x.i);
+}
+
+template<typename T, typename Compare, typename Allocator>
+void compact_fibonacci_heap<T, Compare, Allocator>::decrease_key(const handle &x, value_type &&val) {
+    assert(compare_holder::get()(val, get(x)));
+    nodes[x.i].key() = std::move(val);
+    decreased(x.i);
+}
+
+template<typename T, typename Compare, typename Allocator>
+void compact_fibonacci_heap<T, Compare, Allocator>::join(compact_fibonacci_heap &h) {
+    if(h.empty()){
+        return;
+    }
+    reserve(static_cast<size_type>(slots) + h.n);
+    // Los nodos nuevos se enlazan en una lista aparte hasta tenerlos todos, así una excepción no deja nada a medias
+    index first = nil;
+    try{
+        for (index j = 0; j < h.slots; ++j) {
+            if(h.nodes[j].degree_mark != free_slot){
+                index x = create_node(std::move_if_noexcept(h.nodes[j].key()));
+                if(first == nil){
+                    first = x;
+                }else{
+                    splice(first, x);
+                }
+            }
+        }
+    }catch(...){
+        while (first != nil){
+            index next = nodes[first].right == first ? nil : nodes[first].right;
+            unlink(first);
+            destroy_node(first);
+            first = next;
+        }
+        throw;
+    }
+    index new_min = first;
+    index i = first;
+    do{
+        if(precedes(i, new_min)){
+            new_min = i;
+        }
+        i = nodes[i].right;
+    }while(i != first);
+    if(empty()){
+        min = new_min;
+    }else{
+        splice(min, new_min);
+        if(precedes(new_min, min)){
+            min = new_min;
+        }
+    }
+    n += h.n;
+    h.clear();
+}
+
+template<typename T, typename Compare, typename Allocator>
+bool compact_fibonacci_heap<T, Compare, Allocator>::precedes(index a, index b) const {
+    return compare_holder::get()(nodes[a].key(), nodes[b].key());
+}
+
+template<typename T, typename Compare, typename Allocator>
+std::uint32_t compact_fibonacci_heap<T, Compare, Allocator>::degree(index x) const {
+    return nodes[x].degree_mark & ~mark_bit;
+}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename... Args>
+typename compact_fibonacci_heap<T, Compare, Allocator>::index compact_fibonacci_heap<T, Compare, Allocator>::create_node(Args &&... args) {
+    index x;
+    if(free_head != nil){
+        x = free_head;
+        node_traits::construct(alloc, &nodes[x].key(), std::forward<Args>(args)...);
+        free_head = nodes[x].right;
+    }else if(slots < cap){
+        x = slots;
+        node_traits::construct(alloc, &nodes[x].key(), std::forward<Args>(args)...);
+        ++slots;
+    }else{
+        // El elemento nuevo se construye antes de mover los viejos, así args puede referirse a uno de ellos
+        assert(slots < max_size());
+        index new_capacity = grown_capacity();
+        Node* fresh = node_traits::allocate(alloc, new_capacity);
+        x = slots;
+        try{
+            node_traits::construct(alloc, &fresh[x].key(), std::forward<Args>(args)...);
+        }catch(...){
+            node_traits::deallocate(alloc, fresh, new_capacity);
+            throw;
+        }
+        try{
+            relocate(fresh, new_capacity);
+        }catch(...){
+            node_traits::destroy(alloc, &fresh[x].key());
+            node_traits::deallocate(alloc, fresh, new_capacity);
+            throw;
+        }
+        ++slots;
+    }
+    Node& node = nodes[x];
+    node.parent = nil;
+    node.child = nil;
+    node.left = x;
+    node.right = x;
+    node.degree_mark = 0;
+    return x;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void compact_fibonacci_heap<T, Compare, Allocator>::destroy_node(index x) {
+    node_traits::destroy(alloc, &nodes[x].key());
+    nodes[x].degree_mark = free_slot;
+    nodes[x].right = free_head;
+    free_head = x;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void compact_fibonacci_heap<T, Compare, Allocator>::relocate(Node *fresh, index new_capacity) {
+    index i = 0;
+    try{
+        for (; i < slots; ++i) {
+            const Node& from = nodes[i];
+            Node& to = fresh[i];
+            to.parent = from.parent;
+            to.child = from.child;
+            to.left = from.left;
+            to.right = from.right;
+            to.degree_mark = from.degree_mark;
+            if(from.degree_mark != free_slot){
+                node_traits::construct(alloc, &to.key(), std::move_if_noexcept(nodes[i].key()));
+            }
+        }
+    }catch(...){
+        for (index j = 0; j < i; ++j) {
+            if(fresh[j].degree_mark != free_slot){
+                node_traits::destroy(alloc, &fresh[j].key());
+            }
+        }
+        throw;
+    }
+    for (index j = 0; j < slots; ++j) {
+        if(nodes[j].degree_mark != free_slot){
+            node_traits::destroy(alloc, &nodes[j].key());
+        }
+    }
+    if(nodes != nullptr){
+        node_traits::deallocate(alloc, nodes, cap);
+    }
+    nodes = fresh;
+    cap = new_capacity;
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename compact_fibonacci_heap<T, Compare, Allocator>::index compact_fibonacci_heap<T, Compare, Allocator>::grown_capacity() const {
+    if(cap == 0){
+        return 16;
+    }
+    return cap > max_size() / 2 ? static_cast<index>(max_size()) : cap * 2;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void compact_fibonacci_heap<T, Compare, Allocator>::copy_from(const compact_fibonacci_heap &h) {
+    assert(slots == 0);
+    if(h.slots > cap){
+        release();
+        nodes = node_traits::allocate(alloc, h.slots);
+        cap = h.slots;
+    }
+    index i = 0;
+    try{
+        for (; i < h.slots; ++i) {
+            nodes[i] = h.nodes[i];
+            if(h.nodes[i].degree_mark != free_slot){
+                node_traits::construct(alloc, &nodes[i].key(), h.nodes[i].key());
+            }
+        }
+    }catch(...){
+        slots = i;
+        clear();
+        throw;
+    }
+    slots = h.slots;
+    free_head = h.free_head;
+    min = h.min;
+    n = h.n;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void compact_fibonacci_heap<T, Compare, Allocator>::release() {
+    clear();
+    if(nodes != nullptr){
+        node_traits::deallocate(alloc, nodes, cap);
+    }
+    nodes = nullptr;
+    cap = 0;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void compact_fibonacci_heap<T, Compare, Allocator>::splice(index a, index b) {
+    index right_a = nodes[a].right;
+    index right_b = nodes[b].right;
+    nodes[a].right = right_b;
+    nodes[b].right = right_a;
+    nodes[right_a].left = b;
+    nodes[right_b].left = a;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void compact_fibonacci_heap<T, Compare, Allocator>::unlink(index x) {
+    Node& node = nodes[x];
+    nodes[node.left].right = node.right;
+    nodes[node.right].left = node.left;
+    node.left = x;
+    node.right = x;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void compact_fibonacci_heap<T, Compare, Allocator>::push_root(index x) {
+    if(empty()){
+        min = x;
+    }else{
+        splice(min, x);
+        if(precedes(x, min)){
+            min = x;
+        }
+    }
+    ++n;
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename compact_fibonacci_heap<T, Compare, Allocator>::index compact_fibonacci_heap<T, Compare, Allocator>::pop_root() {
+    index x = min;
+    index c = nodes[x].child;
+    if(c != nil){
+        index i = c;
+        do{
+            nodes[i].parent = nil;
+            i = nodes[i].right;
+        }while(i != c);
+        splice(x, c);
+        nodes[x].child = nil;
+        nodes[x].degree_mark = 0;
+    }
+    index z = nodes[x].right;
+    unlink(x);
+    --n;
+    if(x == z){
+        min = nil;
+    }else{
+        min = z;
+        consolidate();
+    }
+    return x;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void compact_fibonacci_heap<T, Compare, Allocator>::decreased(index x) {
+    index y = nodes[x].parent;
+    if(y != nil && precedes(x, y)){
+        cut(x,y);
+        cascading_cut(y);
+    }
+    if(precedes(x, min)){
+        min = x;
+    }
+}
+
+template<typename T, typename Compare, typename Allocator>
+void compact_fibonacci_heap<T, Compare, Allocator>::consolidate() {
+    size_type roots = 0;
+    index i = min;
+    do{
+        ++roots;
+        i = nodes[i].right;
+    }while(i != min);
+    std::uint32_t max_degree = 0;
+    index next = min;
+    for (; roots > 0; --roots) {
+        index x = next;
+        next = nodes[x].right;
+        std::uint32_t d = degree(x);
+        while (degree_table[d] != nil){
+            index y = degree_table[d];
+            if(precedes(y, x)){
+                std::swap(x,y);
+            }
+            // y pasa a ser hijo de x y pierde la marca
+            unlink(y);
+            nodes[y].parent = x;
+            nodes[y].degree_mark = d;
+            if(nodes[x].child == nil){
+                nodes[x].child = y;
+            }else{
+                splice(nodes[x].child, y);
+            }
+            ++nodes[x].degree_mark;
+            degree_table[d] = nil;
+            ++d;
+        }
+        degree_table[d] = x;
+        if(d > max_degree){
+            max_degree = d;
+        }
+    }
+    assert(max_degree <= fibonacci_rank_bound(n));
+    min = nil;
+    for (std::uint32_t d = 0; d <= max_degree; ++d) {
+        if(degree_table[d] != nil){
+            if(min == nil || precedes(degree_table[d], min)){
+                min = degree_table[d];
+            }
+            degree_table[d] = nil;
+        }
+    }
+}
+
+template<typename T, typename Compare, typename Allocator>
+void compact_fibonacci_heap<T, Compare, Allocator>::cut(index x, index parent) {
+    Node& p = nodes[parent];
+    --p.degree_mark;
+    if(degree(parent) == 0){
+        p.child = nil;
+    }else if(p.child == x){
+        p.child = nodes[x].right;
+    }
+    unlink(x);
+    splice(min, x);
+    nodes[x].parent = nil;
+    nodes[x].degree_mark &= ~mark_bit;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void compact_fibonacci_heap<T, Compare, Allocator>::cascading_cut(index x) {
+    index z = nodes[x].parent;
+    while (z != nil && (nodes[x].degree_mark & mark_bit)){
+        cut(x,z);
+        x = z;
+        z = nodes[x].parent;
+    }
+    if(z != nil){
+        nodes[x].degree_mark |= mark_bit;
+    }
+}
+
+template<typename T, typename Compare, typename Allocator>
+compact_fibonacci_heap<T, Compare, Allocator>::handle::handle() : i(nil) {}
+
+template<typename T, typename Compare, typename Allocator>
+compact_fibonacci_heap<T, Compare, Allocator>::handle::handle(index i) : i(i) {}
+
+template<typename T, typename Compare, typename Allocator>
+bool compact_fibonacci_heap<T, Compare, Allocator>::handle::operator==(const handle &other) const {
+    return i == other.i;
+}
+
+template<typename T, typename Compare, typename Allocator>
+bool compact_fibonacci_heap<T, Compare, Allocator>::handle::operator!=(const handle &other) const {
+    return i != other.i;
+}
@@ -0,0 +1,17 @@
+#include "concurrent_fibonacci_heap.h"
+#include <thread>
+
+unsigned int concurrent_thread_slot() {
+    static std::atomic<unsigned int> next(0);
+    static thread_local unsigned int slot = next.fetch_add(1, std::memory_order_relaxed);
+    return slot;
+}
+
+size_t concurrent_default_stripes() {
+    size_t threads = std::thread::hardware_concurrency();
+    size_t res = 1;
+    while (res < threads){
+        res <<= 1U;
+    }
+    return res;
+}
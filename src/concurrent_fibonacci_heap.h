@@ -0,0 +1,199 @@
+#ifndef CONCURRENT_FIBONACCI_HEAP_H
+#define CONCURRENT_FIBONACCI_HEAP_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "fibonacci_heap.h"
+
+/**
+ * @brief Número chico y fijo por hilo para elegir buffer en concurrent_fibonacci_heap
+ * A cada hilo se le asigna el siguiente de un contador global la primera vez que llama, así hilos
+ * que arrancan juntos caen en buffers distintos
+ *
+ * @returns el mismo valor en todas las llamadas del mismo hilo
+ *
+ * \complexity{\O(1)}
+ */
+unsigned int concurrent_thread_slot();
+
+/**
+ * @returns cantidad de buffers por defecto: hilos de hardware redondeado a potencia de 2 (al menos 1)
+ *
+ * \complexity{\O(1)}
+ */
+size_t concurrent_default_stripes();
+
+/**
+ * fibonacci_heap que se puede usar desde muchos hilos a la vez, pensado para muchos productores y pocos consumidores.
+ * - Cada hilo inserta en uno de varios buffers (fibonacci_heap con su propio mutex) elegido por concurrent_thread_slot(),
+ *   así los productores casi nunca compiten por el mismo lock
+ * - Antes de leer o sacar el minimo se unen al heap principal los buffers con elementos, cada uno con un join \O(1)
+ * - try_pop, extract_min y pop_k son exactos: ven todo lo insertado antes de que empiecen
+ * - No hay handles: decrease_key y delete_key no tienen sentido con elementos que otro hilo puede sacar
+ * - No se puede copiar ni mover
+ * Asume lo mismo de T, Compare y Allocator que fibonacci_heap, además:
+ * - las copias de Allocator son iguales entre sí (los buffers y el heap principal usan copias del mismo)
+ * - Allocator es thread-safe: los buffers piden y liberan memoria con sus copias desde distintos hilos a la vez.
+ *   pool_allocator no sirve, su node_pool no lo es
+ */
+template < typename T, typename Compare = std::less<T>, typename Allocator = std::allocator<T> >
+class concurrent_fibonacci_heap {
+public:
+    using heap_type = fibonacci_heap<T, Compare, Allocator>;
+    using value_type = T;
+    using size_type = size_t;
+    using value_compare = Compare;
+    using allocator_type = Allocator;
+
+    /**
+     * @brief Construye heap vacio
+     * @param stripes cantidad de buffers de inserción redondeada a potencia de 2, concurrent_default_stripes() si es 0
+     * @param comp comparador a usar
+     * @param alloc allocator a usar
+     *
+     * \complexity{\O(stripes)}
+     */
+    explicit concurrent_fibonacci_heap(size_type stripes = 0, const value_compare& comp = value_compare(), const allocator_type& alloc = allocator_type());
+
+    concurrent_fibonacci_heap(const concurrent_fibonacci_heap&) = delete;
+    concurrent_fibonacci_heap& operator=(const concurrent_fibonacci_heap&) = delete;
+
+    /**
+     * @returns cantidad de buffers de inserción
+     *
+     * \complexity{\O(1)}
+     */
+    size_type stripes() const;
+
+    /**
+     * @returns cantidad de elementos, puede estar desactualizada si otros hilos insertan o sacan a la vez
+     *
+     * \complexity{\O(1)}
+     */
+    size_type size() const;
+
+    /**
+     * @returns true \IFF size() == 0, con la misma salvedad que size()
+     *
+     * \complexity{\O(1)}
+     */
+    bool empty() const;
+
+    /**
+     * @brief Inserción en el buffer del hilo que llama
+     * @param val elemento a insertar
+     *
+     * \complexity{\O(1)} más la espera del lock del buffer
+     */
+    void insert(const value_type& val);
+    void insert(value_type&& val);
+
+    /**
+     * @brief Inserción construyendo el elemento dentro del nodo, en el buffer del hilo que llama
+     * @param args argumentos para el constructor de T
+     *
+     * \complexity{\O(1)} más la construcción de T y la espera del lock del buffer
+     */
+    template < typename... Args >
+    void emplace(Args&&... args);
+
+    /**
+     * @brief Copiar el minimo
+     * @param out donde se copia el minimo si hay
+     *
+     * @returns false \IFF no había elementos
+     *
+     * \complexity{\O(stripes)}
+     */
+    bool try_minimum(value_type& out);
+
+    /**
+     * @brief Remover el minimo moviéndolo a out
+     * @param out donde se mueve el minimo si hay
+     *
+     * @returns false \IFF no había elementos
+     *
+     * \complexity{\O(log(n) amortizado + stripes)}
+     */
+    bool try_pop(value_type& out);
+
+    /**
+     * @brief Remover minimo si hay
+     *
+     * \complexity{\O(log(n) amortizado + stripes)}
+     */
+    void extract_min();
+
+    /**
+     * @brief Remover hasta k minimos en orden con un solo lock, ver fibonacci_heap::pop_k
+     * @param k cantidad máxima de elementos a remover
+     * @param out iterador de salida donde se mueven los elementos
+     *
+     * @returns out avanzado una posición por elemento removido
+     *
+     * \complexity{\O(k log(n) amortizado + stripes)}
+     */
+    template < typename OutputIt >
+    OutputIt pop_k(size_type k, OutputIt out);
+
+    /**
+     * @brief Unir todos los buffers al heap principal
+     * No hace falta llamarlo: los consumidores lo hacen antes de mirar el minimo
+     *
+     * \complexity{\O(stripes)}
+     */
+    void flush();
+
+    /**
+     * @brief Remueve todos los elementos
+     *
+     * \complexity{\O(n)}
+     */
+    void clear();
+
+private:
+
+    /**
+     * Buffer de inserción. El relleno separa buffers vecinos en líneas de cache distintas,
+     * así dos productores no se invalidan la línea del mutex
+     */
+    struct stripe {
+        explicit stripe(const value_compare& comp, const allocator_type& alloc);
+
+        std::mutex lock;
+        heap_type heap;
+        std::atomic<bool> dirty;
+        char padding[64];
+    };
+
+    /**
+     * @returns buffer del hilo que llama
+     *
+     * \complexity{\O(1)}
+     */
+    stripe& local_stripe();
+
+    /**
+     * @brief Unir los buffers con elementos al heap principal (merged)
+     * \pre se tiene consumer_lock
+     *
+     * \complexity{\O(stripes)}
+     */
+    void flush_locked();
+
+    /** @{ */
+    std::mutex consumer_lock;
+    heap_type merged;
+    std::atomic<size_type> n;
+    std::vector<std::unique_ptr<stripe> > buffers;
+    size_type mask;
+    /** @} */
+};
+
+#include "concurrent_fibonacci_heap.hpp"
+
+#endif //CONCURRENT_FIBONACCI_HEAP_H
@@ -0,0 +1,137 @@
+#include "concurrent_fibonacci_heap.h"
+
+template<typename T, typename Compare, typename Allocator>
+concurrent_fibonacci_heap<T, Compare, Allocator>::concurrent_fibonacci_heap(size_type stripes, const value_compare &comp, const allocator_type &alloc) : merged(comp, alloc), n(0) {
+    size_type count = 1;
+    while (count < (stripes == 0 ? concurrent_default_stripes() : stripes)){
+        count <<= 1U;
+    }
+    buffers.reserve(count);
+    for (size_type i = 0; i < count; ++i) {
+        buffers.emplace_back(new stripe(comp, alloc));
+    }
+    mask = count - 1;
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename concurrent_fibonacci_heap<T, Compare, Allocator>::size_type concurrent_fibonacci_heap<T, Compare, Allocator>::stripes() const {
+    return buffers.size();
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename concurrent_fibonacci_heap<T, Compare, Allocator>::size_type concurrent_fibonacci_heap<T, Compare, Allocator>::size() const {
+    return n.load(std::memory_order_relaxed);
+}
+
+template<typename T, typename Compare, typename Allocator>
+bool concurrent_fibonacci_heap<T, Compare, Allocator>::empty() const {
+    return size() == 0;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void concurrent_fibonacci_heap<T, Compare, Allocator>::insert(const value_type &val) {
+    emplace(val);
+}
+
+template<typename T, typename Compare, typename Allocator>
+void concurrent_fibonacci_heap<T, Compare, Allocator>::insert(value_type &&val) {
+    emplace(std::move(val));
+}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename... Args>
+void concurrent_fibonacci_heap<T, Compare, Allocator>::emplace(Args &&... args) {
+    stripe& s = local_stripe();
+    {
+        std::lock_guard<std::mutex> guard(s.lock);
+        s.heap.emplace(std::forward<Args>(args)...);
+        // Dentro del lock: un consumidor solo ve el elemento después de tomarlo, así su fetch_sub va después
+        n.fetch_add(1, std::memory_order_relaxed);
+        s.dirty.store(true);
+    }
+}
+
+template<typename T, typename Compare, typename Allocator>
+bool concurrent_fibonacci_heap<T, Compare, Allocator>::try_minimum(value_type &out) {
+    std::lock_guard<std::mutex> guard(consumer_lock);
+    flush_locked();
+    if(merged.empty()){
+        return false;
+    }
+    out = merged.minimum();
+    return true;
+}
+
+template<typename T, typename Compare, typename Allocator>
+bool concurrent_fibonacci_heap<T, Compare, Allocator>::try_pop(value_type &out) {
+    std::lock_guard<std::mutex> guard(consumer_lock);
+    flush_locked();
+    if(merged.empty()){
+        return false;
+    }
+    out = merged.pop_min();
+    n.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void concurrent_fibonacci_heap<T, Compare, Allocator>::extract_min() {
+    std::lock_guard<std::mutex> guard(consumer_lock);
+    flush_locked();
+    if(!merged.empty()){
+        merged.extract_min();
+        n.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename OutputIt>
+OutputIt concurrent_fibonacci_heap<T, Compare, Allocator>::pop_k(size_type k, OutputIt out) {
+    std::lock_guard<std::mutex> guard(consumer_lock);
+    flush_locked();
+    size_type before = merged.size();
+    try{
+        out = merged.pop_k(k, out);
+    }catch(...){
+        n.fetch_sub(before - merged.size(), std::memory_order_relaxed);
+        throw;
+    }
+    n.fetch_sub(before - merged.size(), std::memory_order_relaxed);
+    return out;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void concurrent_fibonacci_heap<T, Compare, Allocator>::flush() {
+    std::lock_guard<std::mutex> guard(consumer_lock);
+    flush_locked();
+}
+
+template<typename T, typename Compare, typename Allocator>
+void concurrent_fibonacci_heap<T, Compare, Allocator>::clear() {
+    std::lock_guard<std::mutex> guard(consumer_lock);
+    flush_locked();
+    size_type removed = merged.size();
+    merged.clear();
+    n.fetch_sub(removed, std::memory_order_relaxed);
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename concurrent_fibonacci_heap<T, Compare, Allocator>::stripe &concurrent_fibonacci_heap<T, Compare, Allocator>::local_stripe() {
+    return *buffers[concurrent_thread_slot() & mask];
+}
+
+template<typename T, typename Compare, typename Allocator>
+void concurrent_fibonacci_heap<T, Compare, Allocator>::flush_locked() {
+    for (size_type i = 0; i < buffers.size(); ++i) {
+        stripe& s = *buffers[i];
+        // Sin lock primero: los buffers vacios no se tocan y no frenan a su productor
+        if(s.dirty.load()){
+            std::lock_guard<std::mutex> guard(s.lock);
+            merged.join(s.heap);
+            s.dirty.store(false);
+        }
+    }
+}
+
+template<typename T, typename Compare, typename Allocator>
+concurrent_fibonacci_heap<T, Compare, Allocator>::stripe::stripe(const value_compare &comp, const allocator_type &alloc) : heap(comp, alloc), dirty(false) {}
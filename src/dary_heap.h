@@ -0,0 +1,504 @@
+#ifndef DARY_HEAP_H
+#define DARY_HEAP_H
+
+#include <cassert>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "utils.h"
+
+/**
+ * Implementación de min_priority_queue<T> sobre heap D-ario implícito con la misma interfaz que fibonacci_heap,
+ * así se puede cambiar de uno a otro con un typedef.
+ * - Los elementos están en un arreglo contiguo en orden de heap: los hijos de i son D i + 1 ... D i + D.
+ *   Subir y bajar un elemento recorre posiciones del mismo arreglo en vez de seguir punteros
+ * - Cada elemento tiene además una celda fija con su posición actual en el arreglo (el mapa de posiciones),
+ *   que se actualiza cada vez que el elemento se mueve. Los handles apuntan a la celda, así siguen valiendo
+ *   cuando el arreglo crece, cuando el heap se mueve y después de join
+ * - D más grande hace el árbol más bajo: insert y decrease_key suben menos niveles y extract_min baja menos
+ *   niveles pero compara D hijos en cada uno
+ * - join mueve los elementos de h al arreglo: \O(m) en vez de \O(1)
+ * - No tiene política de estadísticas
+ * Asume de T:
+ * - tiene constructor y asignación por movimiento (se usan al reacomodar el arreglo)
+ * Asume de Compare y Allocator lo mismo que fibonacci_heap (el allocator se usa con rebind al arreglo y a las celdas)
+ */
+template < typename T, unsigned int D = 4, typename Compare = std::less<T>, typename Allocator = std::allocator<T> >
+class dary_heap : private ebo_holder<Compare> {
+    static_assert(D >= 2, "dary_heap requiere D >= 2");
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using value_compare = Compare;
+    using allocator_type = Allocator;
+
+    static constexpr unsigned int arity = D;
+
+    class handle;
+
+    /**
+     * @brief Construye heap vacio
+     * \complexity{\O(1)}
+     */
+    dary_heap();
+
+    /**
+     * @brief Construye heap vacio que ordena con comp
+     * @param comp comparador a usar
+     * @param alloc allocator a usar
+     *
+     * \complexity{\O(1)}
+     */
+    explicit dary_heap(const value_compare& comp, const allocator_type& alloc = allocator_type());
+
+    /**
+     * @brief Construye heap vacio que pide arreglo y celdas a alloc
+     * @param alloc allocator a usar
+     *
+     * \complexity{\O(1)}
+     */
+    explicit dary_heap(const allocator_type& alloc);
+
+    /**
+     * @brief Construye heap con los elementos de un rango, ver insert_range
+     * @param first inicio del rango
+     * @param last fin del rango
+     * @param comp comparador a usar
+     * @param alloc allocator a usar
+     *
+     * \complexity{\O(n)}
+     */
+    template < typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category >
+    dary_heap(InputIt first, InputIt last, const value_compare& comp = value_compare(), const allocator_type& alloc = allocator_type());
+
+    /**
+     * @brief Destructor
+     * \complexity{\O(n)}
+     */
+    ~dary_heap();
+
+    /**
+     * @brief Constructor por copia, mantiene el orden del arreglo
+     * \complexity{\O(n)}
+     */
+    dary_heap(const dary_heap&);
+
+    /**
+     * @brief Operador de asignacion
+     * \complexity{\O(n)}
+     */
+    dary_heap& operator=(const dary_heap&);
+
+    /**
+     * @brief Constructor por movimiento
+     * \complexity{\O(1)}
+     */
+    dary_heap(dary_heap&&) noexcept;
+
+    /**
+     * @brief Operador de asignacion por movimiento
+     * \complexity{\O(n)}
+     */
+    dary_heap& operator=(dary_heap&&) noexcept;
+
+    /**
+     * @brief Remueve todos los elementos, el arreglo conserva su capacidad
+     *
+     * \complexity{\O(n)}
+     */
+    void clear();
+
+    /**
+     * @brief Intercambia los elementos de 2 heaps
+     * @param h heap a intercambiar
+     * \pre los allocators se propagan en swap o son iguales
+     *
+     * \complexity{\O(1)}
+     */
+    void swap(dary_heap& h);
+
+    /**
+     * @brief Devuelve copia del allocator
+     *
+     * \complexity{\O(1)}
+     */
+    allocator_type get_allocator() const;
+
+    /**
+     * @brief Devuelve copia del comparador
+     *
+     * \complexity{\O(1)}
+     */
+    value_compare value_comp() const;
+
+    /**
+     * @returns true \IFF size() == 0
+     *
+     * \complexity{\O(1)}
+     */
+    bool empty() const;
+
+    /**
+     * @returns cantidad de elementos
+     *
+     * \complexity{\O(1)}
+     */
+    size_type size() const;
+
+    /**
+     * @brief Acceso al minimo elemento
+     * \pre !empty()
+     *
+     * @returns referencia constante al minimo
+     *
+     * \complexity{\O(1)}
+     */
+    const value_type& minimum() const;
+
+    /**
+     * @brief Inserción
+     * @param val elemento a insertar
+     *
+     * @returns handle que apunta al elemento insertado
+     *
+     * \complexity{\O(log_D(n))}, \O(1) en promedio con claves al azar
+     */
+    handle insert(const value_type& val);
+
+    /**
+     * @brief Inserción moviendo el elemento
+     * @param val elemento a insertar, queda en estado válido pero no especificado
+     *
+     * @returns handle que apunta al elemento insertado
+     *
+     * \complexity{\O(log_D(n))}, \O(1) en promedio con claves al azar
+     */
+    handle insert(value_type&& val);
+
+    /**
+     * @brief Inserción construyendo el elemento al final del arreglo
+     * @param args argumentos para el constructor de T
+     *
+     * @returns handle que apunta al elemento insertado
+     *
+     * \complexity{\O(log_D(n))} más la construcción de T
+     */
+    template < typename... Args >
+    handle emplace(Args&&... args);
+
+    /**
+     * @brief Inserción de todos los elementos de un rango
+     * Si el rango es forward el arreglo crece una sola vez y si el allocator tiene reserve(n)
+     * las celdas se piden todas juntas. Si la construcción de un elemento lanza una excepción el heap queda como estaba
+     * @param first inicio del rango
+     * @param last fin del rango
+     *
+     * \complexity{\O(min(n + k, k log_D(n + k)))} con k cantidad de elementos del rango
+     */
+    template < typename InputIt >
+    void insert_range(InputIt first, InputIt last);
+
+    /**
+     * @brief Inserción de todos los elementos de un rango escribiendo sus handles
+     * @param first inicio del rango
+     * @param last fin del rango
+     * @param handles iterador de salida donde se escribe el handle de cada elemento, en el orden del rango
+     *
+     * @returns handles avanzado una posición por elemento insertado
+     *
+     * \complexity{\O(min(n + k, k log_D(n + k)))} con k cantidad de elementos del rango
+     */
+    template < typename InputIt, typename OutputIt >
+    OutputIt insert_range(InputIt first, InputIt last, OutputIt handles);
+
+    /**
+     * @brief Remover minimo
+     * \complexity{\O(D log_D(n))}
+     */
+    void extract_min();
+
+    /**
+     * @brief Remover minimo devolviéndolo
+     * \pre !empty()
+     *
+     * @returns el elemento que era el minimo
+     *
+     * \complexity{\O(D log_D(n))}
+     */
+    value_type pop_min();
+
+    /**
+     * @brief Remover los k minimos escribiéndolos en orden en out
+     * @param k cantidad de elementos a remover (se remueven todos si hay menos)
+     * @param out iterador de salida donde se mueven los elementos
+     *
+     * @returns out avanzado una posición por elemento removido
+     *
+     * \complexity{\O(k D log_D(n))}
+     */
+    template < typename OutputIt >
+    OutputIt pop_k(size_type k, OutputIt out);
+
+    /**
+     * @brief Remover el minimo mientras pred(minimum()) sea verdadero
+     * @param pred predicado sobre const value_type&
+     * @param out iterador de salida donde se mueven los elementos
+     *
+     * @returns out avanzado una posición por elemento removido
+     *
+     * \complexity{\O(k D log_D(n))} con k cantidad de elementos removidos
+     */
+    template < typename Pred, typename OutputIt >
+    OutputIt drain_while(Pred pred, OutputIt out);
+
+    /**
+     * @brief Eliminar elemento
+     * @param x handle que apunta al elemento a eliminar
+     *
+     * \complexity{\O(D log_D(n))}
+     */
+    void delete_key(handle& x);
+
+    /**
+     * @brief Decrementar elemento
+     * @param x handle que apunta al elemento a decrementar
+     * @param val nuevo valor del elemento
+     * \pre value_comp()(\P{val}, *\P{x})
+     * \post *\P{x} == \P{val} \AND el resto de los elementos no cambia
+     *
+     * \complexity{\O(log_D(n))}
+     */
+    void decrease_key(const handle& x, const value_type& val);
+
+    /**
+     * @brief Decrementar elemento moviendo el nuevo valor
+     * @param x handle que apunta al elemento a decrementar
+     * @param val nuevo valor del elemento, queda en estado válido pero no especificado
+     * \pre value_comp()(\P{val}, *\P{x})
+     *
+     * \complexity{\O(log_D(n))}
+     */
+    void decrease_key(const handle& x, value_type&& val);
+
+    /**
+     * @brief Incrementar elemento, nombre de decrease_key para max heaps (Compare = std::greater<T>)
+     * @param x handle que apunta al elemento a incrementar
+     * @param val nuevo valor del elemento
+     * \pre value_comp()(\P{val}, *\P{x})
+     *
+     * \complexity{\O(log_D(n))}
+     */
+    void increase_key(const handle& x, const value_type& val);
+
+    /**
+     * @brief Une 2 heaps quedando todos los elementos en uno solo
+     * Los elementos de h se mueven al arreglo de este heap y sus handles pasan a apuntar acá
+     * @param h heap a unir que queda vacio
+     * \pre h.empty() \LOR get_allocator() == h.get_allocator()
+     *
+     * \complexity{\O(min(n + m, m log_D(n + m)))} con m = h.size()
+     */
+    void join(dary_heap& h);
+
+private:
+
+    using compare_holder = ebo_holder<Compare>;
+
+    struct Entry;
+
+    /**
+     * Celda fija de un elemento: la posición del elemento en el arreglo, como puntero
+     */
+    struct Cell {
+        Entry* slot;
+    };
+
+    /**
+     * Posición del arreglo: el elemento y su celda para poder actualizarla cuando se mueve
+     */
+    struct Entry {
+
+        /**
+         * @brief crear posición para un elemento nuevo
+         * @param cell celda del elemento
+         * @param args argumentos para construir el elemento
+         *
+         * \complexity{\O(1)} más la construcción de T
+         */
+        template < typename... Args >
+        explicit Entry(Cell* cell, Args&&... args);
+
+        /** @{ */
+        value_type key;
+        Cell* cell;
+        /** @} */
+    };
+
+    using entry_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Entry>;
+    using cell_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Cell>;
+    using cell_traits = std::allocator_traits<cell_allocator>;
+
+    /**
+     * @returns true \IFF a va antes que b
+     *
+     * \complexity{\O(cmp(T))}
+     */
+    bool precedes(const value_type& a, const value_type& b) const;
+
+    /**
+     * @brief Agregar un elemento al final del arreglo sin reacomodarlo
+     * Si el arreglo cambió de lugar se actualizan todas las celdas.
+     * Si la construcción lanza una excepción el heap no cambia
+     * @param args argumentos para construir el elemento
+     *
+     * @returns celda del elemento agregado
+     *
+     * \complexity{\O(1)} amortizado más la construcción de T
+     */
+    template < typename... Args >
+    Cell* append(Args&&... args);
+
+    /**
+     * @brief Poner en la posición i el elemento e actualizando su celda
+     *
+     * \complexity{\O(1)} más mover T
+     */
+    void place(size_type i, Entry&& e);
+
+    /**
+     * @brief Subir el elemento de la posición i mientras vaya antes que su padre
+     *
+     * \complexity{\O(log_D(n))}
+     */
+    void sift_up(size_type i);
+
+    /**
+     * @brief Bajar el elemento de la posición i mientras algún hijo vaya antes que él
+     *
+     * \complexity{\O(D log_D(n))}
+     */
+    void sift_down(size_type i);
+
+    /**
+     * @brief Sacar el elemento de la posición i: se reemplaza por el último y se lo sube o baja
+     * La celda del elemento sacado no se libera
+     *
+     * @returns el elemento sacado
+     *
+     * \complexity{\O(D log_D(n))}
+     */
+    Entry remove_at(size_type i);
+
+    /**
+     * @brief Reacomodar los elementos agregados desde la posición first
+     * Con muchos elementos nuevos se rearma todo el heap de abajo hacia arriba (Floyd), si no se sube cada uno
+     *
+     * \complexity{\O(min(n, k log_D(n)))} con k = n - first
+     */
+    void restore_from(size_type first);
+
+    /**
+     * @brief Actualizar las celdas de todos los elementos después de que el arreglo cambió de lugar
+     *
+     * \complexity{\O(n)}
+     */
+    void relink_all();
+
+    /**
+     * @brief Sacar los elementos desde la posición first y liberar sus celdas, sin reacomodar el resto
+     *
+     * \complexity{\O(n - first)}
+     */
+    void truncate(size_type first);
+
+    /**
+     * @brief copiar los elementos de h en el mismo orden
+     * Si el allocator tiene reserve(n) las celdas se piden todas juntas
+     * @param h heap a copiar
+     * \pre empty()
+     *
+     * \complexity{\O(n)}
+     */
+    void clone_from(const dary_heap& h);
+
+    /**
+     * @brief Agregar los elementos de un rango avisando cada celda creada
+     * @param on_insert función a llamar con cada celda agregada, en el orden del rango
+     *
+     * \complexity{\O(min(n + k, k log_D(n + k)))} con k cantidad de elementos del rango
+     */
+    template < typename InputIt, typename F >
+    void append_range(InputIt first, InputIt last, F& on_insert);
+
+    /**
+     * @brief Remover el minimo mientras keep(minimum()) sea verdadero
+     *
+     * \complexity{\O(k D log_D(n))} con k cantidad de elementos removidos
+     */
+    template < typename Keep, typename OutputIt >
+    OutputIt pop_while(Keep keep, OutputIt out);
+
+    /** @{ */
+    cell_allocator alloc;
+    std::vector<Entry, entry_allocator> items;
+    /** @} */
+};
+
+template < typename T, unsigned int D, typename Compare, typename Allocator >
+class dary_heap<T, D, Compare, Allocator>::handle {
+public:
+    using value_type = T;
+    using pointer = const T*;
+    using reference = const T&;
+
+    /**
+     * @returns true \IFF apuntan al mismo elemento
+     *
+     * \complexity{\O(1)}
+     */
+    bool operator==(const handle& other) const;
+
+    /**
+     * @returns false \IFF apuntan al mismo elemento
+     *
+     * \complexity{\O(1)}
+     */
+    bool operator!=(const handle& other) const;
+
+    /**
+     * @brief Desreferencia el puntero
+     * \pre El handle debe estar apuntando a un elemento.
+     *
+     * \complexity{\O(1)}
+     */
+    reference operator*() const;
+
+    /**
+     * @brief Operador flechita
+     * \pre El handle debe estar apuntando a un elemento.
+     *
+     * \complexity{\O(1)}
+     */
+    pointer operator->() const;
+
+private:
+
+    friend class dary_heap;
+
+    /**
+     * @brief Constructor
+     * @param x puntero a la celda que el handle estará ligado
+     */
+    handle(Cell* x);
+
+    /** @{ */
+    Cell* c;
+    /** @} */
+};
+
+#include "dary_heap.hpp"
+
+#endif //DARY_HEAP_H
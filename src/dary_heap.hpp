@@ -0,0 +1,402 @@
+#include "dary_heap.h"
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+dary_heap<T, D, Compare, Allocator>::dary_heap() : compare_holder(), alloc(), items(entry_allocator(alloc)) {}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+dary_heap<T, D, Compare, Allocator>::dary_heap(const value_compare &comp, const allocator_type &alloc) : compare_holder(comp), alloc(alloc), items(entry_allocator(alloc)) {}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+dary_heap<T, D, Compare, Allocator>::dary_heap(const allocator_type &alloc) : compare_holder(), alloc(alloc), items(entry_allocator(alloc)) {}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+template<typename InputIt, typename>
+dary_heap<T, D, Compare, Allocator>::dary_heap(InputIt first, InputIt last, const value_compare &comp, const allocator_type &alloc) : compare_holder(comp), alloc(alloc), items(entry_allocator(alloc)) {
+    insert_range(first, last);
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+dary_heap<T, D, Compare, Allocator>::~dary_heap() {
+    clear();
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+dary_heap<T, D, Compare, Allocator>::dary_heap(const dary_heap &h) : compare_holder(h.compare_holder::get()), alloc(cell_traits::select_on_container_copy_construction(h.alloc)), items(entry_allocator(alloc)) {
+    clone_from(h);
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+dary_heap<T, D, Compare, Allocator> &dary_heap<T, D, Compare, Allocator>::operator=(const dary_heap &h) {
+    if(this != &h){
+        clear();
+        compare_holder::get() = h.compare_holder::get();
+        if(cell_traits::propagate_on_container_copy_assignment::value){
+            alloc = h.alloc;
+        }
+        clone_from(h);
+    }
+    return *this;
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+dary_heap<T, D, Compare, Allocator>::dary_heap(dary_heap &&h) noexcept : compare_holder(h.compare_holder::get()), alloc(h.alloc), items(std::move(h.items)) {
+    // El arreglo cambia de dueño sin moverse, las celdas siguen apuntando bien
+    h.items.clear();
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+dary_heap<T, D, Compare, Allocator> &dary_heap<T, D, Compare, Allocator>::operator=(dary_heap &&h) noexcept {
+    clear();
+    compare_holder::get() = h.compare_holder::get();
+    if(cell_traits::propagate_on_container_move_assignment::value){
+        alloc = h.alloc;
+    }
+    assert(h.empty() || alloc == h.alloc);
+    items = std::move(h.items);
+    h.items.clear();
+    relink_all();
+    return *this;
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+void dary_heap<T, D, Compare, Allocator>::clear() {
+    truncate(0);
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+void dary_heap<T, D, Compare, Allocator>::swap(dary_heap &h) {
+    if(cell_traits::propagate_on_container_swap::value){
+        std::swap(alloc,h.alloc);
+    }
+    assert(alloc == h.alloc);
+    std::swap(compare_holder::get(), h.compare_holder::get());
+    items.swap(h.items);
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+typename dary_heap<T, D, Compare, Allocator>::allocator_type dary_heap<T, D, Compare, Allocator>::get_allocator() const {
+    return allocator_type(alloc);
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+typename dary_heap<T, D, Compare, Allocator>::value_compare dary_heap<T, D, Compare, Allocator>::value_comp() const {
+    return compare_holder::get();
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+bool dary_heap<T, D, Compare, Allocator>::empty() const {
+    return items.empty();
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+typename dary_heap<T, D, Compare, Allocator>::size_type dary_heap<T, D, Compare, Allocator>::size() const {
+    return items.size();
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+const typename dary_heap<T, D, Compare, Allocator>::value_type &dary_heap<T, D, Compare, Allocator>::minimum() const {
+    assert(!empty());
+    return items.front().key;
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+typename dary_heap<T, D, Compare, Allocator>::handle dary_heap<T, D, Compare, Allocator>::insert(const value_type &val) {
+    return emplace(val);
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+typename dary_heap<T, D, Compare, Allocator>::handle dary_heap<T, D, Compare, Allocator>::insert(value_type &&val) {
+    return emplace(std::move(val));
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+template<typename... Args>
+typename dary_heap<T, D, Compare, Allocator>::handle dary_heap<T, D, Compare, Allocator>::emplace(Args &&... args) {
+    Cell* c = append(std::forward<Args>(args)...);
+    sift_up(items.size() - 1);
+    return handle(c);
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+template<typename InputIt>
+void dary_heap<T, D, Compare, Allocator>::insert_range(InputIt first, InputIt last) {
+    auto ignore = [](Cell*){};
+    append_range(first, last, ignore);
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+template<typename InputIt, typename OutputIt>
+OutputIt dary_heap<T, D, Compare, Allocator>::insert_range(InputIt first, InputIt last, OutputIt handles) {
+    auto write_handle = [&handles](Cell* c){
+        *handles = handle(c);
+        ++handles;
+    };
+    append_range(first, last, write_handle);
+    return handles;
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+void dary_heap<T, D, Compare, Allocator>::extract_min() {
+    if(!empty()){
+        Entry e = remove_at(0);
+        cell_traits::deallocate(alloc, e.cell, 1);
+    }
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+typename dary_heap<T, D, Compare, Allocator>::value_type dary_heap<T, D, Compare, Allocator>::pop_min() {
+    assert(!empty());
+    Entry e = remove_at(0);
+    cell_traits::deallocate(alloc, e.cell, 1);
+    return std::move(e.key);
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+template<typename OutputIt>
+OutputIt dary_heap<T, D, Compare, Allocator>::pop_k(size_type k, OutputIt out) {
+    size_type remaining = k;
+    return pop_while([&remaining](const value_type&){ return remaining-- > 0; }, out);
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+template<typename Pred, typename OutputIt>
+OutputIt dary_heap<T, D, Compare, Allocator>::drain_while(Pred pred, OutputIt out) {
+    return pop_while([&pred](const value_type& x){ return static_cast<bool>(pred(x)); }, out);
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+void dary_heap<T, D, Compare, Allocator>::delete_key(handle &x) {
+    Entry e = remove_at(static_cast<size_type>(x.c->slot - items.data()));
+    cell_traits::deallocate(alloc, e.cell, 1);
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+void dary_heap<T, D, Compare, Allocator>::decrease_key(const handle &x, const value_type &val) {
+    assert(precedes(val, x.c->slot->key));
+    x.c->slot->key = val;
+    sift_up(static_cast<size_type>(x.c->slot - items.data()));
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+void dary_heap<T, D, Compare, Allocator>::decrease_key(const handle &x, value_type &&val) {
+    assert(precedes(val, x.c->slot->key));
+    x.c->slot->key = std::move(val);
+    sift_up(static_cast<size_type>(x.c->slot - items.data()));
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+void dary_heap<T, D, Compare, Allocator>::increase_key(const handle &x, const value_type &val) {
+    decrease_key(x, val);
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+void dary_heap<T, D, Compare, Allocator>::join(dary_heap &h) {
+    if(this == &h || h.empty()){
+        return;
+    }
+    assert(alloc == h.alloc);
+    size_type first = items.size();
+    const Entry* before = items.data();
+    items.reserve(first + h.size());
+    if(items.data() != before){
+        relink_all();
+    }
+    for (size_type i = 0; i < h.items.size(); ++i) {
+        items.push_back(std::move(h.items[i]));
+        items.back().cell->slot = &items.back();
+    }
+    h.items.clear();
+    restore_from(first);
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+bool dary_heap<T, D, Compare, Allocator>::precedes(const value_type &a, const value_type &b) const {
+    return compare_holder::get()(a, b);
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+template<typename... Args>
+typename dary_heap<T, D, Compare, Allocator>::Cell *dary_heap<T, D, Compare, Allocator>::append(Args &&... args) {
+    Cell* c = cell_traits::allocate(alloc, 1);
+    const Entry* before = items.data();
+    try{
+        items.emplace_back(c, std::forward<Args>(args)...);
+    }catch(...){
+        cell_traits::deallocate(alloc, c, 1);
+        throw;
+    }
+    if(items.data() != before){
+        relink_all();
+    }else{
+        c->slot = &items.back();
+    }
+    return c;
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+void dary_heap<T, D, Compare, Allocator>::place(size_type i, Entry &&e) {
+    items[i] = std::move(e);
+    items[i].cell->slot = &items[i];
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+void dary_heap<T, D, Compare, Allocator>::sift_up(size_type i) {
+    if(i == 0 || !precedes(items[i].key, items[(i - 1) / D].key)){
+        return;
+    }
+    // Se saca el elemento y se bajan los padres al hueco, así cada nivel es un solo movimiento
+    Entry e = std::move(items[i]);
+    do {
+        size_type parent = (i - 1) / D;
+        place(i, std::move(items[parent]));
+        i = parent;
+    } while (i > 0 && precedes(e.key, items[(i - 1) / D].key));
+    place(i, std::move(e));
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+void dary_heap<T, D, Compare, Allocator>::sift_down(size_type i) {
+    size_type n = items.size();
+    Entry e = std::move(items[i]);
+    while (true) {
+        size_type first = D * i + 1;
+        if(first >= n){
+            break;
+        }
+        size_type last = first + D < n ? first + D : n;
+        size_type best = first;
+        for (size_type child = first + 1; child < last; ++child) {
+            if(precedes(items[child].key, items[best].key)){
+                best = child;
+            }
+        }
+        if(!precedes(items[best].key, e.key)){
+            break;
+        }
+        place(i, std::move(items[best]));
+        i = best;
+    }
+    place(i, std::move(e));
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+typename dary_heap<T, D, Compare, Allocator>::Entry dary_heap<T, D, Compare, Allocator>::remove_at(size_type i) {
+    Entry res = std::move(items[i]);
+    size_type last = items.size() - 1;
+    if(i != last){
+        place(i, std::move(items[last]));
+        items.pop_back();
+        if(i > 0 && precedes(items[i].key, items[(i - 1) / D].key)){
+            sift_up(i);
+        }else{
+            sift_down(i);
+        }
+    }else{
+        items.pop_back();
+    }
+    return res;
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+void dary_heap<T, D, Compare, Allocator>::restore_from(size_type first) {
+    size_type n = items.size();
+    if(n - first < first){
+        for (size_type i = first; i < n; ++i) {
+            sift_up(i);
+        }
+    }else if(n > 1){
+        for (size_type i = (n - 2) / D + 1; i > 0; --i) {
+            sift_down(i - 1);
+        }
+    }
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+void dary_heap<T, D, Compare, Allocator>::relink_all() {
+    for (size_type i = 0; i < items.size(); ++i) {
+        items[i].cell->slot = &items[i];
+    }
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+void dary_heap<T, D, Compare, Allocator>::truncate(size_type first) {
+    while (items.size() > first) {
+        cell_traits::deallocate(alloc, items.back().cell, 1);
+        items.pop_back();
+    }
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+void dary_heap<T, D, Compare, Allocator>::clone_from(const dary_heap &h) {
+    items.reserve(h.size());
+    allocator_reserve(alloc, h.size());
+    try{
+        for (size_type i = 0; i < h.items.size(); ++i) {
+            append(h.items[i].key);
+        }
+    }catch(...){
+        clear();
+        throw;
+    }
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+template<typename InputIt, typename F>
+void dary_heap<T, D, Compare, Allocator>::append_range(InputIt first, InputIt last, F &on_insert) {
+    size_type k = range_size_hint(first, last);
+    size_type start = items.size();
+    if(k > 0){
+        const Entry* before = items.data();
+        items.reserve(start + k);
+        if(items.data() != before){
+            relink_all();
+        }
+        allocator_reserve(alloc, k);
+    }
+    try{
+        for (; first != last; ++first) {
+            on_insert(append(*first));
+        }
+    }catch(...){
+        truncate(start);
+        throw;
+    }
+    restore_from(start);
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+template<typename Keep, typename OutputIt>
+OutputIt dary_heap<T, D, Compare, Allocator>::pop_while(Keep keep, OutputIt out) {
+    while (!empty() && keep(static_cast<const value_type&>(items.front().key))) {
+        *out = pop_min();
+        ++out;
+    }
+    return out;
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+template<typename... Args>
+dary_heap<T, D, Compare, Allocator>::Entry::Entry(Cell *cell, Args &&... args) : key(std::forward<Args>(args)...), cell(cell) {}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+bool dary_heap<T, D, Compare, Allocator>::handle::operator==(const handle &other) const {
+    return c == other.c;
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+bool dary_heap<T, D, Compare, Allocator>::handle::operator!=(const handle &other) const {
+    return c != other.c;
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+typename dary_heap<T, D, Compare, Allocator>::handle::reference dary_heap<T, D, Compare, Allocator>::handle::operator*() const {
+    return c->slot->key;
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+typename dary_heap<T, D, Compare, Allocator>::handle::pointer dary_heap<T, D, Compare, Allocator>::handle::operator->() const {
+    return &c->slot->key;
+}
+
+template<typename T, unsigned int D, typename Compare, typename Allocator>
+dary_heap<T, D, Compare, Allocator>::handle::handle(Cell *x) : c(x) {}
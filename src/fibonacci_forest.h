@@ -0,0 +1,325 @@
+#ifndef FIBONACCI_FOREST_H
+#define FIBONACCI_FOREST_H
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <utility>
+#include "fibonacci_stats.h"
+#include "utils.h"
+
+/**
+ * Enlaces de un nodo de fibonacci heap.
+ * Node debe heredar de fibonacci_links<Node> (CRTP), así los algoritmos de fibonacci_forest
+ * sirven para cualquier nodo sin importar qué guarde además de los enlaces:
+ * - Apunta al padre (null si no tiene)
+ * - Apunta a la lista de hijos
+ * - Las listas son doblemente enlazadas
+ * - Se tiene la cantidad de hijos
+ * - Se marca si pierde un hijo desde que el nodo se hizo hijo de otro nodo
+ */
+template < typename Node >
+struct fibonacci_links {
+
+    /**
+     * @brief crear enlaces de un nodo que representa heap de un elemento
+     *
+     * \complexity{\O(1)}
+     */
+    fibonacci_links();
+
+    /**
+     * @brief unir listas
+     * @param n puntero a nodo a unir
+     *
+     * \complexity{\O(1)}
+     */
+    void join(Node* n);
+
+    /**
+     * @brief Sacar nodo de la lista enlazada en la que esta sin romperla y unirse a si mismo
+     *
+     * \complexity{\O(1)}
+     */
+    void remove();
+
+    /**
+     * @brief Sacar padre de una lista enlazada
+     *
+     * \complexity{\O(log(n))}
+     */
+    void remove_parent();
+
+    /**
+     * @brief Agrega hijo al nodo
+     * @param n nodo a agregar que es removido de la lista enlazada en la que está
+     *
+     * \complexity{\O(1)}
+     */
+    void add_child(Node* n);
+
+    /**
+     * @brief Dejar los enlaces como los de un nodo recién creado
+     * Para volver a usar un nodo que el bosque ya soltó (pop, erase o clear no limpian padre, hijos, grado ni marca)
+     *
+     * \complexity{\O(1)}
+     */
+    void reset();
+
+    /** @{ */
+    Node* parent;
+    Node* child;
+    Node* left;
+    Node* right;
+    unsigned int degree;
+    bool mark;
+    /** @} */
+
+private:
+
+    /**
+     * @returns puntero al nodo que contiene estos enlaces
+     *
+     * \complexity{\O(1)}
+     */
+    Node* self();
+};
+
+/**
+ * Bosque de árboles heap-ordenados con los algoritmos de fibonacci heap (Cormen et al.).
+ * No pide ni libera memoria: los nodos los crea y destruye quien lo usa, que también decide qué guardan.
+ * Asume de Node:
+ * - hereda de fibonacci_links<Node>
+ * Asume de NodeCompare:
+ * - NodeCompare()(a, b) con a, b de tipo const Node* define una relación de orden débil
+ * - si es una clase vacía no ocupa lugar en el bosque
+ * Asume de Stats:
+ * - tiene los métodos de no_stats, que se llaman en cada link, corte, consolidación, comparación, etc.
+ * - con no_stats (por defecto) no ocupa lugar ni agrega código, con fibonacci_stats cuenta todo
+ */
+template < typename Node, typename NodeCompare, typename Stats = no_stats >
+class fibonacci_forest : private ebo_holder<NodeCompare>, private ebo_holder<Stats, 1> {
+public:
+    using size_type = size_t;
+
+    /**
+     * @brief Construye bosque vacio
+     * \complexity{\O(1)}
+     */
+    fibonacci_forest();
+
+    /**
+     * @brief Construye bosque vacio que ordena con comp
+     * @param comp comparador de nodos
+     *
+     * \complexity{\O(1)}
+     */
+    explicit fibonacci_forest(const NodeCompare& comp);
+
+    fibonacci_forest(const fibonacci_forest&) = delete;
+    fibonacci_forest& operator=(const fibonacci_forest&) = delete;
+
+    /**
+     * @brief Constructor por movimiento, f queda vacio y con las estadísticas en 0
+     * \complexity{\O(1)}
+     */
+    fibonacci_forest(fibonacci_forest&& f) noexcept;
+
+    /**
+     * @brief Intercambia los nodos, comparadores y estadísticas de 2 bosques
+     * @param f bosque a intercambiar
+     *
+     * \complexity{\O(1)}
+     */
+    void swap(fibonacci_forest& f);
+
+    /**
+     * @returns true \IFF size() == 0
+     *
+     * \complexity{\O(1)}
+     */
+    bool empty() const;
+
+    /**
+     * @returns cantidad de nodos
+     *
+     * \complexity{\O(1)}
+     */
+    size_type size() const;
+
+    /**
+     * @returns nodo minimo (nullptr si está vacio)
+     *
+     * \complexity{\O(1)}
+     */
+    Node* top() const;
+
+    /**
+     * @returns referencia al comparador de nodos
+     *
+     * \complexity{\O(1)}
+     */
+    NodeCompare& node_comp();
+    const NodeCompare& node_comp() const;
+
+    /**
+     * @returns referencia a las estadísticas del bosque
+     * Van con los nodos que describen: se mueven (el bosque movido vuelve a 0) e intercambian con ellos
+     *
+     * \complexity{\O(1)}
+     */
+    Stats& stats();
+    const Stats& stats() const;
+
+    /**
+     * @brief Poner un nodo nuevo en la lista de raíces
+     * @param x nodo a agregar
+     * \pre x no tiene padre, hijos ni hermanos
+     *
+     * \complexity{\O(1)}
+     */
+    void push(Node* x);
+
+    /**
+     * @brief Sacar el minimo del bosque sin destruirlo
+     * Sus hijos pasan a la lista de raíces y se consolida
+     * \pre !empty()
+     *
+     * @returns el nodo que era el minimo
+     *
+     * \complexity{\O(log(n) amortizado)}
+     */
+    Node* pop();
+
+    /**
+     * @brief Sacar minimos uno tras otro mientras keep lo acepte, consolidando una sola vez al final
+     * Se recorre el bosque de mejor a peor con frontier como heap binario de los candidatos
+     * (las raíces y los hijos de los nodos ya sacados), así los nodos salen en el mismo orden que con pop()
+     * @param frontier vector de Node* que se usa como memoria auxiliar, se puede reusar entre llamadas
+     * @param keep función que recibe el minimo actual y devuelve si se lo saca, se llama una vez por nodo sacado y una más con el primero que queda
+     * @param take función que recibe cada nodo sacado, ya sin usar sus enlaces, y se encarga de destruirlo
+     * (también si lanza una excepción)
+     * Si keep o take lanzan una excepción los nodos sacados hasta ese momento quedan afuera y el bosque es válido
+     *
+     * @returns cantidad de nodos sacados
+     *
+     * \complexity{\O((r + k) log(r + k) + log(n))} amortizado, con r cantidad de raíces y k cantidad de nodos sacados
+     */
+    template < typename Frontier, typename Keep, typename Take >
+    size_type pop_while(Frontier& frontier, Keep keep, Take take);
+
+    /**
+     * @brief Reubicar un nodo cuya clave acaba de decrementarse
+     * @param x nodo decrementado
+     *
+     * \complexity{\O(1) amortizado}
+     */
+    void decreased(Node* x);
+
+    /**
+     * @brief Sacar un nodo cualquiera del bosque sin destruirlo
+     * @param x nodo a sacar
+     *
+     * \complexity{\O(log(n) amortizado)}
+     */
+    void erase(Node* x);
+
+    /**
+     * @brief Une 2 bosques quedando todos los nodos en este
+     * @param f bosque a unir que queda vacio
+     *
+     * \complexity{\O(1)}
+     */
+    void merge(fibonacci_forest& f);
+
+    /**
+     * @brief Vaciar el bosque entregando cada nodo a dispose
+     * @param dispose función que se llama una vez con cada nodo, ya sin usar sus enlaces
+     * Sin recursión: los hijos de cada nodo se empalman en la lista que se está recorriendo,
+     * así la profundidad de los árboles no importa y la memoria extra es \O(1)
+     *
+     * \complexity{\O(n)}
+     */
+    template < typename F >
+    void clear(F dispose);
+
+    /**
+     * @brief Copiar la forma de f (grados, marcas, listas de hijos y minimo) en una sola pasada
+     * @param f bosque a copiar
+     * @param make_node función que recibe un nodo de f y devuelve un nodo nuevo sin enlaces con la misma clave
+     * @param dispose función para destruir los nodos creados si make_node lanza una excepción
+     * Recorre f en preorden subiendo por los punteros a padre, sin recursión y con memoria extra \O(1).
+     * Cada copia se enlaza antes de copiar sus hijos, así ante una excepción lo creado es un bosque válido
+     * \pre empty()
+     *
+     * \complexity{\O(n)} llamadas a make_node
+     */
+    template < typename F, typename D >
+    void clone(const fibonacci_forest& f, F make_node, D dispose);
+
+private:
+
+    using compare_holder = ebo_holder<NodeCompare>;
+    using stats_holder = ebo_holder<Stats, 1>;
+
+    /**
+     * @returns true \IFF a va antes que b según el comparador
+     *
+     * \complexity{\O(cmp)}
+     */
+    bool precedes(const Node* a, const Node* b);
+
+    /**
+     * @brief Dejar a la lista de raíces sin raíces con misma cantidad de hijos
+     * Recorre la lista de raíces en el lugar y usa degree_table, sin pedir memoria
+     *
+     * \complexity{\O(log(n) amortizado)}
+     */
+    void consolidate();
+
+    /**
+     * @brief Poner nodo en la lista de raíces
+     * @param x Nodo a mover
+     * @param parent Padre del nodo a mover
+     *
+     * \complexity{\O(1)}
+     */
+    void cut(Node* x,Node* parent);
+
+    /**
+     * @brief Mantener estructura para que no haya nodos que hayan perdido más de 1 nodo
+     * @param x Nodo que acaba de perder un hijo
+     *
+     * \complexity{\O(c)} con c cantidad de cortes
+     *
+     */
+    void cascading_cut(Node* x);
+
+    /**
+     * @brief Rearmar la lista de raíces con los nodos de frontier y consolidar
+     * @param frontier heap binario (según precedes) con las raíces de lo que queda del bosque
+     *
+     * \complexity{\O(r + log(n))} amortizado, con r tamaño de frontier
+     */
+    template < typename Frontier >
+    void relink_roots(Frontier& frontier);
+
+    /**
+     * Cantidad de grados posibles para todo n representable en size_type, ver fibonacci_rank_bound
+     */
+    static const unsigned int max_rank = fibonacci_rank_bound(std::numeric_limits<size_type>::max()) + 1;
+
+    /** @{ */
+    Node* min;
+    size_type n;
+    /**
+     * Tabla de raíces por grado que usa consolidate().
+     * Fuera de consolidate() todas sus posiciones son nullptr
+     */
+    Node* degree_table[max_rank];
+    /** @} */
+};
+
+#include "fibonacci_forest.hpp"
+
+#endif //FIBONACCI_FOREST_H
@@ -0,0 +1,386 @@
+#include "fibonacci_forest.h"
+
+template<typename Node>
+fibonacci_links<Node>::fibonacci_links() : parent(nullptr), child(nullptr), left(self()), right(self()), degree(0), mark(false) {}
+
+template<typename Node>
+void fibonacci_links<Node>::join(Node *n) {
+    Node* right_node = right;
+    Node* right_node_other = n->right;
+    std::swap(right,n->right);
+    std::swap(right_node->left,right_node_other->left);
+}
+
+template<typename Node>
+void fibonacci_links<Node>::remove() {
+    left->right = right;
+    right->left = left;
+    left = self();
+    right = self();
+}
+
+template<typename Node>
+void fibonacci_links<Node>::remove_parent() {
+    Node* i = self();
+    do{
+        i->parent = nullptr;
+        i = i->right;
+    }while(i != self());
+}
+
+template<typename Node>
+void fibonacci_links<Node>::add_child(Node *n) {
+    n->remove();
+    n->parent = self();
+    if(child == nullptr){
+        child = n;
+    }else{
+        child->join(n);
+    }
+    ++degree;
+    n->mark = false;
+}
+
+template<typename Node>
+void fibonacci_links<Node>::reset() {
+    parent = nullptr;
+    child = nullptr;
+    left = self();
+    right = self();
+    degree = 0;
+    mark = false;
+}
+
+template<typename Node>
+Node *fibonacci_links<Node>::self() {
+    return static_cast<Node*>(this);
+}
+
+template<typename Node, typename NodeCompare, typename Stats>
+fibonacci_forest<Node, NodeCompare, Stats>::fibonacci_forest() : min(nullptr), n(0), degree_table() {}
+
+template<typename Node, typename NodeCompare, typename Stats>
+fibonacci_forest<Node, NodeCompare, Stats>::fibonacci_forest(const NodeCompare &comp) : compare_holder(comp), min(nullptr), n(0), degree_table() {}
+
+template<typename Node, typename NodeCompare, typename Stats>
+fibonacci_forest<Node, NodeCompare, Stats>::fibonacci_forest(fibonacci_forest &&f) noexcept : compare_holder(f), stats_holder(f), min(f.min), n(f.n), degree_table() {
+    f.min = nullptr;
+    f.n = 0;
+    f.stats_holder::get().reset();
+}
+
+template<typename Node, typename NodeCompare, typename Stats>
+void fibonacci_forest<Node, NodeCompare, Stats>::swap(fibonacci_forest &f) {
+    std::swap(compare_holder::get(),f.compare_holder::get());
+    std::swap(stats_holder::get(),f.stats_holder::get());
+    std::swap(min,f.min);
+    std::swap(n,f.n);
+}
+
+template<typename Node, typename NodeCompare, typename Stats>
+bool fibonacci_forest<Node, NodeCompare, Stats>::empty() const {
+    return min == nullptr;
+}
+
+template<typename Node, typename NodeCompare, typename Stats>
+typename fibonacci_forest<Node, NodeCompare, Stats>::size_type fibonacci_forest<Node, NodeCompare, Stats>::size() const {
+    return n;
+}
+
+template<typename Node, typename NodeCompare, typename Stats>
+Node *fibonacci_forest<Node, NodeCompare, Stats>::top() const {
+    return min;
+}
+
+template<typename Node, typename NodeCompare, typename Stats>
+NodeCompare &fibonacci_forest<Node, NodeCompare, Stats>::node_comp() {
+    return compare_holder::get();
+}
+
+template<typename Node, typename NodeCompare, typename Stats>
+const NodeCompare &fibonacci_forest<Node, NodeCompare, Stats>::node_comp() const {
+    return compare_holder::get();
+}
+
+template<typename Node, typename NodeCompare, typename Stats>
+Stats &fibonacci_forest<Node, NodeCompare, Stats>::stats() {
+    return stats_holder::get();
+}
+
+template<typename Node, typename NodeCompare, typename Stats>
+const Stats &fibonacci_forest<Node, NodeCompare, Stats>::stats() const {
+    return stats_holder::get();
+}
+
+template<typename Node, typename NodeCompare, typename Stats>
+void fibonacci_forest<Node, NodeCompare, Stats>::push(Node *x) {
+    if(empty()){
+        min = x;
+    }else{
+        min->join(x);
+        if(precedes(x, min)){
+            min = x;
+        }
+    }
+    ++n;
+}
+
+template<typename Node, typename NodeCompare, typename Stats>
+Node *fibonacci_forest<Node, NodeCompare, Stats>::pop() {
+    Node* x = min;
+    if(x->degree > 0){
+        x->child->remove_parent();
+        x->join(x->child);
+    }
+    Node* z = x->right;
+    x->remove();
+    --n;
+    if(x == z){
+        min = nullptr;
+    }else{
+        min = z;
+        consolidate();
+    }
+    return x;
+}
+
+template<typename Node, typename NodeCompare, typename Stats>
+template<typename Frontier, typename Keep, typename Take>
+typename fibonacci_forest<Node, NodeCompare, Stats>::size_type fibonacci_forest<Node, NodeCompare, Stats>::pop_while(Frontier &frontier, Keep keep, Take take) {
+    if(empty() || !keep(min)){
+        return 0;
+    }
+    auto later = [this](const Node* a, const Node* b){ return precedes(b, a); };
+    frontier.clear();
+    Node* i = min;
+    do{
+        frontier.push_back(i);
+        i = i->right;
+    }while(i != min);
+    std::make_heap(frontier.begin(), frontier.end(), later);
+    size_type taken = 0;
+    try{
+        do{
+            frontier.reserve(frontier.size() + frontier.front()->degree);
+            std::pop_heap(frontier.begin(), frontier.end(), later);
+            Node* x = frontier.back();
+            frontier.pop_back();
+            Node* c = x->child;
+            for (unsigned int d = 0; d < x->degree; ++d) {
+                frontier.push_back(c);
+                std::push_heap(frontier.begin(), frontier.end(), later);
+                c = c->right;
+            }
+            --n;
+            ++taken;
+            take(x);
+        }while (!frontier.empty() && keep(frontier.front()));
+    }catch(...){
+        relink_roots(frontier);
+        throw;
+    }
+    relink_roots(frontier);
+    return taken;
+}
+
+template<typename Node, typename NodeCompare, typename Stats>
+void fibonacci_forest<Node, NodeCompare, Stats>::decreased(Node *x) {
+    Node* y = x->parent;
+    if(y != nullptr && precedes(x, y)){
+        cut(x,y);
+        cascading_cut(y);
+    }
+    if(precedes(x, min)){
+        min = x;
+    }
+}
+
+template<typename Node, typename NodeCompare, typename Stats>
+void fibonacci_forest<Node, NodeCompare, Stats>::erase(Node *x) {
+    Node* parent = x->parent;
+    if(parent != nullptr){
+        cut(x,parent);
+        cascading_cut(parent);
+    }
+    min = x;
+    pop();
+}
+
+template<typename Node, typename NodeCompare, typename Stats>
+void fibonacci_forest<Node, NodeCompare, Stats>::merge(fibonacci_forest &f) {
+    if(empty()){
+        min = f.min;
+    }else if(!f.empty()){
+        min->join(f.min);
+        if(precedes(f.min, min)) {
+            min = f.min;
+        }
+    }
+    n += f.n;
+    f.min = nullptr;
+    f.n = 0;
+}
+
+template<typename Node, typename NodeCompare, typename Stats>
+template<typename F>
+void fibonacci_forest<Node, NodeCompare, Stats>::clear(F dispose) {
+    if(empty()){
+        return;
+    }
+    min->left->right = nullptr;
+    Node* x = min;
+    while (x != nullptr){
+        if(x->child != nullptr){
+            Node* last_child = x->child->left;
+            last_child->right = x->right;
+            x->right = x->child;
+        }
+        Node* next = x->right;
+        dispose(x);
+        x = next;
+    }
+    min = nullptr;
+    n = 0;
+}
+
+template<typename Node, typename NodeCompare, typename Stats>
+template<typename F, typename D>
+void fibonacci_forest<Node, NodeCompare, Stats>::clone(const fibonacci_forest &f, F make_node, D dispose) {
+    assert(empty());
+    if(f.empty()){
+        return;
+    }
+    try{
+        const Node* i = f.min;
+        Node* parent = nullptr;
+        while (i != nullptr){
+            Node* c = make_node(i);
+            c->parent = parent;
+            c->degree = i->degree;
+            c->mark = i->mark;
+            Node*& first = parent == nullptr ? min : parent->child;
+            if(first == nullptr){
+                first = c;
+            }else{
+                first->left->join(c);
+            }
+            if(i->child != nullptr){
+                i = i->child;
+                parent = c;
+            }else{
+                while (i != nullptr && i->right == (i->parent == nullptr ? f.min : i->parent->child)){
+                    i = i->parent;
+                    parent = parent == nullptr ? nullptr : parent->parent;
+                }
+                if(i != nullptr){
+                    i = i->right;
+                }
+            }
+        }
+    }catch(...){
+        clear(dispose);
+        throw;
+    }
+    n = f.n;
+}
+
+template<typename Node, typename NodeCompare, typename Stats>
+bool fibonacci_forest<Node, NodeCompare, Stats>::precedes(const Node *a, const Node *b) {
+    stats_holder::get().on_compare();
+    return compare_holder::get()(a, b);
+}
+
+template<typename Node, typename NodeCompare, typename Stats>
+void fibonacci_forest<Node, NodeCompare, Stats>::consolidate() {
+    size_type roots = 0;
+    Node* i = min;
+    do{
+        ++roots;
+        i = i->right;
+    }while(i != min);
+    size_type walked_roots = roots;
+    unsigned int max_degree = 0;
+    Node* next = min;
+    for (; roots > 0; --roots) {
+        Node* x = next;
+        next = x->right;
+        unsigned int d = x->degree;
+        while (degree_table[d] != nullptr){
+            Node* y = degree_table[d];
+            if(precedes(y, x)){
+                std::swap(x,y);
+            }
+            x->add_child(y);
+            stats_holder::get().on_link();
+            degree_table[d] = nullptr;
+            ++d;
+        }
+        degree_table[d] = x;
+        if(d > max_degree){
+            max_degree = d;
+        }
+    }
+    assert(max_degree <= fibonacci_rank_bound(n));
+    stats_holder::get().on_consolidate(walked_roots, max_degree);
+    min = nullptr;
+    for (unsigned int d = 0; d <= max_degree; ++d) {
+        if(degree_table[d] != nullptr){
+            if(min == nullptr || precedes(degree_table[d], min)){
+                min = degree_table[d];
+            }
+            degree_table[d] = nullptr;
+        }
+    }
+}
+
+template<typename Node, typename NodeCompare, typename Stats>
+template<typename Frontier>
+void fibonacci_forest<Node, NodeCompare, Stats>::relink_roots(Frontier &frontier) {
+    if(frontier.empty()){
+        min = nullptr;
+        return;
+    }
+    min = frontier.front();
+    for (size_type i = 0; i < frontier.size(); ++i) {
+        Node* x = frontier[i];
+        x->parent = nullptr;
+        x->left = x;
+        x->right = x;
+        x->mark = false;
+        if(x != min){
+            min->join(x);
+        }
+    }
+    frontier.clear();
+    consolidate();
+}
+
+template<typename Node, typename NodeCompare, typename Stats>
+void fibonacci_forest<Node, NodeCompare, Stats>::cut(Node *x, Node *parent) {
+    if(--parent->degree && x == parent->child){
+        parent->child = x->right;
+    }else if(!parent->degree){
+        parent->child = nullptr;
+    }
+    x->remove();
+    min->join(x);
+    x->parent = nullptr;
+    x->mark = false;
+    stats_holder::get().on_cut();
+}
+
+template<typename Node, typename NodeCompare, typename Stats>
+void fibonacci_forest<Node, NodeCompare, Stats>::cascading_cut(Node *x) {
+    Node* z = x->parent;
+    unsigned int depth = 0;
+    while (z != nullptr && x->mark){
+        cut(x,z);
+        ++depth;
+        x = z;
+        z = x->parent;
+    }
+    if(z != nullptr){
+        x->mark = true;
+    }
+    stats_holder::get().on_cascade(depth);
+}
@@ -3,22 +3,37 @@
 
 #include <iostream>
 #include <cassert>
+#include <functional>
+#include <iterator>
+#include <memory>
 #include <utility>
 #include <vector>
+#include "fibonacci_forest.h"
 #include "utils.h"
 
 /**
  * Implementación de min_priority_queue<T> sobre min_fibonacci_heap.
  * Asume de T:
  * - tiene constructor por copia (con complejidad copy(T))
- * - tiene operador < (con complejidad cmp(T)) que define una relación de orden débil
  * - se asume que copy(T), cmp(T), delete(T) tienen complejidad \O(1) para facilitar análisis de complejidad pero no hay problema con que cuesten más
+ * Asume de Compare:
+ * - Compare()(a, b) (con complejidad cmp(T)) define una relación de orden débil, por defecto operador < de T
+ * - el "mínimo" es el primero según Compare, con std::greater<T> se obtiene un max heap
+ * - si es una clase vacía no ocupa lugar en el heap
+ * Asume de Allocator:
+ * - cumple los requisitos de allocator de la biblioteca estándar (se usa con rebind a Node)
+ * - ver pool_allocator para reciclar la memoria de los nodos
+ * Asume de Stats:
+ * - es no_stats (por defecto, no cuesta nada) o fibonacci_stats u otra política con los mismos métodos,
+ *   ver stats()
  */
-template < typename T >
+template < typename T, typename Compare = std::less<T>, typename Allocator = std::allocator<T>, typename Stats = no_stats >
 class fibonacci_heap {
 public:
     using value_type = T;
     using size_type = size_t;
+    using value_compare = Compare;
+    using allocator_type = Allocator;
 
     class handle;
 
@@ -28,6 +43,35 @@ public:
      */
     fibonacci_heap();
 
+    /**
+     * @brief Construye heap vacio que ordena con comp
+     * @param comp comparador a usar
+     * @param alloc allocator a usar
+     *
+     * \complexity{\O(1)}
+     */
+    explicit fibonacci_heap(const value_compare& comp, const allocator_type& alloc = allocator_type());
+
+    /**
+     * @brief Construye heap vacio que pide los nodos a alloc
+     * @param alloc allocator a usar
+     *
+     * \complexity{\O(1)}
+     */
+    explicit fibonacci_heap(const allocator_type& alloc);
+
+    /**
+     * @brief Construye heap con los elementos de un rango, ver insert_range
+     * @param first inicio del rango
+     * @param last fin del rango
+     * @param comp comparador a usar
+     * @param alloc allocator a usar
+     *
+     * \complexity{\O(n)}
+     */
+    template < typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category >
+    fibonacci_heap(InputIt first, InputIt last, const value_compare& comp = value_compare(), const allocator_type& alloc = allocator_type());
+
     /**
      * @brief Destructor
      * \complexity{\O(n)}
@@ -77,11 +121,44 @@ public:
     /**
      * @brief Intercambia los elementos de 2 heaps
      * @param h heap a intercambiar
+     * \pre los allocators se propagan en swap o son iguales
      *
      * \complexity{\O(1)}
      */
     void swap (fibonacci_heap& h);
 
+    /**
+     * @brief Devuelve copia del allocator
+     *
+     * \complexity{\O(1)}
+     */
+    allocator_type get_allocator() const;
+
+    /**
+     * @brief Devuelve copia del comparador
+     *
+     * \complexity{\O(1)}
+     */
+    value_compare value_comp() const;
+
+    /**
+     * @brief Estadísticas de las operaciones hechas sobre este heap (links, cortes, raíces consolidadas,
+     * grado maximo, comparaciones y nodos pedidos), ver fibonacci_stats
+     * Se mueven e intercambian junto con los elementos; una copia empieza en 0 y join no las suma
+     *
+     * @returns referencia constante a las estadísticas
+     *
+     * \complexity{\O(1)}
+     */
+    const Stats& stats() const;
+
+    /**
+     * @brief Volver las estadísticas a 0
+     *
+     * \complexity{\O(1)}
+     */
+    void reset_stats();
+
     /**
      * @brief Indica si el heap esta vacio
      *
@@ -121,6 +198,58 @@ public:
      */
     handle insert(const value_type& val);
 
+    /**
+     * @brief Inserción moviendo el elemento
+     *
+     * @param val elemento a insertar, queda en estado válido pero no especificado
+     *
+     * @returns handle que apunta al elemento insertado
+     *
+     * \complexity{\O(1)}
+     *
+     */
+    handle insert(value_type&& val);
+
+    /**
+     * @brief Inserción construyendo el elemento dentro del nodo
+     *
+     * @param args argumentos para el constructor de T
+     *
+     * @returns handle que apunta al elemento insertado
+     *
+     * \complexity{\O(1)} más la construcción de T
+     *
+     */
+    template < typename... Args >
+    handle emplace(Args&&... args);
+
+    /**
+     * @brief Inserción de todos los elementos de un rango
+     * Los nodos se enlazan en una lista aparte que se une a la lista de raíces de una sola vez,
+     * así el minimo se actualiza una vez. Si el rango es forward y el allocator tiene reserve(n)
+     * (como pool_allocator) los nodos se piden todos juntos.
+     * Si la construcción de un elemento lanza una excepción el heap queda como estaba
+     * @param first inicio del rango
+     * @param last fin del rango
+     *
+     * \complexity{\O(k)} con k cantidad de elementos del rango
+     */
+    template < typename InputIt >
+    void insert_range(InputIt first, InputIt last);
+
+    /**
+     * @brief Inserción de todos los elementos de un rango escribiendo sus handles
+     * @param first inicio del rango
+     * @param last fin del rango
+     * @param handles iterador de salida donde se escribe el handle de cada elemento, en el orden del rango
+     *
+     * @returns handles avanzado una posición por elemento insertado
+     *
+     * \complexity{\O(k)} con k cantidad de elementos del rango
+     */
+    template < typename InputIt, typename OutputIt >
+    OutputIt insert_range(InputIt first, InputIt last, OutputIt handles);
+
     /**
      * @brief Remover minimo
      * \complexity{\O(log(n) amortizado)}
@@ -128,6 +257,44 @@ public:
      */
     void extract_min();
 
+    /**
+     * @brief Remover minimo devolviéndolo
+     * El elemento se mueve fuera del nodo antes de destruirlo
+     * \pre !empty()
+     *
+     * @returns el elemento que era el minimo
+     *
+     * \complexity{\O(log(n) amortizado)}
+     *
+     */
+    value_type pop_min();
+
+    /**
+     * @brief Remover los k minimos escribiéndolos en orden en out, consolidando una sola vez
+     * Los elementos salen en el mismo orden que con k llamadas a pop_min
+     * @param k cantidad de elementos a remover (se remueven todos si hay menos)
+     * @param out iterador de salida donde se mueven los elementos
+     *
+     * @returns out avanzado una posición por elemento removido
+     *
+     * \complexity{\O((r + k) log(r + k) + log(n))} amortizado, con r cantidad de raíces
+     */
+    template < typename OutputIt >
+    OutputIt pop_k(size_type k, OutputIt out);
+
+    /**
+     * @brief Remover el minimo mientras pred(minimum()) sea verdadero, consolidando una sola vez
+     * Los elementos salen en el mismo orden que con llamadas sucesivas a pop_min
+     * @param pred predicado sobre const value_type&
+     * @param out iterador de salida donde se mueven los elementos
+     *
+     * @returns out avanzado una posición por elemento removido
+     *
+     * \complexity{\O((r + k) log(r + k) + log(n))} amortizado, con r cantidad de raíces y k cantidad de elementos removidos
+     */
+    template < typename Pred, typename OutputIt >
+    OutputIt drain_while(Pred pred, OutputIt out);
+
     /**
      * @brief Eliminar elemento
      * @param x handle que apunta al elemento a eliminar
@@ -141,7 +308,7 @@ public:
      * @brief Decrementar elemento
      * @param x handle que apunta al elemento a decrementar
      * @param val nuevo valor del elemento
-     * \pre  \P{val} < *\P{x}
+     * \pre  value_comp()(\P{val}, *\P{x})
      * \post *\P{x} == \P{val} \AND el resto de la estructura no cambia
      *
      * \complexity{\O(1) amortizado}
@@ -149,9 +316,34 @@ public:
      */
     void decrease_key(const handle &x, const value_type &val);
 
+    /**
+     * @brief Decrementar elemento moviendo el nuevo valor
+     * @param x handle que apunta al elemento a decrementar
+     * @param val nuevo valor del elemento, queda en estado válido pero no especificado
+     * \pre  value_comp()(\P{val}, *\P{x})
+     * \post *\P{x} es el valor que tenía \P{val} \AND el resto de la estructura no cambia
+     *
+     * \complexity{\O(1) amortizado}
+     *
+     */
+    void decrease_key(const handle &x, value_type &&val);
+
+    /**
+     * @brief Incrementar elemento, nombre de decrease_key para max heaps (Compare = std::greater<T>)
+     * @param x handle que apunta al elemento a incrementar
+     * @param val nuevo valor del elemento
+     * \pre  value_comp()(\P{val}, *\P{x})
+     * \post *\P{x} == \P{val} \AND el resto de la estructura no cambia
+     *
+     * \complexity{\O(1) amortizado}
+     *
+     */
+    void increase_key(const handle &x, const value_type &val);
+
     /**
      * @brief Une 2 heaps quedando todos los elementos en uno solo
      * @param h heap a unir que queda vacio
+     * \pre h.empty() \LOR get_allocator() == h.get_allocator()
      *
      * \complexity{\O(1)}
      *
@@ -162,122 +354,112 @@ private:
 
     /**
      * Nodo de la estructura:
-     * - Apunta al padre (null si no tiene)
-     * - Apunta a la lista de hijos
-     * - Las listas son doblemente enlazadas
+     * - Tiene los enlaces de fibonacci_links (padre, hijos, hermanos, grado y marca)
      * - Se guarda un elemento
-     * - Se tiene la cantidad de hijos
-     * - Se marca si pierde un hijo desde que el nodo se hizo hijo de otro nodo
      */
-    struct Node{
+    struct Node : fibonacci_links<Node> {
 
         /**
          * @brief crear nodo que representa heap de un elemento
-         * @param val clave del nodo a crear
+         * @param args argumentos para construir la clave del nodo
          *
-         * \complexity{\O(1)}
+         * \complexity{\O(1)} más la construcción de T
          */
-        Node(const value_type& val);
-
-        /**
-         * @brief unir listas
-         * @param n puntero a nodo a unir
-         *
-         * \complexity{\O(1)}
-         */
-        void join(Node* n);
-
-        /**
-         * @brief Sacar nodo de la lista enlazada en la que esta sin romperla y unirse a si mismo
-         *
-         * \complexity{\O(1)}
-         */
-        void remove();
-
-        /**
-         * @brief Sacar padre de una lista enlazada
-         *
-         * \complexity{\O(log(n))}
-         */
-        void remove_parent();
-
-        /**
-         * @brief Agrega hijo al nodo
-         * @param n nodo a agregar que es removido de la lista enlazada en la que está
-         *
-         * \complexity{\O(1)}
-         */
-        void add_child(Node* n);
+        template < typename... Args >
+        explicit Node(Args&&... args);
 
         /** @{ */
-        Node* parent;
-        Node* child;
-        Node* left;
-        Node* right;
         value_type key;
-        unsigned int degree;
-        bool mark;
         /** @} */
     };
 
     /**
-     * @brief eliminar todos los nodos de una lista circular y cada uno de sus hijos
-     * Deja al heap en un estado inconsistente
-     * @param x puntero al nodo donde se empieza
+     * Compara nodos por su clave con Compare
+     */
+    struct node_compare : ebo_holder<Compare> {
+        node_compare() = default;
+        explicit node_compare(const Compare& comp);
+        bool operator()(const Node* a, const Node* b) const;
+    };
+
+    using forest_type = fibonacci_forest<Node, node_compare, Stats>;
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    /**
+     * @brief Compara claves con el comparador del heap
      *
-     * \complexity{\O(n)}
+     * @returns true \IFF a va antes que b
+     *
+     * \complexity{\O(cmp(T))}
      */
-    void delete_brothers_and_childs(Node* x);
+    bool precedes(const value_type& a, const value_type& b) const;
 
     /**
-     * @brief agregar todos los nodos de una lista circular y cada uno de sus hijos
-     * @param x puntero al nodo donde se empieza
+     * @brief Pedir y construir un nodo con el allocator
+     * @param args argumentos para construir la clave del nodo
      *
-     * \complexity{\O(n)}
+     * \complexity{\O(1)} más la construcción de T
      */
-    void insert_brothers_and_childs(Node* x);
+    template < typename... Args >
+    Node* create_node(Args&&... args);
 
     /**
-     * @brief Dejar a la lista de raíces sin raíces con misma cantidad de hijos
+     * @brief Destruir un nodo y devolver su memoria al allocator
+     * @param x nodo a destruir
      *
-     * \complexity{\O(log(n) amortizado)}
+     * \complexity{\O(1)}
      */
-    void consolidate();
+    void destroy_node(Node* x);
 
     /**
-     * @brief Poner nodo en la lista de raíces
-     * @param x Nodo a mover
-     * @param parent Padre del nodo a mover
+     * @brief Poner un nodo recién creado en el bosque
+     * @param node nodo a agregar
+     *
+     * @returns handle que apunta al nodo
      *
      * \complexity{\O(1)}
      */
-    void cut(Node* x,Node* parent);
+    handle link_root(Node* node);
 
     /**
-     * @brief Mantener estructura para que no haya nodos que hayan perdido más de 1 nodo
-     * @param x Nodo que acaba de perder un hijo
+     * @brief copiar los nodos de h manteniendo la forma de sus árboles
+     * Si el allocator tiene reserve(n) se piden todos los nodos juntos
+     * @param h heap a copiar
+     * \pre empty()
      *
-     * \complexity{\O(c)} con c cantidad de llamadas recursivas
+     * \complexity{\O(n)}
+     */
+    void clone_from(const fibonacci_heap& h);
+
+    /**
+     * @brief Crear un nodo por cada elemento del rango y unirlos al bosque de una sola vez
+     * @param on_insert función que recibe cada nodo creado
+     * Si algo lanza una excepción se destruyen los nodos creados y el bosque no cambia
      *
+     * \complexity{\O(k)} con k cantidad de elementos del rango
      */
-    void cascading_cut(Node* x);
+    template < typename InputIt, typename F >
+    void link_range(InputIt first, InputIt last, F& on_insert);
 
     /**
-     * @brief Obtener lista de raíces de la estructura
-     * @returns Lista de raíces en vector
+     * @brief Remover minimos mientras keep los acepte moviéndolos a out, ver fibonacci_forest::pop_while
+     * @param keep función que recibe el nodo minimo y devuelve si se lo remueve
+     * @param out iterador de salida donde se mueven los elementos
      *
-     * \complexity{\O(t)} con t cantidad de árboles en la lista de raíces
+     * @returns out avanzado una posición por elemento removido
      */
-    std::vector<Node*> get_root_list();
+    template < typename Keep, typename OutputIt >
+    OutputIt pop_while(Keep keep, OutputIt out);
 
     /** @{ */
-    Node* min;
-    size_type n;
+    forest_type forest;
+    node_allocator alloc;
     /** @} */
 };
 
-template<typename T>
-class fibonacci_heap<T>::handle {
+template<typename T, typename Compare, typename Allocator, typename Stats>
+class fibonacci_heap<T, Compare, Allocator, Stats>::handle {
 public:
     using value_type = T;
     using pointer = const T*;
@@ -337,10 +519,10 @@ private:
      *
      * Cuando el elemento sea eliminado no se debe desreferenciar a este handle
      */
-    handle(fibonacci_heap<T>::Node* x);
+    handle(fibonacci_heap<T, Compare, Allocator, Stats>::Node* x);
 
     /** @{ */
-    fibonacci_heap<T>::Node* n;
+    fibonacci_heap<T, Compare, Allocator, Stats>::Node* n;
     /** @} */
 };
 
@@ -1,299 +1,305 @@
 #include "fibonacci_heap.h"
 
-template<typename T>
-fibonacci_heap<T>::fibonacci_heap() : min(nullptr), n(0) {}
+template<typename T, typename Compare, typename Allocator, typename Stats>
+fibonacci_heap<T, Compare, Allocator, Stats>::fibonacci_heap() : forest(), alloc() {}
 
-template<typename T>
-fibonacci_heap<T>::~fibonacci_heap() {
-    if(!empty()){
-        delete_brothers_and_childs(min);
-    }
+template<typename T, typename Compare, typename Allocator, typename Stats>
+fibonacci_heap<T, Compare, Allocator, Stats>::fibonacci_heap(const value_compare &comp, const allocator_type &alloc) : forest(node_compare(comp)), alloc(alloc) {}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+fibonacci_heap<T, Compare, Allocator, Stats>::fibonacci_heap(const allocator_type &alloc) : forest(), alloc(alloc) {}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+template<typename InputIt, typename>
+fibonacci_heap<T, Compare, Allocator, Stats>::fibonacci_heap(InputIt first, InputIt last, const value_compare &comp, const allocator_type &alloc) : forest(node_compare(comp)), alloc(alloc) {
+    insert_range(first, last);
+}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+fibonacci_heap<T, Compare, Allocator, Stats>::~fibonacci_heap() {
+    clear();
+}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+fibonacci_heap<T, Compare, Allocator, Stats>::fibonacci_heap(const fibonacci_heap& h) : forest(h.forest.node_comp()), alloc(node_traits::select_on_container_copy_construction(h.alloc)) {
+    clone_from(h);
 }
 
-template<typename T>
-fibonacci_heap<T>::fibonacci_heap(const fibonacci_heap& h) : min(nullptr), n(0) {
-    if(!h.empty()){
-        insert_brothers_and_childs(h.min);
+template<typename T, typename Compare, typename Allocator, typename Stats>
+fibonacci_heap<T, Compare, Allocator, Stats>& fibonacci_heap<T, Compare, Allocator, Stats>::operator= (const fibonacci_heap& h) {
+    if(this != &h){
+        clear();
+        forest.node_comp() = h.forest.node_comp();
+        if(node_traits::propagate_on_container_copy_assignment::value){
+            alloc = h.alloc;
+        }
+        clone_from(h);
     }
+    return *this;
 }
 
-template<typename T>
-fibonacci_heap<T>& fibonacci_heap<T>::operator= (const fibonacci_heap& h) {
+template<typename T, typename Compare, typename Allocator, typename Stats>
+fibonacci_heap<T, Compare, Allocator, Stats>::fibonacci_heap(fibonacci_heap && h) noexcept : forest(std::move(h.forest)), alloc(h.alloc) {}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+fibonacci_heap<T, Compare, Allocator, Stats>& fibonacci_heap<T, Compare, Allocator, Stats>::operator=(fibonacci_heap && h) noexcept {
     clear();
-    if(!h.empty()){
-        insert_brothers_and_childs(h.min);
+    if(node_traits::propagate_on_container_move_assignment::value){
+        alloc = h.alloc;
     }
+    assert(h.empty() || alloc == h.alloc);
+    forest.swap(h.forest);
+    return *this;
 }
 
-template<typename T>
-fibonacci_heap<T>::fibonacci_heap(fibonacci_heap && h) noexcept : min(h.min), n(h.n) {
-    h.min = nullptr;
-    h.n = 0;
+template<typename T, typename Compare, typename Allocator, typename Stats>
+void fibonacci_heap<T, Compare, Allocator, Stats>::clear() {
+    forest.clear([this](Node* x){ destroy_node(x); });
 }
 
-template<typename T>
-fibonacci_heap<T>& fibonacci_heap<T>::operator=(fibonacci_heap && h) noexcept {
-    clear();
-    std::swap(min,h.min);
-    std::swap(n,h.n);
+template<typename T, typename Compare, typename Allocator, typename Stats>
+void fibonacci_heap<T, Compare, Allocator, Stats>::swap(fibonacci_heap &h) {
+    if(node_traits::propagate_on_container_swap::value){
+        std::swap(alloc,h.alloc);
+    }
+    assert(alloc == h.alloc);
+    forest.swap(h.forest);
 }
 
-template<typename T>
-void fibonacci_heap<T>::clear() {
-    if(!empty()){
-        delete_brothers_and_childs(min);
-        min = nullptr;
-        n = 0;
-    }
+template<typename T, typename Compare, typename Allocator, typename Stats>
+typename fibonacci_heap<T, Compare, Allocator, Stats>::allocator_type fibonacci_heap<T, Compare, Allocator, Stats>::get_allocator() const {
+    return allocator_type(alloc);
 }
 
-template<typename T>
-void fibonacci_heap<T>::swap(fibonacci_heap &h) {
-    std::swap(min,h.min);
-    std::swap(n,h.n);
+template<typename T, typename Compare, typename Allocator, typename Stats>
+typename fibonacci_heap<T, Compare, Allocator, Stats>::value_compare fibonacci_heap<T, Compare, Allocator, Stats>::value_comp() const {
+    return forest.node_comp().get();
 }
 
-template<typename T>
-bool fibonacci_heap<T>::empty() const {
-    return min == nullptr;
+template<typename T, typename Compare, typename Allocator, typename Stats>
+const Stats &fibonacci_heap<T, Compare, Allocator, Stats>::stats() const {
+    return forest.stats();
 }
 
-template<typename T>
-typename fibonacci_heap<T>::size_type fibonacci_heap<T>::size() const {
-    return n;
+template<typename T, typename Compare, typename Allocator, typename Stats>
+void fibonacci_heap<T, Compare, Allocator, Stats>::reset_stats() {
+    forest.stats().reset();
 }
 
-template<typename T>
-const typename fibonacci_heap<T>::value_type &fibonacci_heap<T>::minimum() const {
-    return min->key;
+template<typename T, typename Compare, typename Allocator, typename Stats>
+bool fibonacci_heap<T, Compare, Allocator, Stats>::empty() const {
+    return forest.empty();
 }
 
-template<typename T>
-typename fibonacci_heap<T>::handle fibonacci_heap<T>::insert(const value_type &val) {
-    Node* node = new Node(val);
-    if(empty()){
-        min = node;
-    }else{
-        min->join(node);
-        if(node->key < min->key){
-            min = node;
-        }
-    }
-    ++n;
-    return fibonacci_heap<T>::handle(node);
+template<typename T, typename Compare, typename Allocator, typename Stats>
+typename fibonacci_heap<T, Compare, Allocator, Stats>::size_type fibonacci_heap<T, Compare, Allocator, Stats>::size() const {
+    return forest.size();
 }
 
-template<typename T>
-void fibonacci_heap<T>::extract_min() {
-    if(!empty()){
-        if(min->degree > 0){
-            min->child->remove_parent();
-            min->join(min->child);
-        }
-        Node* z = min->right;
-        min->remove();
-        delete min;
-        if(min == z){
-            min = nullptr;
-        }else{
-            min = z;
-            consolidate();
-        }
-        --n;
-    }
+template<typename T, typename Compare, typename Allocator, typename Stats>
+const typename fibonacci_heap<T, Compare, Allocator, Stats>::value_type &fibonacci_heap<T, Compare, Allocator, Stats>::minimum() const {
+    return forest.top()->key;
 }
 
-template<typename T>
-void fibonacci_heap<T>::delete_key(fibonacci_heap<T>::handle &x) {
-    fibonacci_heap<T>::Node* node_to_delete = x.n;
-    fibonacci_heap<T>::Node* parent = node_to_delete->parent;
-    if(parent != nullptr){
-        cut(node_to_delete,parent);
-        cascading_cut(parent);
-    }
-    min = node_to_delete;
-    extract_min();
-}
-
-template<typename T>
-void fibonacci_heap<T>::decrease_key(const fibonacci_heap<T>::handle &x, const value_type &val) {
-    fibonacci_heap<T>::Node* decreased_node = x.n;
-    assert(val < decreased_node->key);
-    decreased_node->key = val;
-    fibonacci_heap<T>::Node* y = decreased_node->parent;
-    if(y != nullptr && decreased_node->key < y->key){
-        cut(decreased_node,y);
-        cascading_cut(y);
-    }
-    if(decreased_node->key < min->key){
-        min = decreased_node;
-    }
+template<typename T, typename Compare, typename Allocator, typename Stats>
+typename fibonacci_heap<T, Compare, Allocator, Stats>::handle fibonacci_heap<T, Compare, Allocator, Stats>::insert(const value_type &val) {
+    return link_root(create_node(val));
 }
 
-template<typename T>
-void fibonacci_heap<T>::join(fibonacci_heap &h) {
-    if(empty()){
-        min = h.min;
-    }else if(!h.empty()){
-        min->join(h.min);
-        if(h.min->key < min->key) {
-            min = h.min;
-        }
-    }
-    n += h.n;
-    h.min = nullptr;
-    h.n = 0;
-}
-
-template<typename T>
-void fibonacci_heap<T>::delete_brothers_and_childs(fibonacci_heap::Node *x) {
-    x->left->right = nullptr;
-    while (x != nullptr){
-        Node* next = x->right;
-        if(x->child != nullptr){
-            delete_brothers_and_childs(x->child);
-        }
-        delete x;
-        x = next;
-    }
+template<typename T, typename Compare, typename Allocator, typename Stats>
+typename fibonacci_heap<T, Compare, Allocator, Stats>::handle fibonacci_heap<T, Compare, Allocator, Stats>::insert(value_type &&val) {
+    return link_root(create_node(std::move(val)));
 }
 
-template<typename T>
-void fibonacci_heap<T>::insert_brothers_and_childs(fibonacci_heap::Node *x) {
-    Node* i = x;
-    do{
-        if(i->child != nullptr){
-            insert_brothers_and_childs(i->child);
-        }
-        insert(i->key);
-        i = i->right;
-    }while(i != x);
-}
-
-template<typename T>
-void fibonacci_heap<T>::consolidate() {
-    unsigned int max_degree = log2ul(n) + 1;
-    std::vector<Node*> a(max_degree, nullptr);
-    std::vector<fibonacci_heap::Node *> nodes_to_process = get_root_list();
-    for (unsigned int j = 0; j < nodes_to_process.size(); ++j) {
-        Node* x = nodes_to_process[j];
-        unsigned int d = x->degree;
-        while (a[d] != nullptr){
-            Node* y = a[d];
-            if(y->key < x->key){
-                std::swap(x,y);
-            }
-            x->add_child(y);
-            a[d] = nullptr;
-            ++d;
-        }
-        a[d] = x;
-    }
-    min = nullptr;
-    for (unsigned int i = 0; i < a.size(); ++i) {
-        if(a[i] != nullptr && (min == nullptr || a[i]->key < min->key)){
-            min = a[i];
-        }
-    }
+template<typename T, typename Compare, typename Allocator, typename Stats>
+template<typename... Args>
+typename fibonacci_heap<T, Compare, Allocator, Stats>::handle fibonacci_heap<T, Compare, Allocator, Stats>::emplace(Args &&... args) {
+    return link_root(create_node(std::forward<Args>(args)...));
 }
 
-template<typename T>
-void fibonacci_heap<T>::cut(fibonacci_heap::Node *x, fibonacci_heap::Node *parent) {
-    if(--parent->degree && x == parent->child){
-        parent->child = x->right;
-    }else if(!parent->degree){
-        parent->child = nullptr;
-    }
-    x->remove();
-    min->join(x);
-    x->parent = nullptr;
-    x->mark = false;
-}
-
-template<typename T>
-void fibonacci_heap<T>::cascading_cut(fibonacci_heap::Node *x) {
-    fibonacci_heap<T>::Node* z = x->parent;
-    if(z != nullptr){
-        if(x->mark){
-            cut(x,z);
-            cascading_cut(z);
-        }else{
-            x->mark = true;
-        }
+template<typename T, typename Compare, typename Allocator, typename Stats>
+template<typename InputIt>
+void fibonacci_heap<T, Compare, Allocator, Stats>::insert_range(InputIt first, InputIt last) {
+    auto ignore = [](Node*){};
+    link_range(first, last, ignore);
+}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+template<typename InputIt, typename OutputIt>
+OutputIt fibonacci_heap<T, Compare, Allocator, Stats>::insert_range(InputIt first, InputIt last, OutputIt handles) {
+    auto write_handle = [&handles](Node* x){
+        *handles = handle(x);
+        ++handles;
+    };
+    link_range(first, last, write_handle);
+    return handles;
+}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+void fibonacci_heap<T, Compare, Allocator, Stats>::extract_min() {
+    if(!empty()){
+        destroy_node(forest.pop());
     }
 }
 
-template<typename T>
-std::vector<typename fibonacci_heap<T>::Node *> fibonacci_heap<T>::get_root_list() {
-    std::vector<fibonacci_heap::Node *> res;
-    Node* i = min;
-    do{
-        res.push_back(i);
-        i = i->right;
-    }while(i != min);
+template<typename T, typename Compare, typename Allocator, typename Stats>
+typename fibonacci_heap<T, Compare, Allocator, Stats>::value_type fibonacci_heap<T, Compare, Allocator, Stats>::pop_min() {
+    assert(!empty());
+    Node* x = forest.pop();
+    value_type res(std::move(x->key));
+    destroy_node(x);
     return res;
 }
 
-template<typename T>
-fibonacci_heap<T>::Node::Node(const value_type &val) : parent(nullptr), child(nullptr), left(this), right(this), key(val), degree(0), mark(false) {}
+template<typename T, typename Compare, typename Allocator, typename Stats>
+template<typename OutputIt>
+OutputIt fibonacci_heap<T, Compare, Allocator, Stats>::pop_k(size_type k, OutputIt out) {
+    size_type remaining = k;
+    return pop_while([&remaining](const Node*){ return remaining-- > 0; }, out);
+}
 
-template<typename T>
-void fibonacci_heap<T>::Node::join(fibonacci_heap::Node *n) {
-    Node* right_node = right;
-    Node* right_node_other = n->right;
-    std::swap(right,n->right);
-    std::swap(right_node->left,right_node_other->left);
+template<typename T, typename Compare, typename Allocator, typename Stats>
+template<typename Pred, typename OutputIt>
+OutputIt fibonacci_heap<T, Compare, Allocator, Stats>::drain_while(Pred pred, OutputIt out) {
+    return pop_while([&pred](const Node* x){ return static_cast<bool>(pred(static_cast<const value_type&>(x->key))); }, out);
 }
 
-template<typename T>
-void fibonacci_heap<T>::Node::remove() {
-    left->right = right;
-    right->left = left;
-    left = this;
-    right = this;
+template<typename T, typename Compare, typename Allocator, typename Stats>
+void fibonacci_heap<T, Compare, Allocator, Stats>::delete_key(fibonacci_heap<T, Compare, Allocator, Stats>::handle &x) {
+    forest.erase(x.n);
+    destroy_node(x.n);
 }
 
-template<typename T>
-void fibonacci_heap<T>::Node::remove_parent() {
-    Node* i = this;
-    do{
-        i->parent = nullptr;
-        i = i->right;
-    }while(i != this);
+template<typename T, typename Compare, typename Allocator, typename Stats>
+void fibonacci_heap<T, Compare, Allocator, Stats>::decrease_key(const fibonacci_heap<T, Compare, Allocator, Stats>::handle &x, const value_type &val) {
+    assert(precedes(val, x.n->key));
+    x.n->key = val;
+    forest.decreased(x.n);
 }
 
-template<typename T>
-void fibonacci_heap<T>::Node::add_child(fibonacci_heap::Node *n) {
-    n->remove();
-    n->parent = this;
-    if(child == nullptr){
-        child = n;
-    }else{
-        child->join(n);
+template<typename T, typename Compare, typename Allocator, typename Stats>
+void fibonacci_heap<T, Compare, Allocator, Stats>::decrease_key(const fibonacci_heap<T, Compare, Allocator, Stats>::handle &x, value_type &&val) {
+    assert(precedes(val, x.n->key));
+    x.n->key = std::move(val);
+    forest.decreased(x.n);
+}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+void fibonacci_heap<T, Compare, Allocator, Stats>::increase_key(const fibonacci_heap<T, Compare, Allocator, Stats>::handle &x, const value_type &val) {
+    decrease_key(x, val);
+}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+void fibonacci_heap<T, Compare, Allocator, Stats>::join(fibonacci_heap &h) {
+    assert(h.empty() || alloc == h.alloc);
+    forest.merge(h.forest);
+}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+bool fibonacci_heap<T, Compare, Allocator, Stats>::precedes(const value_type &a, const value_type &b) const {
+    return forest.node_comp().get()(a, b);
+}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+template<typename... Args>
+typename fibonacci_heap<T, Compare, Allocator, Stats>::Node *fibonacci_heap<T, Compare, Allocator, Stats>::create_node(Args &&... args) {
+    Node* x = node_traits::allocate(alloc, 1);
+    forest.stats().on_allocate();
+    try{
+        node_traits::construct(alloc, x, std::forward<Args>(args)...);
+    }catch(...){
+        node_traits::deallocate(alloc, x, 1);
+        forest.stats().on_deallocate();
+        throw;
     }
-    ++degree;
-    n->mark = false;
+    return x;
+}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+void fibonacci_heap<T, Compare, Allocator, Stats>::destroy_node(fibonacci_heap::Node *x) {
+    node_traits::destroy(alloc, x);
+    node_traits::deallocate(alloc, x, 1);
+    forest.stats().on_deallocate();
+}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+typename fibonacci_heap<T, Compare, Allocator, Stats>::handle fibonacci_heap<T, Compare, Allocator, Stats>::link_root(fibonacci_heap::Node *node) {
+    forest.push(node);
+    return fibonacci_heap<T, Compare, Allocator, Stats>::handle(node);
+}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+void fibonacci_heap<T, Compare, Allocator, Stats>::clone_from(const fibonacci_heap &h) {
+    allocator_reserve(alloc, h.size());
+    forest.clone(h.forest, [this](const Node* x){ return create_node(x->key); }, [this](Node* x){ destroy_node(x); });
+}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+template<typename InputIt, typename F>
+void fibonacci_heap<T, Compare, Allocator, Stats>::link_range(InputIt first, InputIt last, F &on_insert) {
+    allocator_reserve(alloc, range_size_hint(first, last));
+    forest_type range(forest.node_comp());
+    try{
+        for (; first != last; ++first) {
+            Node* x = create_node(*first);
+            range.push(x);
+            on_insert(x);
+        }
+    }catch(...){
+        range.clear([this](Node* x){ destroy_node(x); });
+        throw;
+    }
+    forest.merge(range);
+}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+template<typename Keep, typename OutputIt>
+OutputIt fibonacci_heap<T, Compare, Allocator, Stats>::pop_while(Keep keep, OutputIt out) {
+    std::vector<Node*, typename node_traits::template rebind_alloc<Node*> > frontier(alloc);
+    forest.pop_while(frontier, keep, [this, &out](Node* x){
+        try{
+            *out = std::move(x->key);
+            ++out;
+        }catch(...){
+            destroy_node(x);
+            throw;
+        }
+        destroy_node(x);
+    });
+    return out;
+}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+template<typename... Args>
+fibonacci_heap<T, Compare, Allocator, Stats>::Node::Node(Args &&... args) : key(std::forward<Args>(args)...) {}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+fibonacci_heap<T, Compare, Allocator, Stats>::node_compare::node_compare(const Compare &comp) : ebo_holder<Compare>(comp) {}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+bool fibonacci_heap<T, Compare, Allocator, Stats>::node_compare::operator()(const Node *a, const Node *b) const {
+    return this->get()(a->key, b->key);
 }
 
-template<typename T>
-bool fibonacci_heap<T>::handle::operator==(const fibonacci_heap<T>::handle &other) const {
+template<typename T, typename Compare, typename Allocator, typename Stats>
+bool fibonacci_heap<T, Compare, Allocator, Stats>::handle::operator==(const fibonacci_heap<T, Compare, Allocator, Stats>::handle &other) const {
     return n == other.n;
 }
 
-template<typename T>
-bool fibonacci_heap<T>::handle::operator!=(const fibonacci_heap<T>::handle &other) const {
+template<typename T, typename Compare, typename Allocator, typename Stats>
+bool fibonacci_heap<T, Compare, Allocator, Stats>::handle::operator!=(const fibonacci_heap<T, Compare, Allocator, Stats>::handle &other) const {
     return n != other.n;
 }
 
-template<typename T>
-const T &fibonacci_heap<T>::handle::operator*() const {
+template<typename T, typename Compare, typename Allocator, typename Stats>
+const T &fibonacci_heap<T, Compare, Allocator, Stats>::handle::operator*() const {
     return n->key;
 }
 
-template<typename T>
-typename fibonacci_heap<T>::handle::pointer fibonacci_heap<T>::handle::operator->() const {
+template<typename T, typename Compare, typename Allocator, typename Stats>
+typename fibonacci_heap<T, Compare, Allocator, Stats>::handle::pointer fibonacci_heap<T, Compare, Allocator, Stats>::handle::operator->() const {
     return &n->key;
 }
 
-template<typename T>
-fibonacci_heap<T>::handle::handle(fibonacci_heap<T>::Node *x) : n(x) {}
+template<typename T, typename Compare, typename Allocator, typename Stats>
+fibonacci_heap<T, Compare, Allocator, Stats>::handle::handle(fibonacci_heap<T, Compare, Allocator, Stats>::Node *x) : n(x) {}
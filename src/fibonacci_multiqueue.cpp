@@ -0,0 +1,11 @@
+#include "fibonacci_multiqueue.h"
+
+std::uint32_t multiqueue_random() {
+    // Semillas distintas por hilo: un contador global mezclado con la constante de Knuth, nunca 0
+    static std::atomic<std::uint32_t> seeds(0);
+    static thread_local std::uint32_t state = (seeds.fetch_add(1, std::memory_order_relaxed) + 1) * 2654435761U | 1U;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
@@ -0,0 +1,164 @@
+#ifndef FIBONACCI_MULTIQUEUE_H
+#define FIBONACCI_MULTIQUEUE_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "fibonacci_heap.h"
+
+/**
+ * @brief Número pseudoaleatorio con un generador propio de cada hilo (xorshift), sin locks
+ *
+ * @returns siguiente número del generador del hilo que llama
+ *
+ * \complexity{\O(1)}
+ */
+std::uint32_t multiqueue_random();
+
+/**
+ * Cola de prioridad relajada al estilo MultiQueue (Rihani, Sanders, Dementiev): varios fibonacci_heap
+ * independientes, cada uno detrás de su propio mutex que solo se toma con try_lock.
+ * - insert pone el elemento en una cola al azar (si está ocupada prueba otra)
+ * - try_pop mira dos colas al azar y saca el menor de sus dos minimos
+ * - No devuelve siempre el minimo global: el rank error (cuántos elementos menores había) es chico en promedio
+ *   y crece con la cantidad de colas, a cambio de que muchos hilos saquen a la vez sin esperarse
+ * - No hay handles. No se puede copiar ni mover
+ * Asume lo mismo de T, Compare y Allocator que fibonacci_heap, además:
+ * - Allocator es thread-safe: cada cola pide y libera memoria con su copia bajo su propio lock,
+ *   así que varias copias se usan a la vez. pool_allocator no sirve, su node_pool no lo es
+ */
+template < typename T, typename Compare = std::less<T>, typename Allocator = std::allocator<T> >
+class fibonacci_multiqueue {
+public:
+    using heap_type = fibonacci_heap<T, Compare, Allocator>;
+    using value_type = T;
+    using size_type = size_t;
+    using value_compare = Compare;
+    using allocator_type = Allocator;
+
+    /**
+     * @brief Construye cola vacia con queues_per_thread * threads colas
+     * @param queues_per_thread colas por hilo (c en el paper, 2 suele alcanzar)
+     * @param threads hilos que la van a usar, std::thread::hardware_concurrency() si es 0
+     * @param comp comparador a usar
+     * @param alloc allocator a usar
+     *
+     * \complexity{\O(c P)}
+     */
+    explicit fibonacci_multiqueue(size_type queues_per_thread = 2, size_type threads = 0, const value_compare& comp = value_compare(), const allocator_type& alloc = allocator_type());
+
+    fibonacci_multiqueue(const fibonacci_multiqueue&) = delete;
+    fibonacci_multiqueue& operator=(const fibonacci_multiqueue&) = delete;
+
+    /**
+     * @returns cantidad de colas
+     *
+     * \complexity{\O(1)}
+     */
+    size_type queues() const;
+
+    /**
+     * @returns cantidad de elementos, puede estar desactualizada si otros hilos insertan o sacan a la vez
+     *
+     * \complexity{\O(1)}
+     */
+    size_type size() const;
+
+    /**
+     * @returns true \IFF size() == 0, con la misma salvedad que size()
+     *
+     * \complexity{\O(1)}
+     */
+    bool empty() const;
+
+    /**
+     * @brief Inserción en una cola al azar
+     * @param val elemento a insertar
+     *
+     * \complexity{\O(1)} esperado
+     */
+    void insert(const value_type& val);
+    void insert(value_type&& val);
+
+    /**
+     * @brief Inserción construyendo el elemento dentro del nodo, en una cola al azar
+     * @param args argumentos para el constructor de T
+     *
+     * \complexity{\O(1)} esperado más la construcción de T
+     */
+    template < typename... Args >
+    void emplace(Args&&... args);
+
+    /**
+     * @brief Remover un elemento cercano al minimo moviéndolo a out
+     * Compara los minimos de dos colas al azar y saca el menor. Si las dos están vacias
+     * reintenta, y si la cola entera parece vacia recorre todas las colas antes de rendirse
+     * @param out donde se mueve el elemento sacado
+     *
+     * @returns false \IFF no encontró elementos en ninguna cola
+     *
+     * \complexity{\O(log(n/q) amortizado)} esperado con q colas, \O(q) si está vacia
+     */
+    bool try_pop(value_type& out);
+
+    /**
+     * @brief Remueve todos los elementos
+     * \pre ningún otro hilo usa la cola
+     *
+     * \complexity{\O(n)}
+     */
+    void clear();
+
+private:
+
+    /**
+     * Una cola. El relleno separa colas vecinas en líneas de cache distintas
+     */
+    struct shard {
+        explicit shard(const value_compare& comp, const allocator_type& alloc);
+
+        std::mutex lock;
+        heap_type heap;
+        char padding[64];
+    };
+
+    /**
+     * @returns índice de una cola al azar
+     *
+     * \complexity{\O(1)}
+     */
+    size_type random_shard() const;
+
+    /**
+     * @brief Sacar el minimo de s moviéndolo a out
+     * \pre se tiene s.lock \AND !s.heap.empty()
+     *
+     * \complexity{\O(log(n/q) amortizado)}
+     */
+    void pop_from(shard& s, value_type& out);
+
+    /**
+     * @brief Recorrer todas las colas esperando cada lock y sacar el minimo de la primera con elementos
+     *
+     * @returns false \IFF todas estaban vacias
+     *
+     * \complexity{\O(q)} más \O(log(n/q) amortizado)
+     */
+    bool pop_any(value_type& out);
+
+    /** @{ */
+    std::vector<std::unique_ptr<shard> > shards;
+    std::atomic<size_type> n;
+    value_compare comp;
+    /** @} */
+};
+
+#include "fibonacci_multiqueue.hpp"
+
+#endif //FIBONACCI_MULTIQUEUE_H
@@ -0,0 +1,130 @@
+#include "fibonacci_multiqueue.h"
+
+template<typename T, typename Compare, typename Allocator>
+fibonacci_multiqueue<T, Compare, Allocator>::fibonacci_multiqueue(size_type queues_per_thread, size_type threads, const value_compare &comp, const allocator_type &alloc) : n(0), comp(comp) {
+    if(threads == 0){
+        threads = std::thread::hardware_concurrency();
+    }
+    size_type count = std::max<size_type>(1, queues_per_thread * std::max<size_type>(1, threads));
+    shards.reserve(count);
+    for (size_type i = 0; i < count; ++i) {
+        shards.emplace_back(new shard(comp, alloc));
+    }
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename fibonacci_multiqueue<T, Compare, Allocator>::size_type fibonacci_multiqueue<T, Compare, Allocator>::queues() const {
+    return shards.size();
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename fibonacci_multiqueue<T, Compare, Allocator>::size_type fibonacci_multiqueue<T, Compare, Allocator>::size() const {
+    return n.load(std::memory_order_relaxed);
+}
+
+template<typename T, typename Compare, typename Allocator>
+bool fibonacci_multiqueue<T, Compare, Allocator>::empty() const {
+    return size() == 0;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void fibonacci_multiqueue<T, Compare, Allocator>::insert(const value_type &val) {
+    emplace(val);
+}
+
+template<typename T, typename Compare, typename Allocator>
+void fibonacci_multiqueue<T, Compare, Allocator>::insert(value_type &&val) {
+    emplace(std::move(val));
+}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename... Args>
+void fibonacci_multiqueue<T, Compare, Allocator>::emplace(Args &&... args) {
+    for (;;) {
+        shard& s = *shards[random_shard()];
+        std::unique_lock<std::mutex> guard(s.lock, std::try_to_lock);
+        if(guard.owns_lock()){
+            s.heap.emplace(std::forward<Args>(args)...);
+            // Con el lock tomado, así el fetch_sub de pop_from sobre este elemento siempre va después
+            n.fetch_add(1, std::memory_order_relaxed);
+            break;
+        }
+    }
+}
+
+template<typename T, typename Compare, typename Allocator>
+bool fibonacci_multiqueue<T, Compare, Allocator>::try_pop(value_type &out) {
+    if(shards.size() == 1){
+        return pop_any(out);
+    }
+    size_type empty_pairs = 0;
+    while (empty_pairs < shards.size()) {
+        size_type i = random_shard();
+        size_type j = random_shard();
+        if(i == j){
+            j = (j + 1) % shards.size();
+        }
+        shard& a = *shards[i];
+        shard& b = *shards[j];
+        // Solo try_lock: nunca se espera con un lock tomado, así no hay deadlock entre pares cruzados
+        std::unique_lock<std::mutex> guard_a(a.lock, std::try_to_lock);
+        if(!guard_a.owns_lock()){
+            continue;
+        }
+        std::unique_lock<std::mutex> guard_b(b.lock, std::try_to_lock);
+        if(!guard_b.owns_lock()){
+            continue;
+        }
+        if(a.heap.empty() && b.heap.empty()){
+            ++empty_pairs;
+            if(n.load(std::memory_order_relaxed) == 0){
+                break;
+            }
+            continue;
+        }
+        if(a.heap.empty() || (!b.heap.empty() && comp(b.heap.minimum(), a.heap.minimum()))){
+            pop_from(b, out);
+        }else{
+            pop_from(a, out);
+        }
+        return true;
+    }
+    return pop_any(out);
+}
+
+template<typename T, typename Compare, typename Allocator>
+void fibonacci_multiqueue<T, Compare, Allocator>::clear() {
+    for (size_type i = 0; i < shards.size(); ++i) {
+        std::lock_guard<std::mutex> guard(shards[i]->lock);
+        shards[i]->heap.clear();
+    }
+    n.store(0);
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename fibonacci_multiqueue<T, Compare, Allocator>::size_type fibonacci_multiqueue<T, Compare, Allocator>::random_shard() const {
+    return static_cast<size_type>(multiqueue_random()) % shards.size();
+}
+
+template<typename T, typename Compare, typename Allocator>
+void fibonacci_multiqueue<T, Compare, Allocator>::pop_from(shard &s, value_type &out) {
+    out = s.heap.pop_min();
+    n.fetch_sub(1, std::memory_order_relaxed);
+}
+
+template<typename T, typename Compare, typename Allocator>
+bool fibonacci_multiqueue<T, Compare, Allocator>::pop_any(value_type &out) {
+    size_type start = random_shard();
+    for (size_type k = 0; k < shards.size(); ++k) {
+        shard& s = *shards[(start + k) % shards.size()];
+        std::lock_guard<std::mutex> guard(s.lock);
+        if(!s.heap.empty()){
+            pop_from(s, out);
+            return true;
+        }
+    }
+    return false;
+}
+
+template<typename T, typename Compare, typename Allocator>
+fibonacci_multiqueue<T, Compare, Allocator>::shard::shard(const value_compare &comp, const allocator_type &alloc) : heap(comp, alloc) {}
@@ -0,0 +1,136 @@
+#ifndef FIBONACCI_STATS_H
+#define FIBONACCI_STATS_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Política de estadísticas que no cuenta nada.
+ * Es la que usan los heaps por defecto: es una clase vacía (no ocupa lugar) y sus métodos no hacen nada,
+ * así que el compilador los elimina por completo.
+ *
+ * Una política de estadísticas tiene que tener los mismos métodos que esta.
+ */
+struct no_stats {
+
+    /**
+     * @brief Se unió una raíz como hijo de otra en consolidate()
+     */
+    void on_link() {}
+
+    /**
+     * @brief Se cortó un nodo de su padre y pasó a la lista de raíces
+     */
+    void on_cut() {}
+
+    /**
+     * @brief Terminó un cascading_cut
+     * @param depth cantidad de ancestros marcados que se cortaron
+     */
+    void on_cascade(unsigned int depth) { (void)depth; }
+
+    /**
+     * @brief Se consolidó la lista de raíces
+     * @param roots cantidad de raíces antes de consolidar
+     * @param max_degree mayor grado después de consolidar
+     */
+    void on_consolidate(std::size_t roots, unsigned int max_degree) { (void)roots; (void)max_degree; }
+
+    /**
+     * @brief Se compararon dos nodos
+     */
+    void on_compare() {}
+
+    /**
+     * @brief Se pidió memoria para un nodo
+     */
+    void on_allocate() {}
+
+    /**
+     * @brief Se devolvió la memoria de un nodo
+     */
+    void on_deallocate() {}
+
+    /**
+     * @brief Volver todos los contadores a 0
+     */
+    void reset() {}
+};
+
+/**
+ * Política de estadísticas que cuenta operaciones y registra la forma del heap.
+ * Sirve para relacionar la latencia de extract_min con la cantidad de raíces y de links que hizo.
+ * No es thread-safe, igual que el heap.
+ */
+struct fibonacci_stats {
+    /** @{ */
+    /** links hechos en consolidate() */
+    std::uint64_t links;
+    /** cortes de nodos a la lista de raíces, incluyendo los de cascading_cut */
+    std::uint64_t cuts;
+    /** cortes hechos por cascading_cut */
+    std::uint64_t cascading_cuts;
+    /** mayor cantidad de cortes en un mismo cascading_cut */
+    unsigned int max_cascade_depth;
+    /** cantidad de llamadas a consolidate() */
+    std::uint64_t consolidations;
+    /** suma de las raíces recorridas por consolidate() */
+    std::uint64_t consolidated_roots;
+    /** raíces que recorrió la consolidate() más larga */
+    std::size_t max_roots;
+    /** mayor grado que dejó una consolidate() */
+    unsigned int max_degree;
+    /** comparaciones entre nodos */
+    std::uint64_t comparisons;
+    /** nodos pedidos al allocator */
+    std::uint64_t allocations;
+    /** nodos devueltos al allocator */
+    std::uint64_t deallocations;
+    /** @} */
+
+    fibonacci_stats() { reset(); }
+
+    void on_link() { ++links; }
+
+    void on_cut() { ++cuts; }
+
+    void on_cascade(unsigned int depth) {
+        cascading_cuts += depth;
+        if(depth > max_cascade_depth){
+            max_cascade_depth = depth;
+        }
+    }
+
+    void on_consolidate(std::size_t roots, unsigned int degree) {
+        ++consolidations;
+        consolidated_roots += roots;
+        if(roots > max_roots){
+            max_roots = roots;
+        }
+        if(degree > max_degree){
+            max_degree = degree;
+        }
+    }
+
+    void on_compare() { ++comparisons; }
+
+    void on_allocate() { ++allocations; }
+
+    void on_deallocate() { ++deallocations; }
+
+    void reset() {
+        links = 0;
+        cuts = 0;
+        cascading_cuts = 0;
+        max_cascade_depth = 0;
+        consolidations = 0;
+        consolidated_roots = 0;
+        max_roots = 0;
+        max_degree = 0;
+        comparisons = 0;
+        allocations = 0;
+        deallocations = 0;
+    }
+};
+
+#endif //FIBONACCI_STATS_H
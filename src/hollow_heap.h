@@ -0,0 +1,523 @@
+#ifndef HOLLOW_HEAP_H
+#define HOLLOW_HEAP_H
+
+#include <cassert>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "utils.h"
+
+/**
+ * Implementación de min_priority_queue<T> sobre hollow heap de una raíz con dos padres
+ * (Hansen, Kaplan, Tarjan, Zwick) con la misma interfaz que fibonacci_heap, así se puede cambiar de uno a otro
+ * con un typedef.
+ * - Cada elemento vive en un item fijo al que apunta su handle; el item apunta al nodo que lo tiene
+ * - decrease_key mueve el item a un nodo nuevo que se une a la raíz y deja hueco al viejo, que pasa a ser
+ *   el último hijo del nuevo (su segundo padre) con rango 2 menos. No hay cortes ni cortes en cascada
+ * - delete_key de un elemento que no es el minimo solo deja hueco su nodo
+ * - Al sacar el minimo se destruyen los nodos huecos alcanzables desde la raíz y los nodos llenos que
+ *   quedan se unen por rango como en consolidate(), sin pedir memoria
+ * - Mismas cotas que fibonacci_heap: insert, join y decrease_key \O(1), extract_min \O(log(N)) amortizado
+ *   con N la cantidad de nodos, que cuenta los huecos
+ * - No tiene política de estadísticas
+ * Asume de T, Compare y Allocator lo mismo que fibonacci_heap (el allocator se usa con rebind a items y nodos)
+ */
+template < typename T, typename Compare = std::less<T>, typename Allocator = std::allocator<T> >
+class hollow_heap : private ebo_holder<Compare> {
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using value_compare = Compare;
+    using allocator_type = Allocator;
+
+    class handle;
+
+    /**
+     * @brief Construye heap vacio
+     * \complexity{\O(1)}
+     */
+    hollow_heap();
+
+    /**
+     * @brief Construye heap vacio que ordena con comp
+     * @param comp comparador a usar
+     * @param alloc allocator a usar
+     *
+     * \complexity{\O(1)}
+     */
+    explicit hollow_heap(const value_compare& comp, const allocator_type& alloc = allocator_type());
+
+    /**
+     * @brief Construye heap vacio que pide los nodos a alloc
+     * @param alloc allocator a usar
+     *
+     * \complexity{\O(1)}
+     */
+    explicit hollow_heap(const allocator_type& alloc);
+
+    /**
+     * @brief Construye heap con los elementos de un rango, ver insert_range
+     * @param first inicio del rango
+     * @param last fin del rango
+     * @param comp comparador a usar
+     * @param alloc allocator a usar
+     *
+     * \complexity{\O(n)}
+     */
+    template < typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category >
+    hollow_heap(InputIt first, InputIt last, const value_compare& comp = value_compare(), const allocator_type& alloc = allocator_type());
+
+    /**
+     * @brief Destructor
+     * \complexity{\O(n)}
+     */
+    ~hollow_heap();
+
+    /**
+     * @brief Constructor por copia, inserta los elementos sin los nodos huecos de h
+     * \complexity{\O(n)}
+     */
+    hollow_heap(const hollow_heap&);
+
+    /**
+     * @brief Operador de asignacion
+     * \complexity{\O(n)}
+     */
+    hollow_heap& operator=(const hollow_heap&);
+
+    /**
+     * @brief Constructor por movimiento
+     * \complexity{\O(1)}
+     */
+    hollow_heap(hollow_heap&&) noexcept;
+
+    /**
+     * @brief Operador de asignacion por movimiento
+     * \complexity{\O(n)}
+     */
+    hollow_heap& operator=(hollow_heap&&) noexcept;
+
+    /**
+     * @brief Remueve todos los elementos
+     *
+     * \complexity{\O(n)}
+     */
+    void clear();
+
+    /**
+     * @brief Intercambia los elementos de 2 heaps
+     * @param h heap a intercambiar
+     * \pre los allocators se propagan en swap o son iguales
+     *
+     * \complexity{\O(1)}
+     */
+    void swap(hollow_heap& h);
+
+    /**
+     * @brief Devuelve copia del allocator
+     *
+     * \complexity{\O(1)}
+     */
+    allocator_type get_allocator() const;
+
+    /**
+     * @brief Devuelve copia del comparador
+     *
+     * \complexity{\O(1)}
+     */
+    value_compare value_comp() const;
+
+    /**
+     * @returns true \IFF size() == 0
+     *
+     * \complexity{\O(1)}
+     */
+    bool empty() const;
+
+    /**
+     * @returns cantidad de elementos
+     *
+     * \complexity{\O(1)}
+     */
+    size_type size() const;
+
+    /**
+     * @brief Acceso al minimo elemento
+     * \pre !empty()
+     *
+     * @returns referencia constante al minimo
+     *
+     * \complexity{\O(1)}
+     */
+    const value_type& minimum() const;
+
+    /**
+     * @brief Inserción
+     * @param val elemento a insertar
+     *
+     * @returns handle que apunta al elemento insertado
+     *
+     * \complexity{\O(1)}
+     */
+    handle insert(const value_type& val);
+
+    /**
+     * @brief Inserción moviendo el elemento
+     * @param val elemento a insertar, queda en estado válido pero no especificado
+     *
+     * @returns handle que apunta al elemento insertado
+     *
+     * \complexity{\O(1)}
+     */
+    handle insert(value_type&& val);
+
+    /**
+     * @brief Inserción construyendo el elemento dentro del nodo
+     * @param args argumentos para el constructor de T
+     *
+     * @returns handle que apunta al elemento insertado
+     *
+     * \complexity{\O(1)} más la construcción de T
+     */
+    template < typename... Args >
+    handle emplace(Args&&... args);
+
+    /**
+     * @brief Inserción de todos los elementos de un rango
+     * Si el rango es forward y el allocator tiene reserve(n) los nodos se piden todos juntos.
+     * Si la construcción de un elemento lanza una excepción el heap queda como estaba
+     * @param first inicio del rango
+     * @param last fin del rango
+     *
+     * \complexity{\O(k)} con k cantidad de elementos del rango
+     */
+    template < typename InputIt >
+    void insert_range(InputIt first, InputIt last);
+
+    /**
+     * @brief Inserción de todos los elementos de un rango escribiendo sus handles
+     * @param first inicio del rango
+     * @param last fin del rango
+     * @param handles iterador de salida donde se escribe el handle de cada elemento, en el orden del rango
+     *
+     * @returns handles avanzado una posición por elemento insertado
+     *
+     * \complexity{\O(k)} con k cantidad de elementos del rango
+     */
+    template < typename InputIt, typename OutputIt >
+    OutputIt insert_range(InputIt first, InputIt last, OutputIt handles);
+
+    /**
+     * @brief Remover minimo
+     * \complexity{\O(log(n) amortizado)}
+     */
+    void extract_min();
+
+    /**
+     * @brief Remover minimo devolviéndolo
+     * El elemento se mueve fuera del nodo antes de destruirlo
+     * \pre !empty()
+     *
+     * @returns el elemento que era el minimo
+     *
+     * \complexity{\O(log(n) amortizado)}
+     */
+    value_type pop_min();
+
+    /**
+     * @brief Remover los k minimos escribiéndolos en orden en out
+     * @param k cantidad de elementos a remover (se remueven todos si hay menos)
+     * @param out iterador de salida donde se mueven los elementos
+     *
+     * @returns out avanzado una posición por elemento removido
+     *
+     * \complexity{\O(k log(n) amortizado)}
+     */
+    template < typename OutputIt >
+    OutputIt pop_k(size_type k, OutputIt out);
+
+    /**
+     * @brief Remover el minimo mientras pred(minimum()) sea verdadero
+     * @param pred predicado sobre const value_type&
+     * @param out iterador de salida donde se mueven los elementos
+     *
+     * @returns out avanzado una posición por elemento removido
+     *
+     * \complexity{\O(k log(n) amortizado)} con k cantidad de elementos removidos
+     */
+    template < typename Pred, typename OutputIt >
+    OutputIt drain_while(Pred pred, OutputIt out);
+
+    /**
+     * @brief Eliminar elemento
+     * Si no es el minimo su nodo solo queda hueco y se libera cuando se llega a él al sacar un minimo
+     * @param x handle que apunta al elemento a eliminar
+     *
+     * \complexity{\O(log(n) amortizado)}
+     */
+    void delete_key(handle& x);
+
+    /**
+     * @brief Decrementar elemento
+     * @param x handle que apunta al elemento a decrementar
+     * @param val nuevo valor del elemento
+     * \pre value_comp()(\P{val}, *\P{x})
+     * El elemento pasa a un nodo nuevo que se une a la raíz y el viejo queda hueco, sin cortes en cascada
+     * \post *\P{x} == \P{val} \AND el resto de los elementos no cambia
+     *
+     * \complexity{\O(1)}
+     */
+    void decrease_key(const handle& x, const value_type& val);
+
+    /**
+     * @brief Decrementar elemento moviendo el nuevo valor
+     * @param x handle que apunta al elemento a decrementar
+     * @param val nuevo valor del elemento, queda en estado válido pero no especificado
+     * \pre value_comp()(\P{val}, *\P{x})
+     *
+     * \complexity{\O(1)}
+     */
+    void decrease_key(const handle& x, value_type&& val);
+
+    /**
+     * @brief Incrementar elemento, nombre de decrease_key para max heaps (Compare = std::greater<T>)
+     * @param x handle que apunta al elemento a incrementar
+     * @param val nuevo valor del elemento
+     * \pre value_comp()(\P{val}, *\P{x})
+     *
+     * \complexity{\O(1)}
+     */
+    void increase_key(const handle& x, const value_type& val);
+
+    /**
+     * @brief Une 2 heaps quedando todos los elementos en uno solo
+     * @param h heap a unir que queda vacio
+     * \pre h.empty() \LOR get_allocator() == h.get_allocator()
+     *
+     * \complexity{\O(1)}
+     */
+    void join(hollow_heap& h);
+
+private:
+
+    using compare_holder = ebo_holder<Compare>;
+
+    struct Node;
+
+    /**
+     * Elemento: su valor y el nodo lleno que lo tiene
+     */
+    struct Item {
+
+        /**
+         * @brief crear item sin nodo
+         * @param args argumentos para construir el elemento
+         *
+         * \complexity{\O(1)} más la construcción de T
+         */
+        template < typename... Args >
+        explicit Item(Args&&... args);
+
+        /** @{ */
+        Node* node;
+        value_type key;
+        /** @} */
+    };
+
+    /**
+     * Nodo de la estructura:
+     * - item es el elemento que tiene, nullptr si está hueco
+     * - child es el primer hijo y next el hermano siguiente
+     * - second_parent es el nodo nuevo que se creó al decrementar el elemento de este nodo hueco;
+     *   este nodo es el último hijo de second_parent y sigue además en la lista de hijos de su primer padre
+     */
+    struct Node {
+        Item* item;
+        Node* child;
+        Node* next;
+        Node* second_parent;
+        unsigned int rank;
+    };
+
+    using item_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Item>;
+    using item_traits = std::allocator_traits<item_allocator>;
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    /**
+     * Rangos posibles para todo N representable en size_type: un nodo de rango r tiene al menos
+     * F(r+3) - 1 descendientes, ver fibonacci_rank_bound
+     */
+    static const unsigned int max_rank = fibonacci_rank_bound(std::numeric_limits<size_type>::max()) + 1;
+
+    /**
+     * @returns true \IFF a va antes que b
+     *
+     * \complexity{\O(cmp(T))}
+     */
+    bool precedes(const value_type& a, const value_type& b) const;
+
+    /**
+     * @brief Pedir y construir un item con su nodo
+     * Si la construcción lanza una excepción no queda nada pedido
+     *
+     * @returns item creado, su nodo es un heap de un elemento
+     *
+     * \complexity{\O(1)} más la construcción de T
+     */
+    template < typename... Args >
+    Item* create_item(Args&&... args);
+
+    /**
+     * @brief Destruir un item y devolver su memoria al allocator
+     *
+     * \complexity{\O(1)}
+     */
+    void destroy_item(Item* e);
+
+    /**
+     * @brief Pedir un nodo lleno con e, sin hijos y de rango 0
+     *
+     * \complexity{\O(1)}
+     */
+    Node* create_node(Item* e);
+
+    /**
+     * @brief Devolver la memoria de un nodo al allocator
+     *
+     * \complexity{\O(1)}
+     */
+    void destroy_node(Node* u);
+
+    /**
+     * @brief Unir 2 árboles: el de raíz mayor pasa a ser el primer hijo del otro
+     * @param v raíz llena o nullptr
+     * @param w raíz llena o nullptr
+     *
+     * @returns la raíz que quedó
+     *
+     * \complexity{\O(cmp(T))}
+     */
+    Node* link(Node* v, Node* w);
+
+    /**
+     * @brief Quitar el elemento e: su nodo queda hueco y si era la raíz se reconstruye el heap
+     * \pre e está en el heap
+     *
+     * \complexity{\O(1)} si e no es el minimo, \O(log(N) amortizado) si lo es
+     */
+    void remove_item(Item* e);
+
+    /**
+     * @brief Destruir los nodos huecos alcanzables desde la raíz (que está hueca) y unir por rango los llenos
+     * que quedan sin padre
+     * \pre root->item == nullptr
+     *
+     * \complexity{\O(log(N) amortizado)}
+     */
+    void rebuild();
+
+    /**
+     * @brief Destruir todos los nodos y items del árbol de raíz r
+     * Cada nodo con dos padres se destruye la segunda vez que se lo alcanza
+     *
+     * \complexity{\O(N)}
+     */
+    void destroy_all(Node* r);
+
+    /**
+     * @brief Insertar copias de los elementos de h
+     * Si el allocator tiene reserve(n) items y nodos se piden todos juntos
+     * @param h heap a copiar
+     * \pre empty()
+     *
+     * \complexity{\O(N)} con N los nodos de h
+     */
+    void clone_from(const hollow_heap& h);
+
+    /**
+     * @brief Unir los elementos de un rango entre sí y después a la raíz, avisando cada item creado
+     * Si la construcción de un elemento lanza una excepción se destruye lo construido y el heap no cambia
+     * @param on_insert función a llamar con cada item creado, en el orden del rango
+     *
+     * \complexity{\O(k)} con k cantidad de elementos del rango
+     */
+    template < typename InputIt, typename F >
+    void link_range(InputIt first, InputIt last, F& on_insert);
+
+    /**
+     * @brief Remover el minimo mientras keep(minimum()) sea verdadero
+     *
+     * \complexity{\O(k log(N) amortizado)} con k cantidad de elementos removidos
+     */
+    template < typename Keep, typename OutputIt >
+    OutputIt pop_while(Keep keep, OutputIt out);
+
+    /** @{ */
+    item_allocator item_alloc;
+    node_allocator node_alloc;
+    Node* root;
+    size_type n;
+    // Todo en nullptr entre operaciones, rebuild lo usa y lo deja limpio
+    Node* rank_table[max_rank];
+    /** @} */
+};
+
+template < typename T, typename Compare, typename Allocator >
+class hollow_heap<T, Compare, Allocator>::handle {
+public:
+    using value_type = T;
+    using pointer = const T*;
+    using reference = const T&;
+
+    /**
+     * @returns true \IFF apuntan al mismo elemento
+     *
+     * \complexity{\O(1)}
+     */
+    bool operator==(const handle& other) const;
+
+    /**
+     * @returns false \IFF apuntan al mismo elemento
+     *
+     * \complexity{\O(1)}
+     */
+    bool operator!=(const handle& other) const;
+
+    /**
+     * @brief Desreferencia el puntero
+     * \pre El handle debe estar apuntando a un elemento.
+     *
+     * \complexity{\O(1)}
+     */
+    reference operator*() const;
+
+    /**
+     * @brief Operador flechita
+     * \pre El handle debe estar apuntando a un elemento.
+     *
+     * \complexity{\O(1)}
+     */
+    pointer operator->() const;
+
+private:
+
+    friend class hollow_heap;
+
+    /**
+     * @brief Constructor
+     * @param x puntero al item que el handle estará ligado
+     */
+    handle(Item* x);
+
+    /** @{ */
+    Item* e;
+    /** @} */
+};
+
+#include "hollow_heap.hpp"
+
+#endif //HOLLOW_HEAP_H
@@ -0,0 +1,488 @@
+#include "hollow_heap.h"
+
+template<typename T, typename Compare, typename Allocator>
+hollow_heap<T, Compare, Allocator>::hollow_heap() : compare_holder(), item_alloc(), node_alloc(), root(nullptr), n(0), rank_table() {}
+
+template<typename T, typename Compare, typename Allocator>
+hollow_heap<T, Compare, Allocator>::hollow_heap(const value_compare &comp, const allocator_type &alloc) : compare_holder(comp), item_alloc(alloc), node_alloc(alloc), root(nullptr), n(0), rank_table() {}
+
+template<typename T, typename Compare, typename Allocator>
+hollow_heap<T, Compare, Allocator>::hollow_heap(const allocator_type &alloc) : compare_holder(), item_alloc(alloc), node_alloc(alloc), root(nullptr), n(0), rank_table() {}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename InputIt, typename>
+hollow_heap<T, Compare, Allocator>::hollow_heap(InputIt first, InputIt last, const value_compare &comp, const allocator_type &alloc) : compare_holder(comp), item_alloc(alloc), node_alloc(alloc), root(nullptr), n(0), rank_table() {
+    insert_range(first, last);
+}
+
+template<typename T, typename Compare, typename Allocator>
+hollow_heap<T, Compare, Allocator>::~hollow_heap() {
+    clear();
+}
+
+template<typename T, typename Compare, typename Allocator>
+hollow_heap<T, Compare, Allocator>::hollow_heap(const hollow_heap &h) : compare_holder(h.compare_holder::get()), item_alloc(item_traits::select_on_container_copy_construction(h.item_alloc)), node_alloc(node_traits::select_on_container_copy_construction(h.node_alloc)), root(nullptr), n(0), rank_table() {
+    clone_from(h);
+}
+
+template<typename T, typename Compare, typename Allocator>
+hollow_heap<T, Compare, Allocator> &hollow_heap<T, Compare, Allocator>::operator=(const hollow_heap &h) {
+    if(this != &h){
+        clear();
+        compare_holder::get() = h.compare_holder::get();
+        if(item_traits::propagate_on_container_copy_assignment::value){
+            item_alloc = h.item_alloc;
+            node_alloc = h.node_alloc;
+        }
+        clone_from(h);
+    }
+    return *this;
+}
+
+template<typename T, typename Compare, typename Allocator>
+hollow_heap<T, Compare, Allocator>::hollow_heap(hollow_heap &&h) noexcept : compare_holder(h.compare_holder::get()), item_alloc(h.item_alloc), node_alloc(h.node_alloc), root(h.root), n(h.n), rank_table() {
+    h.root = nullptr;
+    h.n = 0;
+}
+
+template<typename T, typename Compare, typename Allocator>
+hollow_heap<T, Compare, Allocator> &hollow_heap<T, Compare, Allocator>::operator=(hollow_heap &&h) noexcept {
+    clear();
+    if(item_traits::propagate_on_container_move_assignment::value){
+        item_alloc = h.item_alloc;
+        node_alloc = h.node_alloc;
+    }
+    assert(h.empty() || item_alloc == h.item_alloc);
+    std::swap(compare_holder::get(), h.compare_holder::get());
+    std::swap(root, h.root);
+    std::swap(n, h.n);
+    return *this;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void hollow_heap<T, Compare, Allocator>::clear() {
+    destroy_all(root);
+    root = nullptr;
+    n = 0;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void hollow_heap<T, Compare, Allocator>::swap(hollow_heap &h) {
+    if(item_traits::propagate_on_container_swap::value){
+        std::swap(item_alloc, h.item_alloc);
+        std::swap(node_alloc, h.node_alloc);
+    }
+    assert(item_alloc == h.item_alloc);
+    std::swap(compare_holder::get(), h.compare_holder::get());
+    std::swap(root, h.root);
+    std::swap(n, h.n);
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename hollow_heap<T, Compare, Allocator>::allocator_type hollow_heap<T, Compare, Allocator>::get_allocator() const {
+    return allocator_type(item_alloc);
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename hollow_heap<T, Compare, Allocator>::value_compare hollow_heap<T, Compare, Allocator>::value_comp() const {
+    return compare_holder::get();
+}
+
+template<typename T, typename Compare, typename Allocator>
+bool hollow_heap<T, Compare, Allocator>::empty() const {
+    return n == 0;
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename hollow_heap<T, Compare, Allocator>::size_type hollow_heap<T, Compare, Allocator>::size() const {
+    return n;
+}
+
+template<typename T, typename Compare, typename Allocator>
+const typename hollow_heap<T, Compare, Allocator>::value_type &hollow_heap<T, Compare, Allocator>::minimum() const {
+    assert(!empty());
+    return root->item->key;
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename hollow_heap<T, Compare, Allocator>::handle hollow_heap<T, Compare, Allocator>::insert(const value_type &val) {
+    return emplace(val);
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename hollow_heap<T, Compare, Allocator>::handle hollow_heap<T, Compare, Allocator>::insert(value_type &&val) {
+    return emplace(std::move(val));
+}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename... Args>
+typename hollow_heap<T, Compare, Allocator>::handle hollow_heap<T, Compare, Allocator>::emplace(Args &&... args) {
+    Item* e = create_item(std::forward<Args>(args)...);
+    root = link(root, e->node);
+    ++n;
+    return handle(e);
+}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename InputIt>
+void hollow_heap<T, Compare, Allocator>::insert_range(InputIt first, InputIt last) {
+    auto ignore = [](Item*){};
+    link_range(first, last, ignore);
+}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename InputIt, typename OutputIt>
+OutputIt hollow_heap<T, Compare, Allocator>::insert_range(InputIt first, InputIt last, OutputIt handles) {
+    auto write_handle = [&handles](Item* e){
+        *handles = handle(e);
+        ++handles;
+    };
+    link_range(first, last, write_handle);
+    return handles;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void hollow_heap<T, Compare, Allocator>::extract_min() {
+    if(!empty()){
+        remove_item(root->item);
+    }
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename hollow_heap<T, Compare, Allocator>::value_type hollow_heap<T, Compare, Allocator>::pop_min() {
+    assert(!empty());
+    Item* e = root->item;
+    value_type res(std::move(e->key));
+    remove_item(e);
+    return res;
+}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename OutputIt>
+OutputIt hollow_heap<T, Compare, Allocator>::pop_k(size_type k, OutputIt out) {
+    size_type remaining = k;
+    return pop_while([&remaining](const value_type&){ return remaining-- > 0; }, out);
+}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename Pred, typename OutputIt>
+OutputIt hollow_heap<T, Compare, Allocator>::drain_while(Pred pred, OutputIt out) {
+    return pop_while([&pred](const value_type& x){ return static_cast<bool>(pred(x)); }, out);
+}
+
+template<typename T, typename Compare, typename Allocator>
+void hollow_heap<T, Compare, Allocator>::delete_key(handle &x) {
+    remove_item(x.e);
+}
+
+template<typename T, typename Compare, typename Allocator>
+void hollow_heap<T, Compare, Allocator>::decrease_key(const handle &x, const value_type &val) {
+    assert(precedes(val, x.e->key));
+    Node* u = x.e->node;
+    if(u == root){
+        x.e->key = val;
+        return;
+    }
+    // El nodo nuevo se pide antes de asignar para que una excepción deje el heap como estaba
+    Node* v = create_node(x.e);
+    try{
+        x.e->key = val;
+    }catch(...){
+        x.e->node = u;
+        destroy_node(v);
+        throw;
+    }
+    u->item = nullptr;
+    v->rank = u->rank > 2 ? u->rank - 2 : 0;
+    v->child = u;
+    u->second_parent = v;
+    root = link(root, v);
+}
+
+template<typename T, typename Compare, typename Allocator>
+void hollow_heap<T, Compare, Allocator>::decrease_key(const handle &x, value_type &&val) {
+    assert(precedes(val, x.e->key));
+    Node* u = x.e->node;
+    if(u == root){
+        x.e->key = std::move(val);
+        return;
+    }
+    // El nodo nuevo se pide antes de asignar para que una excepción deje el heap como estaba
+    Node* v = create_node(x.e);
+    try{
+        x.e->key = std::move(val);
+    }catch(...){
+        x.e->node = u;
+        destroy_node(v);
+        throw;
+    }
+    u->item = nullptr;
+    v->rank = u->rank > 2 ? u->rank - 2 : 0;
+    v->child = u;
+    u->second_parent = v;
+    root = link(root, v);
+}
+
+template<typename T, typename Compare, typename Allocator>
+void hollow_heap<T, Compare, Allocator>::increase_key(const handle &x, const value_type &val) {
+    decrease_key(x, val);
+}
+
+template<typename T, typename Compare, typename Allocator>
+void hollow_heap<T, Compare, Allocator>::join(hollow_heap &h) {
+    if(this == &h){
+        return;
+    }
+    assert(h.empty() || item_alloc == h.item_alloc);
+    root = link(root, h.root);
+    n += h.n;
+    h.root = nullptr;
+    h.n = 0;
+}
+
+template<typename T, typename Compare, typename Allocator>
+bool hollow_heap<T, Compare, Allocator>::precedes(const value_type &a, const value_type &b) const {
+    return compare_holder::get()(a, b);
+}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename... Args>
+typename hollow_heap<T, Compare, Allocator>::Item *hollow_heap<T, Compare, Allocator>::create_item(Args &&... args) {
+    Item* e = item_traits::allocate(item_alloc, 1);
+    try{
+        item_traits::construct(item_alloc, e, std::forward<Args>(args)...);
+    }catch(...){
+        item_traits::deallocate(item_alloc, e, 1);
+        throw;
+    }
+    try{
+        create_node(e);
+    }catch(...){
+        destroy_item(e);
+        throw;
+    }
+    return e;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void hollow_heap<T, Compare, Allocator>::destroy_item(Item *e) {
+    item_traits::destroy(item_alloc, e);
+    item_traits::deallocate(item_alloc, e, 1);
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename hollow_heap<T, Compare, Allocator>::Node *hollow_heap<T, Compare, Allocator>::create_node(Item *e) {
+    Node* u = node_traits::allocate(node_alloc, 1);
+    u->item = e;
+    u->child = nullptr;
+    u->next = nullptr;
+    u->second_parent = nullptr;
+    u->rank = 0;
+    e->node = u;
+    return u;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void hollow_heap<T, Compare, Allocator>::destroy_node(Node *u) {
+    node_traits::deallocate(node_alloc, u, 1);
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename hollow_heap<T, Compare, Allocator>::Node *hollow_heap<T, Compare, Allocator>::link(Node *v, Node *w) {
+    if(v == nullptr){
+        return w;
+    }
+    if(w == nullptr){
+        return v;
+    }
+    if(precedes(w->item->key, v->item->key)){
+        std::swap(v, w);
+    }
+    w->next = v->child;
+    v->child = w;
+    return v;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void hollow_heap<T, Compare, Allocator>::remove_item(Item *e) {
+    e->node->item = nullptr;
+    destroy_item(e);
+    --n;
+    if(root->item == nullptr){
+        rebuild();
+    }
+}
+
+template<typename T, typename Compare, typename Allocator>
+void hollow_heap<T, Compare, Allocator>::rebuild() {
+    unsigned int top = 0;
+    // Nodos huecos por destruir, enlazados por next
+    Node* pending = root;
+    pending->next = nullptr;
+    while (pending != nullptr) {
+        Node* v = pending;
+        pending = v->next;
+        Node* w = v->child;
+        while (w != nullptr) {
+            Node* u = w;
+            w = w->next;
+            if(u->item == nullptr){
+                if(u->second_parent == nullptr){
+                    u->next = pending;
+                    pending = u;
+                }else{
+                    // u se queda solo con el padre que no se destruye: si v es el segundo padre, u es su
+                    // último hijo y su next sigue la lista del primero; si no, u es el último hijo del segundo
+                    if(u->second_parent == v){
+                        w = nullptr;
+                    }else{
+                        u->next = nullptr;
+                    }
+                    u->second_parent = nullptr;
+                }
+            }else{
+                while (rank_table[u->rank] != nullptr) {
+                    Node* other = rank_table[u->rank];
+                    rank_table[u->rank] = nullptr;
+                    u = link(u, other);
+                    ++u->rank;
+                    assert(u->rank < max_rank);
+                }
+                rank_table[u->rank] = u;
+                if(u->rank > top){
+                    top = u->rank;
+                }
+            }
+        }
+        destroy_node(v);
+    }
+    root = nullptr;
+    for (unsigned int r = 0; r <= top; ++r) {
+        if(rank_table[r] != nullptr){
+            root = link(root, rank_table[r]);
+            rank_table[r] = nullptr;
+        }
+    }
+}
+
+template<typename T, typename Compare, typename Allocator>
+void hollow_heap<T, Compare, Allocator>::destroy_all(Node *r) {
+    if(r == nullptr){
+        return;
+    }
+    // Mismo recorrido que rebuild pero destruyendo también los nodos llenos y sus items
+    Node* pending = r;
+    pending->next = nullptr;
+    while (pending != nullptr) {
+        Node* v = pending;
+        pending = v->next;
+        Node* w = v->child;
+        while (w != nullptr) {
+            Node* u = w;
+            w = w->next;
+            if(u->second_parent == nullptr){
+                u->next = pending;
+                pending = u;
+            }else{
+                if(u->second_parent == v){
+                    w = nullptr;
+                }else{
+                    u->next = nullptr;
+                }
+                u->second_parent = nullptr;
+            }
+        }
+        if(v->item != nullptr){
+            destroy_item(v->item);
+        }
+        destroy_node(v);
+    }
+}
+
+template<typename T, typename Compare, typename Allocator>
+void hollow_heap<T, Compare, Allocator>::clone_from(const hollow_heap &h) {
+    if(h.empty()){
+        return;
+    }
+    allocator_reserve(item_alloc, h.size());
+    allocator_reserve(node_alloc, h.size());
+    // Cada nodo se visita una vez, desde su primer padre: en la lista del segundo padre es el último y se saltea
+    std::vector<const Node*> pending;
+    pending.reserve(h.size());
+    pending.push_back(h.root);
+    try{
+        while (!pending.empty()) {
+            const Node* v = pending.back();
+            pending.pop_back();
+            if(v->item != nullptr){
+                emplace(v->item->key);
+            }
+            for (const Node* u = v->child; u != nullptr && u->second_parent != v; u = u->next) {
+                pending.push_back(u);
+            }
+        }
+    }catch(...){
+        clear();
+        throw;
+    }
+}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename InputIt, typename F>
+void hollow_heap<T, Compare, Allocator>::link_range(InputIt first, InputIt last, F &on_insert) {
+    size_type hint = range_size_hint(first, last);
+    allocator_reserve(item_alloc, hint);
+    allocator_reserve(node_alloc, hint);
+    Node* range = nullptr;
+    size_type k = 0;
+    try{
+        for (; first != last; ++first) {
+            Item* e = create_item(*first);
+            range = link(range, e->node);
+            ++k;
+            on_insert(e);
+        }
+    }catch(...){
+        destroy_all(range);
+        throw;
+    }
+    root = link(root, range);
+    n += k;
+}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename Keep, typename OutputIt>
+OutputIt hollow_heap<T, Compare, Allocator>::pop_while(Keep keep, OutputIt out) {
+    while (!empty() && keep(static_cast<const value_type&>(root->item->key))) {
+        *out = pop_min();
+        ++out;
+    }
+    return out;
+}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename... Args>
+hollow_heap<T, Compare, Allocator>::Item::Item(Args &&... args) : node(nullptr), key(std::forward<Args>(args)...) {}
+
+template<typename T, typename Compare, typename Allocator>
+bool hollow_heap<T, Compare, Allocator>::handle::operator==(const handle &other) const {
+    return e == other.e;
+}
+
+template<typename T, typename Compare, typename Allocator>
+bool hollow_heap<T, Compare, Allocator>::handle::operator!=(const handle &other) const {
+    return e != other.e;
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename hollow_heap<T, Compare, Allocator>::handle::reference hollow_heap<T, Compare, Allocator>::handle::operator*() const {
+    return e->key;
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename hollow_heap<T, Compare, Allocator>::handle::pointer hollow_heap<T, Compare, Allocator>::handle::operator->() const {
+    return &e->key;
+}
+
+template<typename T, typename Compare, typename Allocator>
+hollow_heap<T, Compare, Allocator>::handle::handle(Item *x) : e(x) {}
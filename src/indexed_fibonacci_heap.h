@@ -0,0 +1,334 @@
+#ifndef INDEXED_FIBONACCI_HEAP_H
+#define INDEXED_FIBONACCI_HEAP_H
+
+#include <cassert>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include "fibonacci_forest.h"
+#include "utils.h"
+
+/**
+ * Fibonacci heap de elementos identificados por un id denso en [0, capacity()), como vértices o trabajos.
+ * Los nodos se piden todos juntos al construir, en un arreglo indexado por id:
+ * el id hace de handle, así no hace falta guardar handles aparte ni se pide memoria al insertar.
+ * - Cada id está a lo sumo una vez en el heap, contains(id) dice si está
+ * - La capacidad se fija al construir y no cambia
+ * - No hay join porque los ids de dos heaps se pisarían
+ * Asume de T:
+ * - tiene constructor por copia (con complejidad copy(T))
+ * Asume de Compare:
+ * - Compare()(a, b) (con complejidad cmp(T)) define una relación de orden débil, por defecto operador < de T
+ * - si es una clase vacía no ocupa lugar en el heap
+ * Asume de Allocator:
+ * - cumple los requisitos de allocator de la biblioteca estándar (se usa con rebind a Node para pedir el arreglo)
+ */
+template < typename T, typename Compare = std::less<T>, typename Allocator = std::allocator<T> >
+class indexed_fibonacci_heap {
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using value_compare = Compare;
+    using allocator_type = Allocator;
+
+    /**
+     * @brief Construye heap vacio para los ids en [0, capacity)
+     * @param capacity cantidad de ids
+     * @param comp comparador a usar
+     * @param alloc allocator a usar
+     *
+     * \complexity{\O(capacity)}
+     */
+    explicit indexed_fibonacci_heap(size_type capacity, const value_compare& comp = value_compare(), const allocator_type& alloc = allocator_type());
+
+    /**
+     * @brief Destructor
+     * \complexity{\O(capacity)}
+     */
+    ~indexed_fibonacci_heap();
+
+    /**
+     * @brief Constructor por copia, mantiene ids, capacidad y forma del árbol
+     * \complexity{\O(capacity)}
+     */
+    indexed_fibonacci_heap(const indexed_fibonacci_heap&);
+
+    /**
+     * @brief Operador de asignacion, toma también la capacidad de h
+     * \complexity{\O(capacity)}
+     */
+    indexed_fibonacci_heap& operator=(const indexed_fibonacci_heap&);
+
+    /**
+     * @brief Constructor por movimiento, h queda con capacidad 0
+     * \complexity{\O(1)}
+     */
+    indexed_fibonacci_heap(indexed_fibonacci_heap&& h) noexcept;
+
+    /**
+     * @brief Operador de asignacion por movimiento
+     * \complexity{\O(capacity)}
+     */
+    indexed_fibonacci_heap& operator=(indexed_fibonacci_heap&& h) noexcept;
+
+    /**
+     * @brief Remueve todos los elementos, la capacidad no cambia
+     *
+     * \complexity{\O(n)}
+     */
+    void clear();
+
+    /**
+     * @brief Intercambia los elementos y capacidades de 2 heaps
+     * @param h heap a intercambiar
+     * \pre los allocators se propagan en swap o son iguales
+     *
+     * \complexity{\O(1)}
+     */
+    void swap(indexed_fibonacci_heap& h);
+
+    /**
+     * @brief Devuelve copia del allocator
+     *
+     * \complexity{\O(1)}
+     */
+    allocator_type get_allocator() const;
+
+    /**
+     * @brief Devuelve copia del comparador
+     *
+     * \complexity{\O(1)}
+     */
+    value_compare value_comp() const;
+
+    /**
+     * @returns true \IFF size() == 0
+     *
+     * \complexity{\O(1)}
+     */
+    bool empty() const;
+
+    /**
+     * @returns cantidad de elementos
+     *
+     * \complexity{\O(1)}
+     */
+    size_type size() const;
+
+    /**
+     * @returns cantidad de ids, los válidos son los de [0, capacity())
+     *
+     * \complexity{\O(1)}
+     */
+    size_type capacity() const;
+
+    /**
+     * @param id id a consultar
+     * \pre id < capacity()
+     *
+     * @returns true \IFF id está en el heap
+     *
+     * \complexity{\O(1)}
+     */
+    bool contains(size_type id) const;
+
+    /**
+     * @brief Acceso al elemento de un id
+     * @param id id del elemento
+     * \pre contains(id)
+     *
+     * @returns referencia constante al elemento
+     *
+     * \complexity{\O(1)}
+     */
+    const value_type& key_of(size_type id) const;
+
+    /**
+     * @brief Acceso al minimo elemento
+     * \pre !empty()
+     *
+     * @returns referencia constante al minimo
+     *
+     * \complexity{\O(1)}
+     */
+    const value_type& minimum() const;
+
+    /**
+     * @returns id del minimo elemento
+     * \pre !empty()
+     *
+     * \complexity{\O(1)}
+     */
+    size_type min_id() const;
+
+    /**
+     * @brief Inserción sin pedir memoria
+     * @param id id del elemento
+     * @param val elemento a insertar
+     * \pre id < capacity() \AND !contains(id)
+     *
+     * \complexity{\O(1)}
+     */
+    void insert(size_type id, const value_type& val);
+
+    /**
+     * @brief Inserción moviendo el elemento
+     * @param id id del elemento
+     * @param val elemento a insertar, queda en estado válido pero no especificado
+     * \pre id < capacity() \AND !contains(id)
+     *
+     * \complexity{\O(1)}
+     */
+    void insert(size_type id, value_type&& val);
+
+    /**
+     * @brief Inserción construyendo el elemento dentro del nodo de id
+     * @param id id del elemento
+     * @param args argumentos para el constructor de T
+     * \pre id < capacity() \AND !contains(id)
+     *
+     * \complexity{\O(1)} más la construcción de T
+     */
+    template < typename... Args >
+    void emplace(size_type id, Args&&... args);
+
+    /**
+     * @brief Remover minimo
+     * \complexity{\O(log(n) amortizado)}
+     */
+    void extract_min();
+
+    /**
+     * @brief Remover minimo devolviéndolo junto a su id
+     * El elemento se mueve fuera del nodo antes de destruirlo
+     * \pre !empty()
+     *
+     * @returns par (id, elemento) del que era el minimo
+     *
+     * \complexity{\O(log(n) amortizado)}
+     */
+    std::pair<size_type, value_type> pop_min();
+
+    /**
+     * @brief Eliminar el elemento de un id
+     * @param id id del elemento
+     * \pre contains(id)
+     * \post !contains(id)
+     *
+     * \complexity{\O(log(n) amortizado)}
+     */
+    void erase(size_type id);
+
+    /**
+     * @brief Decrementar el elemento de un id
+     * @param id id del elemento
+     * @param val nuevo valor del elemento
+     * \pre contains(id) \AND value_comp()(\P{val}, key_of(id))
+     * \post key_of(id) == \P{val}
+     *
+     * \complexity{\O(1) amortizado}
+     */
+    void decrease_key(size_type id, const value_type& val);
+
+    /**
+     * @brief Decrementar el elemento de un id moviendo el nuevo valor
+     * @param id id del elemento
+     * @param val nuevo valor del elemento, queda en estado válido pero no especificado
+     * \pre contains(id) \AND value_comp()(\P{val}, key_of(id))
+     *
+     * \complexity{\O(1) amortizado}
+     */
+    void decrease_key(size_type id, value_type&& val);
+
+private:
+
+    /**
+     * Posición del arreglo:
+     * - Tiene los enlaces de fibonacci_links, que fuera del heap quedan como los de un nodo recién creado
+     * - La clave, construida solo si contained (que va antes para ocupar el relleno al final de los enlaces)
+     */
+    struct Node : fibonacci_links<Node> {
+
+        /**
+         * @brief crear posición sin elemento
+         *
+         * \complexity{\O(1)}
+         */
+        Node();
+
+        T& key() { return *reinterpret_cast<T*>(&storage); }
+        const T& key() const { return *reinterpret_cast<const T*>(&storage); }
+
+        /** @{ */
+        bool contained;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+        /** @} */
+    };
+
+    /**
+     * Compara nodos por su clave con Compare
+     */
+    struct node_compare : ebo_holder<Compare> {
+        node_compare() = default;
+        explicit node_compare(const Compare& comp);
+        bool operator()(const Node* a, const Node* b) const;
+    };
+
+    using forest_type = fibonacci_forest<Node, node_compare>;
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    /**
+     * @brief Compara claves con el comparador del heap
+     *
+     * @returns true \IFF a va antes que b
+     *
+     * \complexity{\O(cmp(T))}
+     */
+    bool precedes(const value_type& a, const value_type& b) const;
+
+    /**
+     * @brief Destruir la clave de un nodo que ya salió del bosque y dejarlo libre
+     * @param x nodo a liberar
+     *
+     * \complexity{\O(1)}
+     */
+    void release_node(Node* x);
+
+    /**
+     * @brief Pedir el arreglo de capacity posiciones libres
+     * \pre nodes == nullptr
+     *
+     * \complexity{\O(capacity)}
+     */
+    void allocate_nodes(size_type capacity);
+
+    /**
+     * @brief Devolver el arreglo al allocator
+     * \pre empty()
+     *
+     * \complexity{\O(capacity)}
+     */
+    void deallocate_nodes();
+
+    /**
+     * @brief copiar los elementos de h en las mismas posiciones, manteniendo la forma de sus árboles
+     * @param h heap a copiar
+     * \pre empty() \AND capacity() == h.capacity()
+     *
+     * \complexity{\O(n)}
+     */
+    void clone_from(const indexed_fibonacci_heap& h);
+
+    /** @{ */
+    forest_type forest;
+    node_allocator alloc;
+    Node* nodes;
+    size_type cap;
+    /** @} */
+};
+
+#include "indexed_fibonacci_heap.hpp"
+
+#endif //INDEXED_FIBONACCI_HEAP_H
@@ -0,0 +1,246 @@
+#include "indexed_fibonacci_heap.h"
+
+template<typename T, typename Compare, typename Allocator>
+indexed_fibonacci_heap<T, Compare, Allocator>::indexed_fibonacci_heap(size_type capacity, const value_compare &comp, const allocator_type &alloc) : forest(node_compare(comp)), alloc(alloc), nodes(nullptr), cap(0) {
+    allocate_nodes(capacity);
+}
+
+template<typename T, typename Compare, typename Allocator>
+indexed_fibonacci_heap<T, Compare, Allocator>::~indexed_fibonacci_heap() {
+    clear();
+    deallocate_nodes();
+}
+
+template<typename T, typename Compare, typename Allocator>
+indexed_fibonacci_heap<T, Compare, Allocator>::indexed_fibonacci_heap(const indexed_fibonacci_heap &h) : forest(h.forest.node_comp()), alloc(node_traits::select_on_container_copy_construction(h.alloc)), nodes(nullptr), cap(0) {
+    allocate_nodes(h.cap);
+    try{
+        clone_from(h);
+    }catch(...){
+        deallocate_nodes();
+        throw;
+    }
+}
+
+template<typename T, typename Compare, typename Allocator>
+indexed_fibonacci_heap<T, Compare, Allocator> &indexed_fibonacci_heap<T, Compare, Allocator>::operator=(const indexed_fibonacci_heap &h) {
+    if(this != &h){
+        clear();
+        forest.node_comp() = h.forest.node_comp();
+        if(node_traits::propagate_on_container_copy_assignment::value && alloc != h.alloc){
+            deallocate_nodes();
+            alloc = h.alloc;
+        }
+        if(cap != h.cap){
+            deallocate_nodes();
+            allocate_nodes(h.cap);
+        }
+        clone_from(h);
+    }
+    return *this;
+}
+
+template<typename T, typename Compare, typename Allocator>
+indexed_fibonacci_heap<T, Compare, Allocator>::indexed_fibonacci_heap(indexed_fibonacci_heap &&h) noexcept : forest(std::move(h.forest)), alloc(h.alloc), nodes(h.nodes), cap(h.cap) {
+    h.nodes = nullptr;
+    h.cap = 0;
+}
+
+template<typename T, typename Compare, typename Allocator>
+indexed_fibonacci_heap<T, Compare, Allocator> &indexed_fibonacci_heap<T, Compare, Allocator>::operator=(indexed_fibonacci_heap &&h) noexcept {
+    clear();
+    deallocate_nodes();
+    if(node_traits::propagate_on_container_move_assignment::value){
+        alloc = h.alloc;
+    }
+    // El arreglo de h se libera con este allocator
+    assert(h.nodes == nullptr || alloc == h.alloc);
+    forest.swap(h.forest);
+    std::swap(nodes, h.nodes);
+    std::swap(cap, h.cap);
+    return *this;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void indexed_fibonacci_heap<T, Compare, Allocator>::clear() {
+    forest.clear([this](Node* x){ release_node(x); });
+}
+
+template<typename T, typename Compare, typename Allocator>
+void indexed_fibonacci_heap<T, Compare, Allocator>::swap(indexed_fibonacci_heap &h) {
+    if(node_traits::propagate_on_container_swap::value){
+        std::swap(alloc, h.alloc);
+    }
+    assert(alloc == h.alloc);
+    forest.swap(h.forest);
+    std::swap(nodes, h.nodes);
+    std::swap(cap, h.cap);
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename indexed_fibonacci_heap<T, Compare, Allocator>::allocator_type indexed_fibonacci_heap<T, Compare, Allocator>::get_allocator() const {
+    return allocator_type(alloc);
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename indexed_fibonacci_heap<T, Compare, Allocator>::value_compare indexed_fibonacci_heap<T, Compare, Allocator>::value_comp() const {
+    return forest.node_comp().get();
+}
+
+template<typename T, typename Compare, typename Allocator>
+bool indexed_fibonacci_heap<T, Compare, Allocator>::empty() const {
+    return forest.empty();
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename indexed_fibonacci_heap<T, Compare, Allocator>::size_type indexed_fibonacci_heap<T, Compare, Allocator>::size() const {
+    return forest.size();
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename indexed_fibonacci_heap<T, Compare, Allocator>::size_type indexed_fibonacci_heap<T, Compare, Allocator>::capacity() const {
+    return cap;
+}
+
+template<typename T, typename Compare, typename Allocator>
+bool indexed_fibonacci_heap<T, Compare, Allocator>::contains(size_type id) const {
+    assert(id < cap);
+    return nodes[id].contained;
+}
+
+template<typename T, typename Compare, typename Allocator>
+const typename indexed_fibonacci_heap<T, Compare, Allocator>::value_type &indexed_fibonacci_heap<T, Compare, Allocator>::key_of(size_type id) const {
+    assert(contains(id));
+    return nodes[id].key();
+}
+
+template<typename T, typename Compare, typename Allocator>
+const typename indexed_fibonacci_heap<T, Compare, Allocator>::value_type &indexed_fibonacci_heap<T, Compare, Allocator>::minimum() const {
+    assert(!empty());
+    return forest.top()->key();
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename indexed_fibonacci_heap<T, Compare, Allocator>::size_type indexed_fibonacci_heap<T, Compare, Allocator>::min_id() const {
+    assert(!empty());
+    return static_cast<size_type>(forest.top() - nodes);
+}
+
+template<typename T, typename Compare, typename Allocator>
+void indexed_fibonacci_heap<T, Compare, Allocator>::insert(size_type id, const value_type &val) {
+    emplace(id, val);
+}
+
+template<typename T, typename Compare, typename Allocator>
+void indexed_fibonacci_heap<T, Compare, Allocator>::insert(size_type id, value_type &&val) {
+    emplace(id, std::move(val));
+}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename... Args>
+void indexed_fibonacci_heap<T, Compare, Allocator>::emplace(size_type id, Args &&... args) {
+    assert(id < cap && !nodes[id].contained);
+    Node* x = nodes + id;
+    node_traits::construct(alloc, &x->key(), std::forward<Args>(args)...);
+    x->contained = true;
+    forest.push(x);
+}
+
+template<typename T, typename Compare, typename Allocator>
+void indexed_fibonacci_heap<T, Compare, Allocator>::extract_min() {
+    if(!empty()){
+        release_node(forest.pop());
+    }
+}
+
+template<typename T, typename Compare, typename Allocator>
+std::pair<typename indexed_fibonacci_heap<T, Compare, Allocator>::size_type, typename indexed_fibonacci_heap<T, Compare, Allocator>::value_type> indexed_fibonacci_heap<T, Compare, Allocator>::pop_min() {
+    assert(!empty());
+    Node* x = forest.pop();
+    std::pair<size_type, value_type> res(static_cast<size_type>(x - nodes), std::move(x->key()));
+    release_node(x);
+    return res;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void indexed_fibonacci_heap<T, Compare, Allocator>::erase(size_type id) {
+    assert(contains(id));
+    Node* x = nodes + id;
+    forest.erase(x);
+    release_node(x);
+}
+
+template<typename T, typename Compare, typename Allocator>
+void indexed_fibonacci_heap<T, Compare, Allocator>::decrease_key(size_type id, const value_type &val) {
+    assert(contains(id) && precedes(val, nodes[id].key()));
+    nodes[id].key() = val;
+    forest.decreased(nodes + id);
+}
+
+template<typename T, typename Compare, typename Allocator>
+void indexed_fibonacci_heap<T, Compare, Allocator>::decrease_key(size_type id, value_type &&val) {
+    assert(contains(id) && precedes(val, nodes[id].key()));
+    nodes[id].key() = std::move(val);
+    forest.decreased(nodes + id);
+}
+
+template<typename T, typename Compare, typename Allocator>
+bool indexed_fibonacci_heap<T, Compare, Allocator>::precedes(const value_type &a, const value_type &b) const {
+    return forest.node_comp().get()(a, b);
+}
+
+template<typename T, typename Compare, typename Allocator>
+void indexed_fibonacci_heap<T, Compare, Allocator>::release_node(Node *x) {
+    node_traits::destroy(alloc, &x->key());
+    x->contained = false;
+    x->reset();
+}
+
+template<typename T, typename Compare, typename Allocator>
+void indexed_fibonacci_heap<T, Compare, Allocator>::allocate_nodes(size_type capacity) {
+    assert(nodes == nullptr);
+    if(capacity == 0){
+        return;
+    }
+    nodes = node_traits::allocate(alloc, capacity);
+    for (size_type i = 0; i < capacity; ++i) {
+        node_traits::construct(alloc, nodes + i);
+    }
+    cap = capacity;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void indexed_fibonacci_heap<T, Compare, Allocator>::deallocate_nodes() {
+    assert(empty());
+    if(nodes == nullptr){
+        return;
+    }
+    for (size_type i = 0; i < cap; ++i) {
+        node_traits::destroy(alloc, nodes + i);
+    }
+    node_traits::deallocate(alloc, nodes, cap);
+    nodes = nullptr;
+    cap = 0;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void indexed_fibonacci_heap<T, Compare, Allocator>::clone_from(const indexed_fibonacci_heap &h) {
+    assert(empty() && cap == h.cap);
+    forest.clone(h.forest, [this, &h](const Node* x){
+        Node* y = nodes + (x - h.nodes);
+        node_traits::construct(alloc, &y->key(), x->key());
+        y->contained = true;
+        return y;
+    }, [this](Node* y){ release_node(y); });
+}
+
+template<typename T, typename Compare, typename Allocator>
+indexed_fibonacci_heap<T, Compare, Allocator>::Node::Node() : fibonacci_links<Node>(), contained(false) {}
+
+template<typename T, typename Compare, typename Allocator>
+indexed_fibonacci_heap<T, Compare, Allocator>::node_compare::node_compare(const Compare &comp) : ebo_holder<Compare>(comp) {}
+
+template<typename T, typename Compare, typename Allocator>
+bool indexed_fibonacci_heap<T, Compare, Allocator>::node_compare::operator()(const Node *a, const Node *b) const {
+    return this->get()(a->key(), b->key());
+}
@@ -0,0 +1,33 @@
+#include "instrumented_fibonacci_heap.h"
+
+void heap_latencies::reset() {
+    insert.reset();
+    extract_min.reset();
+    decrease_key.reset();
+    delete_key.reset();
+    join.reset();
+}
+
+void heap_latencies::write_text(std::ostream &os) const {
+    double ns = tick_clock::ns_per_tick();
+    insert.write_text(os, "insert", ns);
+    extract_min.write_text(os, "extract_min", ns);
+    decrease_key.write_text(os, "decrease_key", ns);
+    delete_key.write_text(os, "delete_key", ns);
+    join.write_text(os, "join", ns);
+}
+
+void heap_latencies::write_json(std::ostream &os) const {
+    double ns = tick_clock::ns_per_tick();
+    os << "{\"insert\": ";
+    insert.write_json(os, ns);
+    os << ", \"extract_min\": ";
+    extract_min.write_json(os, ns);
+    os << ", \"decrease_key\": ";
+    decrease_key.write_json(os, ns);
+    os << ", \"delete_key\": ";
+    delete_key.write_json(os, ns);
+    os << ", \"join\": ";
+    join.write_json(os, ns);
+    os << "}";
+}
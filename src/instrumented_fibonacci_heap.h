@@ -0,0 +1,203 @@
+#ifndef INSTRUMENTED_FIBONACCI_HEAP_H
+#define INSTRUMENTED_FIBONACCI_HEAP_H
+
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <utility>
+#include "fibonacci_heap.h"
+#include "latency_histogram.h"
+
+/**
+ * Latencias de cada operación pública de un heap instrumentado
+ */
+struct heap_latencies {
+    /** @{ */
+    latency_histogram insert;
+    latency_histogram extract_min;
+    latency_histogram decrease_key;
+    latency_histogram delete_key;
+    latency_histogram join;
+    /** @} */
+
+    /**
+     * @brief Vaciar todos los histogramas
+     *
+     * \complexity{\O(1)}
+     */
+    void reset();
+
+    /**
+     * @brief Escribir una línea por operación con cantidad, promedio, p50, p99, p99.9 y maximo en nanosegundos
+     * @param os stream de salida
+     *
+     * \complexity{\O(1)}
+     */
+    void write_text(std::ostream& os) const;
+
+    /**
+     * @brief Escribir un objeto JSON con un objeto por operación
+     * @param os stream de salida
+     *
+     * \complexity{\O(1)}
+     */
+    void write_json(std::ostream& os) const;
+};
+
+/**
+ * fibonacci_heap que mide cuánto tarda cada insert, extract_min (y pop_min), decrease_key, delete_key y join.
+ * - Cada operación lee tick_clock dos veces y registra la diferencia en un latency_histogram,
+ *   sin pedir memoria, así se puede dejar prendido en builds de prueba
+ * - El resto de la interfaz es la de fibonacci_heap y no se mide
+ * - Ocupa unos 75 KiB más que el heap por los histogramas
+ * Asume lo mismo de T, Compare, Allocator y Stats que fibonacci_heap
+ */
+template < typename T, typename Compare = std::less<T>, typename Allocator = std::allocator<T>, typename Stats = no_stats >
+class instrumented_fibonacci_heap {
+public:
+    using heap_type = fibonacci_heap<T, Compare, Allocator, Stats>;
+    using value_type = typename heap_type::value_type;
+    using size_type = typename heap_type::size_type;
+    using value_compare = typename heap_type::value_compare;
+    using allocator_type = typename heap_type::allocator_type;
+    using handle = typename heap_type::handle;
+
+    /**
+     * @brief Construye heap vacio
+     * \complexity{\O(1)}
+     */
+    instrumented_fibonacci_heap();
+
+    /**
+     * @brief Construye heap vacio que ordena con comp
+     * @param comp comparador a usar
+     * @param alloc allocator a usar
+     *
+     * \complexity{\O(1)}
+     */
+    explicit instrumented_fibonacci_heap(const value_compare& comp, const allocator_type& alloc = allocator_type());
+
+    /**
+     * @returns referencia constante al heap medido
+     *
+     * \complexity{\O(1)}
+     */
+    const heap_type& heap() const;
+
+    /**
+     * @returns referencia constante a las latencias medidas hasta ahora
+     *
+     * \complexity{\O(1)}
+     */
+    const heap_latencies& latencies() const;
+
+    /**
+     * @brief Vaciar los histogramas de latencias
+     *
+     * \complexity{\O(1)}
+     */
+    void reset_latencies();
+
+    /**
+     * @brief Remueve todos los elementos, no se mide
+     *
+     * \complexity{\O(n)}
+     */
+    void clear();
+
+    /**
+     * @returns true \IFF size() == 0
+     *
+     * \complexity{\O(1)}
+     */
+    bool empty() const;
+
+    /**
+     * @returns cantidad de elementos
+     *
+     * \complexity{\O(1)}
+     */
+    size_type size() const;
+
+    /**
+     * @returns referencia constante al minimo
+     *
+     * \complexity{\O(1)}
+     */
+    const value_type& minimum() const;
+
+    /**
+     * @brief Inserción medida
+     * @param val elemento a insertar
+     *
+     * @returns handle que apunta al elemento insertado
+     *
+     * \complexity{\O(1)}
+     */
+    handle insert(const value_type& val);
+    handle insert(value_type&& val);
+
+    /**
+     * @brief Inserción construyendo el elemento dentro del nodo, se mide como insert
+     * @param args argumentos para el constructor de T
+     *
+     * @returns handle que apunta al elemento insertado
+     *
+     * \complexity{\O(1)} más la construcción de T
+     */
+    template < typename... Args >
+    handle emplace(Args&&... args);
+
+    /**
+     * @brief Remover minimo medido
+     * \complexity{\O(log(n) amortizado)}
+     */
+    void extract_min();
+
+    /**
+     * @brief Remover minimo devolviéndolo, se mide como extract_min
+     * \pre !empty()
+     *
+     * \complexity{\O(log(n) amortizado)}
+     */
+    value_type pop_min();
+
+    /**
+     * @brief Eliminar elemento medido
+     * @param x handle que apunta al elemento a eliminar
+     *
+     * \complexity{\O(log(n) amortizado)}
+     */
+    void delete_key(handle& x);
+
+    /**
+     * @brief Decrementar elemento medido
+     * @param x handle que apunta al elemento a decrementar
+     * @param val nuevo valor del elemento
+     * \pre value_comp()(\P{val}, *\P{x})
+     *
+     * \complexity{\O(1) amortizado}
+     */
+    void decrease_key(const handle& x, const value_type& val);
+    void decrease_key(const handle& x, value_type&& val);
+
+    /**
+     * @brief Une 2 heaps medido, las latencias de h no cambian
+     * @param h heap a unir que queda vacio
+     * \pre h.empty() \LOR los allocators son iguales
+     *
+     * \complexity{\O(1)}
+     */
+    void join(instrumented_fibonacci_heap& h);
+
+private:
+
+    /** @{ */
+    heap_type inner;
+    heap_latencies timings;
+    /** @} */
+};
+
+#include "instrumented_fibonacci_heap.hpp"
+
+#endif //INSTRUMENTED_FIBONACCI_HEAP_H
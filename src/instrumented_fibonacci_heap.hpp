@@ -0,0 +1,110 @@
+#include "instrumented_fibonacci_heap.h"
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+instrumented_fibonacci_heap<T, Compare, Allocator, Stats>::instrumented_fibonacci_heap() : inner(), timings() {}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+instrumented_fibonacci_heap<T, Compare, Allocator, Stats>::instrumented_fibonacci_heap(const value_compare &comp, const allocator_type &alloc) : inner(comp, alloc), timings() {}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+const typename instrumented_fibonacci_heap<T, Compare, Allocator, Stats>::heap_type &instrumented_fibonacci_heap<T, Compare, Allocator, Stats>::heap() const {
+    return inner;
+}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+const heap_latencies &instrumented_fibonacci_heap<T, Compare, Allocator, Stats>::latencies() const {
+    return timings;
+}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+void instrumented_fibonacci_heap<T, Compare, Allocator, Stats>::reset_latencies() {
+    timings.reset();
+}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+void instrumented_fibonacci_heap<T, Compare, Allocator, Stats>::clear() {
+    inner.clear();
+}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+bool instrumented_fibonacci_heap<T, Compare, Allocator, Stats>::empty() const {
+    return inner.empty();
+}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+typename instrumented_fibonacci_heap<T, Compare, Allocator, Stats>::size_type instrumented_fibonacci_heap<T, Compare, Allocator, Stats>::size() const {
+    return inner.size();
+}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+const typename instrumented_fibonacci_heap<T, Compare, Allocator, Stats>::value_type &instrumented_fibonacci_heap<T, Compare, Allocator, Stats>::minimum() const {
+    return inner.minimum();
+}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+typename instrumented_fibonacci_heap<T, Compare, Allocator, Stats>::handle instrumented_fibonacci_heap<T, Compare, Allocator, Stats>::insert(const value_type &val) {
+    std::uint64_t start = tick_clock::now();
+    handle res = inner.insert(val);
+    timings.insert.record(tick_clock::now() - start);
+    return res;
+}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+typename instrumented_fibonacci_heap<T, Compare, Allocator, Stats>::handle instrumented_fibonacci_heap<T, Compare, Allocator, Stats>::insert(value_type &&val) {
+    std::uint64_t start = tick_clock::now();
+    handle res = inner.insert(std::move(val));
+    timings.insert.record(tick_clock::now() - start);
+    return res;
+}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+template<typename... Args>
+typename instrumented_fibonacci_heap<T, Compare, Allocator, Stats>::handle instrumented_fibonacci_heap<T, Compare, Allocator, Stats>::emplace(Args &&... args) {
+    std::uint64_t start = tick_clock::now();
+    handle res = inner.emplace(std::forward<Args>(args)...);
+    timings.insert.record(tick_clock::now() - start);
+    return res;
+}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+void instrumented_fibonacci_heap<T, Compare, Allocator, Stats>::extract_min() {
+    std::uint64_t start = tick_clock::now();
+    inner.extract_min();
+    timings.extract_min.record(tick_clock::now() - start);
+}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+typename instrumented_fibonacci_heap<T, Compare, Allocator, Stats>::value_type instrumented_fibonacci_heap<T, Compare, Allocator, Stats>::pop_min() {
+    std::uint64_t start = tick_clock::now();
+    value_type res = inner.pop_min();
+    timings.extract_min.record(tick_clock::now() - start);
+    return res;
+}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+void instrumented_fibonacci_heap<T, Compare, Allocator, Stats>::delete_key(handle &x) {
+    std::uint64_t start = tick_clock::now();
+    inner.delete_key(x);
+    timings.delete_key.record(tick_clock::now() - start);
+}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+void instrumented_fibonacci_heap<T, Compare, Allocator, Stats>::decrease_key(const handle &x, const value_type &val) {
+    std::uint64_t start = tick_clock::now();
+    inner.decrease_key(x, val);
+    timings.decrease_key.record(tick_clock::now() - start);
+}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+void instrumented_fibonacci_heap<T, Compare, Allocator, Stats>::decrease_key(const handle &x, value_type &&val) {
+    std::uint64_t start = tick_clock::now();
+    inner.decrease_key(x, std::move(val));
+    timings.decrease_key.record(tick_clock::now() - start);
+}
+
+template<typename T, typename Compare, typename Allocator, typename Stats>
+void instrumented_fibonacci_heap<T, Compare, Allocator, Stats>::join(instrumented_fibonacci_heap &h) {
+    std::uint64_t start = tick_clock::now();
+    inner.join(h.inner);
+    timings.join.record(tick_clock::now() - start);
+}
@@ -0,0 +1,226 @@
+#ifndef INTRUSIVE_FIBONACCI_HEAP_H
+#define INTRUSIVE_FIBONACCI_HEAP_H
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include "fibonacci_forest.h"
+#include "utils.h"
+
+/**
+ * Enlaces de fibonacci heap para poner como miembro de un objeto propio (ver intrusive_fibonacci_heap).
+ * Un objeto puede estar en varios heaps a la vez si tiene un hook por cada uno.
+ * owner apunta al objeto que contiene el hook, lo escribe insert: así el heap llega del hook al objeto
+ * sin aritmética de punteros sobre T
+ */
+struct fibonacci_hook : fibonacci_links<fibonacci_hook> {
+    fibonacci_hook() : fibonacci_links<fibonacci_hook>(), owner(nullptr) {}
+
+    /**
+     * @brief Copiar el objeto dueño no copia los enlaces: el hook nuevo queda libre
+     * (también al mover, ya que no hay constructor por movimiento)
+     *
+     * \complexity{\O(1)}
+     */
+    fibonacci_hook(const fibonacci_hook&) : fibonacci_links<fibonacci_hook>(), owner(nullptr) {}
+
+    /**
+     * @brief Asignar el objeto dueño no toca los enlaces: un hook libre sigue libre
+     * y uno que está en un heap sigue en él
+     *
+     * \complexity{\O(1)}
+     */
+    fibonacci_hook& operator=(const fibonacci_hook&) { return *this; }
+
+    /** @{ */
+    void* owner;
+    /** @} */
+};
+
+/**
+ * Fibonacci heap intrusivo: los enlaces de cada elemento viven en el miembro Hook del objeto,
+ * el heap no pide ni libera memoria y el objeto mismo hace de handle.
+ * - Los objetos los crea y destruye quien usa el heap, y tienen que vivir mientras estén en el heap
+ * - Un objeto está en a lo sumo un heap por hook
+ * - Al sacar un objeto (pop_min, erase, clear o destrucción del heap) su hook queda listo para insertarlo de nuevo
+ * - No se puede copiar porque los objetos no pueden estar en dos heaps con el mismo hook
+ * Asume de T:
+ * - tiene un miembro de tipo fibonacci_hook apuntado por Hook
+ * Asume de Compare:
+ * - Compare()(a, b) con a, b de tipo const T& define una relación de orden débil, por defecto operador <
+ * - si es una clase vacía no ocupa lugar en el heap
+ */
+template < typename T, fibonacci_hook T::*Hook, typename Compare = std::less<T> >
+class intrusive_fibonacci_heap {
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using value_compare = Compare;
+
+    /**
+     * @brief Construye heap vacio
+     * \complexity{\O(1)}
+     */
+    intrusive_fibonacci_heap();
+
+    /**
+     * @brief Construye heap vacio que ordena con comp
+     * @param comp comparador a usar
+     *
+     * \complexity{\O(1)}
+     */
+    explicit intrusive_fibonacci_heap(const value_compare& comp);
+
+    /**
+     * @brief Destructor, saca todos los objetos sin destruirlos
+     * \complexity{\O(n)}
+     */
+    ~intrusive_fibonacci_heap();
+
+    intrusive_fibonacci_heap(const intrusive_fibonacci_heap&) = delete;
+    intrusive_fibonacci_heap& operator=(const intrusive_fibonacci_heap&) = delete;
+
+    /**
+     * @brief Constructor por movimiento, h queda vacio
+     * \complexity{\O(1)}
+     */
+    intrusive_fibonacci_heap(intrusive_fibonacci_heap&& h) noexcept;
+
+    /**
+     * @brief Operador de asignacion por movimiento, los objetos que había se sacan
+     * \complexity{\O(n)}
+     */
+    intrusive_fibonacci_heap& operator=(intrusive_fibonacci_heap&& h) noexcept;
+
+    /**
+     * @brief Saca todos los objetos sin destruirlos
+     *
+     * \complexity{\O(n)}
+     */
+    void clear();
+
+    /**
+     * @brief Intercambia los objetos de 2 heaps
+     * @param h heap a intercambiar
+     *
+     * \complexity{\O(1)}
+     */
+    void swap(intrusive_fibonacci_heap& h);
+
+    /**
+     * @brief Devuelve copia del comparador
+     *
+     * \complexity{\O(1)}
+     */
+    value_compare value_comp() const;
+
+    /**
+     * @returns true \IFF size() == 0
+     *
+     * \complexity{\O(1)}
+     */
+    bool empty() const;
+
+    /**
+     * @returns cantidad de objetos
+     *
+     * \complexity{\O(1)}
+     */
+    size_type size() const;
+
+    /**
+     * @brief Acceso al minimo objeto
+     * \pre !empty()
+     *
+     * @returns referencia al minimo, no se debe modificar su clave
+     *
+     * \complexity{\O(1)}
+     */
+    T& minimum() const;
+
+    /**
+     * @brief Inserción sin pedir memoria
+     * @param x objeto a insertar
+     * \pre el hook de x no está en ningún heap
+     *
+     * \complexity{\O(1)}
+     */
+    void insert(T& x);
+
+    /**
+     * @brief Remover minimo sin destruirlo
+     * \pre !empty()
+     *
+     * @returns referencia al objeto que era el minimo
+     *
+     * \complexity{\O(log(n) amortizado)}
+     */
+    T& pop_min();
+
+    /**
+     * @brief Remover minimo sin destruirlo
+     * \complexity{\O(log(n) amortizado)}
+     */
+    void extract_min();
+
+    /**
+     * @brief Sacar un objeto cualquiera sin destruirlo
+     * @param x objeto a sacar
+     * \pre x está en este heap
+     *
+     * \complexity{\O(log(n) amortizado)}
+     */
+    void erase(T& x);
+
+    /**
+     * @brief Reubicar un objeto cuya clave se acaba de decrementar
+     * @param x objeto que ya tiene su clave nueva
+     * \pre x está en este heap \AND su clave nueva no va después que la anterior según value_comp()
+     *
+     * \complexity{\O(1) amortizado}
+     */
+    void decrease_key(T& x);
+
+    /**
+     * @brief Une 2 heaps quedando todos los objetos en uno solo
+     * @param h heap a unir que queda vacio
+     *
+     * \complexity{\O(1)}
+     */
+    void join(intrusive_fibonacci_heap& h);
+
+private:
+
+    /**
+     * @returns hook de x
+     *
+     * \complexity{\O(1)}
+     */
+    static fibonacci_hook* hook_of(T& x);
+
+    /**
+     * @returns objeto que contiene al hook h, el que se guardó en owner al insertarlo
+     *
+     * \complexity{\O(1)}
+     */
+    static T* owner_of(const fibonacci_hook* h);
+
+    /**
+     * Compara hooks comparando los objetos que los contienen con Compare
+     */
+    struct hook_compare : ebo_holder<Compare> {
+        hook_compare() = default;
+        explicit hook_compare(const Compare& comp);
+        bool operator()(const fibonacci_hook* a, const fibonacci_hook* b) const;
+    };
+
+    using forest_type = fibonacci_forest<fibonacci_hook, hook_compare>;
+
+    /** @{ */
+    forest_type forest;
+    /** @} */
+};
+
+#include "intrusive_fibonacci_heap.hpp"
+
+#endif //INTRUSIVE_FIBONACCI_HEAP_H
@@ -0,0 +1,111 @@
+#include "intrusive_fibonacci_heap.h"
+
+template<typename T, fibonacci_hook T::*Hook, typename Compare>
+intrusive_fibonacci_heap<T, Hook, Compare>::intrusive_fibonacci_heap() : forest() {}
+
+template<typename T, fibonacci_hook T::*Hook, typename Compare>
+intrusive_fibonacci_heap<T, Hook, Compare>::intrusive_fibonacci_heap(const value_compare &comp) : forest(hook_compare(comp)) {}
+
+template<typename T, fibonacci_hook T::*Hook, typename Compare>
+intrusive_fibonacci_heap<T, Hook, Compare>::~intrusive_fibonacci_heap() {
+    clear();
+}
+
+template<typename T, fibonacci_hook T::*Hook, typename Compare>
+intrusive_fibonacci_heap<T, Hook, Compare>::intrusive_fibonacci_heap(intrusive_fibonacci_heap &&h) noexcept : forest(std::move(h.forest)) {}
+
+template<typename T, fibonacci_hook T::*Hook, typename Compare>
+intrusive_fibonacci_heap<T, Hook, Compare> &intrusive_fibonacci_heap<T, Hook, Compare>::operator=(intrusive_fibonacci_heap &&h) noexcept {
+    clear();
+    forest.swap(h.forest);
+    return *this;
+}
+
+template<typename T, fibonacci_hook T::*Hook, typename Compare>
+void intrusive_fibonacci_heap<T, Hook, Compare>::clear() {
+    forest.clear([](fibonacci_hook* x){ x->reset(); });
+}
+
+template<typename T, fibonacci_hook T::*Hook, typename Compare>
+void intrusive_fibonacci_heap<T, Hook, Compare>::swap(intrusive_fibonacci_heap &h) {
+    forest.swap(h.forest);
+}
+
+template<typename T, fibonacci_hook T::*Hook, typename Compare>
+typename intrusive_fibonacci_heap<T, Hook, Compare>::value_compare intrusive_fibonacci_heap<T, Hook, Compare>::value_comp() const {
+    return forest.node_comp().get();
+}
+
+template<typename T, fibonacci_hook T::*Hook, typename Compare>
+bool intrusive_fibonacci_heap<T, Hook, Compare>::empty() const {
+    return forest.empty();
+}
+
+template<typename T, fibonacci_hook T::*Hook, typename Compare>
+typename intrusive_fibonacci_heap<T, Hook, Compare>::size_type intrusive_fibonacci_heap<T, Hook, Compare>::size() const {
+    return forest.size();
+}
+
+template<typename T, fibonacci_hook T::*Hook, typename Compare>
+T &intrusive_fibonacci_heap<T, Hook, Compare>::minimum() const {
+    assert(!empty());
+    return *owner_of(forest.top());
+}
+
+template<typename T, fibonacci_hook T::*Hook, typename Compare>
+void intrusive_fibonacci_heap<T, Hook, Compare>::insert(T &x) {
+    fibonacci_hook* h = hook_of(x);
+    assert(h->parent == nullptr && h->child == nullptr && h->left == h && h->right == h);
+    h->owner = &x;
+    forest.push(h);
+}
+
+template<typename T, fibonacci_hook T::*Hook, typename Compare>
+T &intrusive_fibonacci_heap<T, Hook, Compare>::pop_min() {
+    assert(!empty());
+    fibonacci_hook* h = forest.pop();
+    h->reset();
+    return *owner_of(h);
+}
+
+template<typename T, fibonacci_hook T::*Hook, typename Compare>
+void intrusive_fibonacci_heap<T, Hook, Compare>::extract_min() {
+    if(!empty()){
+        pop_min();
+    }
+}
+
+template<typename T, fibonacci_hook T::*Hook, typename Compare>
+void intrusive_fibonacci_heap<T, Hook, Compare>::erase(T &x) {
+    fibonacci_hook* h = hook_of(x);
+    forest.erase(h);
+    h->reset();
+}
+
+template<typename T, fibonacci_hook T::*Hook, typename Compare>
+void intrusive_fibonacci_heap<T, Hook, Compare>::decrease_key(T &x) {
+    forest.decreased(hook_of(x));
+}
+
+template<typename T, fibonacci_hook T::*Hook, typename Compare>
+void intrusive_fibonacci_heap<T, Hook, Compare>::join(intrusive_fibonacci_heap &h) {
+    forest.merge(h.forest);
+}
+
+template<typename T, fibonacci_hook T::*Hook, typename Compare>
+fibonacci_hook *intrusive_fibonacci_heap<T, Hook, Compare>::hook_of(T &x) {
+    return &(x.*Hook);
+}
+
+template<typename T, fibonacci_hook T::*Hook, typename Compare>
+T *intrusive_fibonacci_heap<T, Hook, Compare>::owner_of(const fibonacci_hook *h) {
+    return static_cast<T*>(h->owner);
+}
+
+template<typename T, fibonacci_hook T::*Hook, typename Compare>
+intrusive_fibonacci_heap<T, Hook, Compare>::hook_compare::hook_compare(const Compare &comp) : ebo_holder<Compare>(comp) {}
+
+template<typename T, fibonacci_hook T::*Hook, typename Compare>
+bool intrusive_fibonacci_heap<T, Hook, Compare>::hook_compare::operator()(const fibonacci_hook *a, const fibonacci_hook *b) const {
+    return this->get()(*owner_of(a), *owner_of(b));
+}
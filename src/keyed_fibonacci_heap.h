@@ -0,0 +1,370 @@
+#ifndef KEYED_FIBONACCI_HEAP_H
+#define KEYED_FIBONACCI_HEAP_H
+
+#include <cassert>
+#include <functional>
+#include <memory>
+#include <utility>
+#include "fibonacci_forest.h"
+#include "utils.h"
+
+/**
+ * Implementación de min_priority_queue sobre min_fibonacci_heap separando prioridad y dato.
+ * Cada nodo guarda primero los enlaces y la prioridad (lo que recorre consolidate()) y después el dato,
+ * así un dato grande no ensucia las líneas de cache que se leen al comparar.
+ * Asume de Key:
+ * - tiene constructor por copia (con complejidad copy(Key))
+ * Asume de Value:
+ * - no se compara nunca, solo se construye, mueve y destruye
+ * Asume de Compare:
+ * - Compare()(a, b) (con complejidad cmp(Key)) define una relación de orden débil sobre Key, por defecto operador <
+ * - si es una clase vacía no ocupa lugar en el heap
+ * Asume de Allocator:
+ * - cumple los requisitos de allocator de la biblioteca estándar (se usa con rebind a Node)
+ */
+template < typename Key, typename Value, typename Compare = std::less<Key>, typename Allocator = std::allocator<std::pair<const Key, Value> > >
+class keyed_fibonacci_heap {
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using size_type = size_t;
+    using key_compare = Compare;
+    using allocator_type = Allocator;
+
+    class handle;
+
+    /**
+     * @brief Construye heap vacio
+     * \complexity{\O(1)}
+     */
+    keyed_fibonacci_heap();
+
+    /**
+     * @brief Construye heap vacio que ordena con comp
+     * @param comp comparador de prioridades
+     * @param alloc allocator a usar
+     *
+     * \complexity{\O(1)}
+     */
+    explicit keyed_fibonacci_heap(const key_compare& comp, const allocator_type& alloc = allocator_type());
+
+    /**
+     * @brief Construye heap vacio que pide los nodos a alloc
+     * @param alloc allocator a usar
+     *
+     * \complexity{\O(1)}
+     */
+    explicit keyed_fibonacci_heap(const allocator_type& alloc);
+
+    /**
+     * @brief Destructor
+     * \complexity{\O(n)}
+     */
+    ~keyed_fibonacci_heap();
+
+    /**
+     * @brief Constructor por copia
+     * \complexity{\O(n)}
+     */
+    keyed_fibonacci_heap(const keyed_fibonacci_heap&);
+
+    /**
+     * @brief Operador de asignacion
+     * \complexity{\O(n)}
+     */
+    keyed_fibonacci_heap& operator=(const keyed_fibonacci_heap&);
+
+    /**
+     * @brief Constructor por movimiento
+     * \complexity{\O(1)}
+     */
+    keyed_fibonacci_heap(keyed_fibonacci_heap&&) noexcept;
+
+    /**
+     * @brief Operador de asignacion por movimiento
+     * \complexity{\O(n)}
+     */
+    keyed_fibonacci_heap& operator=(keyed_fibonacci_heap&&) noexcept;
+
+    /**
+     * @brief Remueve todos los elementos
+     *
+     * \complexity{\O(n)}
+     */
+    void clear();
+
+    /**
+     * @brief Intercambia los elementos de 2 heaps
+     * @param h heap a intercambiar
+     * \pre los allocators se propagan en swap o son iguales
+     *
+     * \complexity{\O(1)}
+     */
+    void swap(keyed_fibonacci_heap& h);
+
+    /**
+     * @brief Devuelve copia del allocator
+     *
+     * \complexity{\O(1)}
+     */
+    allocator_type get_allocator() const;
+
+    /**
+     * @brief Devuelve copia del comparador de prioridades
+     *
+     * \complexity{\O(1)}
+     */
+    key_compare key_comp() const;
+
+    /**
+     * @returns true \IFF size() == 0
+     *
+     * \complexity{\O(1)}
+     */
+    bool empty() const;
+
+    /**
+     * @returns cantidad de elementos
+     *
+     * \complexity{\O(1)}
+     */
+    size_type size() const;
+
+    /**
+     * @brief Acceso a la prioridad minima
+     *
+     * @returns referencia constante a la prioridad del minimo
+     *
+     * \complexity{\O(1)}
+     */
+    const key_type& minimum() const;
+
+    /**
+     * @brief Acceso al dato del minimo
+     * El dato se puede modificar porque no participa del orden
+     *
+     * @returns referencia al dato del minimo
+     *
+     * \complexity{\O(1)}
+     */
+    mapped_type& minimum_value();
+    const mapped_type& minimum_value() const;
+
+    /**
+     * @brief Inserción
+     * @param key prioridad del elemento
+     * @param value dato del elemento
+     *
+     * @returns handle que apunta al elemento insertado
+     *
+     * \complexity{\O(1)}
+     */
+    handle insert(const key_type& key, const mapped_type& value);
+
+    /**
+     * @brief Inserción moviendo prioridad y dato
+     * @param key prioridad del elemento
+     * @param value dato del elemento
+     *
+     * @returns handle que apunta al elemento insertado
+     *
+     * \complexity{\O(1)}
+     */
+    handle insert(key_type&& key, mapped_type&& value);
+
+    /**
+     * @brief Inserción construyendo el dato dentro del nodo
+     * @param key prioridad del elemento
+     * @param args argumentos para el constructor de Value
+     *
+     * @returns handle que apunta al elemento insertado
+     *
+     * \complexity{\O(1)} más la construcción de Value
+     */
+    template < typename K, typename... Args >
+    handle emplace(K&& key, Args&&... args);
+
+    /**
+     * @brief Remover minimo
+     * \complexity{\O(log(n) amortizado)}
+     */
+    void extract_min();
+
+    /**
+     * @brief Remover minimo devolviendo prioridad y dato movidos fuera del nodo
+     * \pre !empty()
+     *
+     * \complexity{\O(log(n) amortizado)}
+     */
+    std::pair<key_type, mapped_type> pop_min();
+
+    /**
+     * @brief Eliminar elemento
+     * @param x handle que apunta al elemento a eliminar
+     *
+     * \complexity{\O(log(n) amortizado)}
+     */
+    void delete_key(handle& x);
+
+    /**
+     * @brief Decrementar prioridad, el dato no se toca
+     * @param x handle que apunta al elemento a decrementar
+     * @param key nueva prioridad del elemento
+     * \pre key_comp()(\P{key}, \P{x}.key())
+     * \post \P{x}.key() == \P{key} \AND el resto de la estructura no cambia
+     *
+     * \complexity{\O(1) amortizado}
+     */
+    void decrease_key(const handle& x, const key_type& key);
+
+    /**
+     * @brief Incrementar prioridad, nombre de decrease_key para max heaps (Compare = std::greater<Key>)
+     * @param x handle que apunta al elemento a incrementar
+     * @param key nueva prioridad del elemento
+     * \pre key_comp()(\P{key}, \P{x}.key())
+     *
+     * \complexity{\O(1) amortizado}
+     */
+    void increase_key(const handle& x, const key_type& key);
+
+    /**
+     * @brief Une 2 heaps quedando todos los elementos en uno solo
+     * @param h heap a unir que queda vacio
+     * \pre h.empty() \LOR get_allocator() == h.get_allocator()
+     *
+     * \complexity{\O(1)}
+     */
+    void join(keyed_fibonacci_heap& h);
+
+private:
+
+    /**
+     * Nodo de la estructura:
+     * - Tiene los enlaces de fibonacci_links (padre, hijos, hermanos, grado y marca)
+     * - Después la prioridad y al final el dato
+     */
+    struct Node : fibonacci_links<Node> {
+
+        /**
+         * @brief crear nodo que representa heap de un elemento
+         * @param key prioridad
+         * @param args argumentos para construir el dato
+         *
+         * \complexity{\O(1)} más la construcción de Key y Value
+         */
+        template < typename K, typename... Args >
+        explicit Node(K&& key, Args&&... args);
+
+        /** @{ */
+        key_type key;
+        mapped_type value;
+        /** @} */
+    };
+
+    /**
+     * Compara nodos por su prioridad con Compare
+     */
+    struct node_compare : ebo_holder<Compare> {
+        node_compare() = default;
+        explicit node_compare(const Compare& comp);
+        bool operator()(const Node* a, const Node* b) const;
+    };
+
+    using forest_type = fibonacci_forest<Node, node_compare>;
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    /**
+     * @brief Pedir y construir un nodo con el allocator
+     *
+     * \complexity{\O(1)} más la construcción de Key y Value
+     */
+    template < typename... Args >
+    Node* create_node(Args&&... args);
+
+    /**
+     * @brief Destruir un nodo y devolver su memoria al allocator
+     * @param x nodo a destruir
+     *
+     * \complexity{\O(1)}
+     */
+    void destroy_node(Node* x);
+
+    /**
+     * @brief Poner un nodo recién creado en el bosque
+     * @param node nodo a agregar
+     *
+     * @returns handle que apunta al nodo
+     *
+     * \complexity{\O(1)}
+     */
+    handle link_root(Node* node);
+
+    /**
+     * @brief copiar los nodos de h manteniendo la forma de sus árboles
+     * Si el allocator tiene reserve(n) se piden todos los nodos juntos
+     * @param h heap a copiar
+     * \pre empty()
+     *
+     * \complexity{\O(n)}
+     */
+    void clone_from(const keyed_fibonacci_heap& h);
+
+    /** @{ */
+    forest_type forest;
+    node_allocator alloc;
+    /** @} */
+};
+
+template < typename Key, typename Value, typename Compare, typename Allocator >
+class keyed_fibonacci_heap<Key, Value, Compare, Allocator>::handle {
+public:
+
+    /**
+     * @returns true \IFF apuntan al mismo elemento
+     *
+     * \complexity{\O(1)}
+     */
+    bool operator==(const handle& other) const;
+
+    /**
+     * @returns false \IFF apuntan al mismo elemento
+     *
+     * \complexity{\O(1)}
+     */
+    bool operator!=(const handle& other) const;
+
+    /**
+     * @brief Prioridad del elemento
+     * \pre El handle debe estar apuntando a un elemento.
+     *
+     * \complexity{\O(1)}
+     */
+    const key_type& key() const;
+
+    /**
+     * @brief Dato del elemento, modificable porque no participa del orden
+     * \pre El handle debe estar apuntando a un elemento.
+     *
+     * \complexity{\O(1)}
+     */
+    mapped_type& value() const;
+
+private:
+
+    friend class keyed_fibonacci_heap;
+
+    /**
+     * @brief Constructor
+     * @param x puntero al nodo que el handle estará ligado
+     */
+    handle(Node* x);
+
+    /** @{ */
+    Node* n;
+    /** @} */
+};
+
+#include "keyed_fibonacci_heap.hpp"
+
+#endif //KEYED_FIBONACCI_HEAP_H
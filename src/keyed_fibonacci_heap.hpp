@@ -0,0 +1,218 @@
+#include "keyed_fibonacci_heap.h"
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+keyed_fibonacci_heap<Key, Value, Compare, Allocator>::keyed_fibonacci_heap() : forest(), alloc() {}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+keyed_fibonacci_heap<Key, Value, Compare, Allocator>::keyed_fibonacci_heap(const key_compare &comp, const allocator_type &alloc) : forest(node_compare(comp)), alloc(alloc) {}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+keyed_fibonacci_heap<Key, Value, Compare, Allocator>::keyed_fibonacci_heap(const allocator_type &alloc) : forest(), alloc(alloc) {}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+keyed_fibonacci_heap<Key, Value, Compare, Allocator>::~keyed_fibonacci_heap() {
+    clear();
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+keyed_fibonacci_heap<Key, Value, Compare, Allocator>::keyed_fibonacci_heap(const keyed_fibonacci_heap &h) : forest(h.forest.node_comp()), alloc(node_traits::select_on_container_copy_construction(h.alloc)) {
+    clone_from(h);
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+keyed_fibonacci_heap<Key, Value, Compare, Allocator> &keyed_fibonacci_heap<Key, Value, Compare, Allocator>::operator=(const keyed_fibonacci_heap &h) {
+    if(this != &h){
+        clear();
+        forest.node_comp() = h.forest.node_comp();
+        if(node_traits::propagate_on_container_copy_assignment::value){
+            alloc = h.alloc;
+        }
+        clone_from(h);
+    }
+    return *this;
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+keyed_fibonacci_heap<Key, Value, Compare, Allocator>::keyed_fibonacci_heap(keyed_fibonacci_heap &&h) noexcept : forest(std::move(h.forest)), alloc(h.alloc) {}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+keyed_fibonacci_heap<Key, Value, Compare, Allocator> &keyed_fibonacci_heap<Key, Value, Compare, Allocator>::operator=(keyed_fibonacci_heap &&h) noexcept {
+    clear();
+    if(node_traits::propagate_on_container_move_assignment::value){
+        alloc = h.alloc;
+    }
+    assert(h.empty() || alloc == h.alloc);
+    forest.swap(h.forest);
+    return *this;
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+void keyed_fibonacci_heap<Key, Value, Compare, Allocator>::clear() {
+    forest.clear([this](Node* x){ destroy_node(x); });
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+void keyed_fibonacci_heap<Key, Value, Compare, Allocator>::swap(keyed_fibonacci_heap &h) {
+    if(node_traits::propagate_on_container_swap::value){
+        std::swap(alloc,h.alloc);
+    }
+    assert(alloc == h.alloc);
+    forest.swap(h.forest);
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+typename keyed_fibonacci_heap<Key, Value, Compare, Allocator>::allocator_type keyed_fibonacci_heap<Key, Value, Compare, Allocator>::get_allocator() const {
+    return allocator_type(alloc);
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+typename keyed_fibonacci_heap<Key, Value, Compare, Allocator>::key_compare keyed_fibonacci_heap<Key, Value, Compare, Allocator>::key_comp() const {
+    return forest.node_comp().get();
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+bool keyed_fibonacci_heap<Key, Value, Compare, Allocator>::empty() const {
+    return forest.empty();
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+typename keyed_fibonacci_heap<Key, Value, Compare, Allocator>::size_type keyed_fibonacci_heap<Key, Value, Compare, Allocator>::size() const {
+    return forest.size();
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+const typename keyed_fibonacci_heap<Key, Value, Compare, Allocator>::key_type &keyed_fibonacci_heap<Key, Value, Compare, Allocator>::minimum() const {
+    return forest.top()->key;
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+typename keyed_fibonacci_heap<Key, Value, Compare, Allocator>::mapped_type &keyed_fibonacci_heap<Key, Value, Compare, Allocator>::minimum_value() {
+    return forest.top()->value;
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+const typename keyed_fibonacci_heap<Key, Value, Compare, Allocator>::mapped_type &keyed_fibonacci_heap<Key, Value, Compare, Allocator>::minimum_value() const {
+    return forest.top()->value;
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+typename keyed_fibonacci_heap<Key, Value, Compare, Allocator>::handle keyed_fibonacci_heap<Key, Value, Compare, Allocator>::insert(const key_type &key, const mapped_type &value) {
+    return link_root(create_node(key, value));
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+typename keyed_fibonacci_heap<Key, Value, Compare, Allocator>::handle keyed_fibonacci_heap<Key, Value, Compare, Allocator>::insert(key_type &&key, mapped_type &&value) {
+    return link_root(create_node(std::move(key), std::move(value)));
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+template<typename K, typename... Args>
+typename keyed_fibonacci_heap<Key, Value, Compare, Allocator>::handle keyed_fibonacci_heap<Key, Value, Compare, Allocator>::emplace(K &&key, Args &&... args) {
+    return link_root(create_node(std::forward<K>(key), std::forward<Args>(args)...));
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+void keyed_fibonacci_heap<Key, Value, Compare, Allocator>::extract_min() {
+    if(!empty()){
+        destroy_node(forest.pop());
+    }
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+std::pair<typename keyed_fibonacci_heap<Key, Value, Compare, Allocator>::key_type, typename keyed_fibonacci_heap<Key, Value, Compare, Allocator>::mapped_type> keyed_fibonacci_heap<Key, Value, Compare, Allocator>::pop_min() {
+    assert(!empty());
+    Node* x = forest.pop();
+    std::pair<key_type, mapped_type> res(std::move(x->key), std::move(x->value));
+    destroy_node(x);
+    return res;
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+void keyed_fibonacci_heap<Key, Value, Compare, Allocator>::delete_key(handle &x) {
+    forest.erase(x.n);
+    destroy_node(x.n);
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+void keyed_fibonacci_heap<Key, Value, Compare, Allocator>::decrease_key(const handle &x, const key_type &key) {
+    assert(forest.node_comp().get()(key, x.n->key));
+    x.n->key = key;
+    forest.decreased(x.n);
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+void keyed_fibonacci_heap<Key, Value, Compare, Allocator>::increase_key(const handle &x, const key_type &key) {
+    decrease_key(x, key);
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+void keyed_fibonacci_heap<Key, Value, Compare, Allocator>::join(keyed_fibonacci_heap &h) {
+    assert(h.empty() || alloc == h.alloc);
+    forest.merge(h.forest);
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+template<typename... Args>
+typename keyed_fibonacci_heap<Key, Value, Compare, Allocator>::Node *keyed_fibonacci_heap<Key, Value, Compare, Allocator>::create_node(Args &&... args) {
+    Node* x = node_traits::allocate(alloc, 1);
+    try{
+        node_traits::construct(alloc, x, std::forward<Args>(args)...);
+    }catch(...){
+        node_traits::deallocate(alloc, x, 1);
+        throw;
+    }
+    return x;
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+void keyed_fibonacci_heap<Key, Value, Compare, Allocator>::destroy_node(Node *x) {
+    node_traits::destroy(alloc, x);
+    node_traits::deallocate(alloc, x, 1);
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+typename keyed_fibonacci_heap<Key, Value, Compare, Allocator>::handle keyed_fibonacci_heap<Key, Value, Compare, Allocator>::link_root(Node *node) {
+    forest.push(node);
+    return handle(node);
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+void keyed_fibonacci_heap<Key, Value, Compare, Allocator>::clone_from(const keyed_fibonacci_heap &h) {
+    allocator_reserve(alloc, h.size());
+    forest.clone(h.forest, [this](const Node* x){ return create_node(x->key, x->value); }, [this](Node* x){ destroy_node(x); });
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+template<typename K, typename... Args>
+keyed_fibonacci_heap<Key, Value, Compare, Allocator>::Node::Node(K &&key, Args &&... args) : key(std::forward<K>(key)), value(std::forward<Args>(args)...) {}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+keyed_fibonacci_heap<Key, Value, Compare, Allocator>::node_compare::node_compare(const Compare &comp) : ebo_holder<Compare>(comp) {}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+bool keyed_fibonacci_heap<Key, Value, Compare, Allocator>::node_compare::operator()(const Node *a, const Node *b) const {
+    return this->get()(a->key, b->key);
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+bool keyed_fibonacci_heap<Key, Value, Compare, Allocator>::handle::operator==(const handle &other) const {
+    return n == other.n;
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+bool keyed_fibonacci_heap<Key, Value, Compare, Allocator>::handle::operator!=(const handle &other) const {
+    return n != other.n;
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+const typename keyed_fibonacci_heap<Key, Value, Compare, Allocator>::key_type &keyed_fibonacci_heap<Key, Value, Compare, Allocator>::handle::key() const {
+    return n->key;
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+typename keyed_fibonacci_heap<Key, Value, Compare, Allocator>::mapped_type &keyed_fibonacci_heap<Key, Value, Compare, Allocator>::handle::value() const {
+    return n->value;
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+keyed_fibonacci_heap<Key, Value, Compare, Allocator>::handle::handle(Node *x) : n(x) {}
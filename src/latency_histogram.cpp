@@ -0,0 +1,112 @@
+#include "latency_histogram.h"
+#include "utils.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+double tick_clock::ns_per_tick() {
+#ifdef LATENCY_HISTOGRAM_RDTSC
+    static const double res = []{
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        std::uint64_t start_ticks = now();
+        std::chrono::steady_clock::time_point end = start;
+        while (end - start < std::chrono::milliseconds(10)) {
+            end = std::chrono::steady_clock::now();
+        }
+        std::uint64_t ticks = now() - start_ticks;
+        double ns = std::chrono::duration<double, std::nano>(end - start).count();
+        return ticks > 0 ? ns / ticks : 1.0;
+    }();
+    return res;
+#else
+    return 1.0;
+#endif
+}
+
+latency_histogram::latency_histogram() {
+    reset();
+}
+
+void latency_histogram::record(std::uint64_t ticks) {
+    ++counts[bucket_of(ticks)];
+    ++total;
+    sum += ticks;
+    if(ticks > maximum){
+        maximum = ticks;
+    }
+}
+
+void latency_histogram::reset() {
+    std::fill(counts, counts + bucket_count, 0);
+    total = 0;
+    sum = 0;
+    maximum = 0;
+}
+
+std::uint64_t latency_histogram::count() const {
+    return total;
+}
+
+std::uint64_t latency_histogram::max() const {
+    return maximum;
+}
+
+double latency_histogram::mean() const {
+    return total == 0 ? 0.0 : static_cast<double>(sum) / total;
+}
+
+std::uint64_t latency_histogram::percentile(double p) const {
+    if(total == 0){
+        return 0;
+    }
+    double clamped = std::min(100.0, std::max(0.0, p));
+    std::uint64_t rank = static_cast<std::uint64_t>(std::ceil(clamped / 100.0 * total));
+    if(rank == 0){
+        rank = 1;
+    }
+    std::uint64_t seen = 0;
+    for (unsigned int i = 0; i < bucket_count; ++i) {
+        seen += counts[i];
+        if(seen >= rank){
+            return std::min(bucket_upper(i), maximum);
+        }
+    }
+    return maximum;
+}
+
+void latency_histogram::write_text(std::ostream &os, const char *name, double ns_per_tick) const {
+    os << name
+       << " count=" << total
+       << " mean=" << mean() * ns_per_tick << "ns"
+       << " p50=" << percentile(50) * ns_per_tick << "ns"
+       << " p99=" << percentile(99) * ns_per_tick << "ns"
+       << " p99.9=" << percentile(99.9) * ns_per_tick << "ns"
+       << " max=" << maximum * ns_per_tick << "ns\n";
+}
+
+void latency_histogram::write_json(std::ostream &os, double ns_per_tick) const {
+    os << "{\"count\": " << total
+       << ", \"mean_ns\": " << mean() * ns_per_tick
+       << ", \"p50_ns\": " << percentile(50) * ns_per_tick
+       << ", \"p99_ns\": " << percentile(99) * ns_per_tick
+       << ", \"p999_ns\": " << percentile(99.9) * ns_per_tick
+       << ", \"max_ns\": " << maximum * ns_per_tick << "}";
+}
+
+unsigned int latency_histogram::bucket_of(std::uint64_t value) {
+    if(value < sub_buckets){
+        return static_cast<unsigned int>(value);
+    }
+    unsigned int shift = floor_log2ul(value) - sub_bucket_bits;
+    return static_cast<unsigned int>(sub_buckets + shift * sub_buckets + ((value >> shift) - sub_buckets));
+}
+
+std::uint64_t latency_histogram::bucket_upper(unsigned int i) {
+    if(i < sub_buckets){
+        return i;
+    }
+    unsigned int shift = static_cast<unsigned int>((i - sub_buckets) / sub_buckets);
+    std::uint64_t sub = (i - sub_buckets) % sub_buckets;
+    std::uint64_t lower = (sub_buckets + sub) << shift;
+    return lower + ((std::uint64_t(1) << shift) - 1);
+}
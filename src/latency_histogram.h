@@ -0,0 +1,155 @@
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <cstdint>
+#include <ostream>
+
+#if defined(_MSC_VER) && !defined(__clang__) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define LATENCY_HISTOGRAM_RDTSC 1
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define LATENCY_HISTOGRAM_RDTSC 1
+#else
+#include <chrono>
+#endif
+
+/**
+ * Reloj barato para medir latencias de operaciones cortas.
+ * - En x86 lee el contador de ciclos (rdtsc), sin llamadas al sistema ni barreras
+ * - En el resto usa std::chrono::steady_clock en nanosegundos
+ */
+struct tick_clock {
+
+    /**
+     * @returns ticks actuales, solo tiene sentido la diferencia entre dos lecturas
+     *
+     * \complexity{\O(1)}
+     */
+    static std::uint64_t now() {
+#ifdef LATENCY_HISTOGRAM_RDTSC
+        return __rdtsc();
+#else
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    /**
+     * @brief Nanosegundos por tick
+     * Con rdtsc se calibra contra steady_clock la primera vez que se llama (tarda unos 10 ms)
+     *
+     * \complexity{\O(1)} después de la primera llamada
+     */
+    static double ns_per_tick();
+};
+
+/**
+ * Histograma de latencias con buckets logarítmicos, al estilo HdrHistogram:
+ * - valores menores a sub_buckets se guardan exactos
+ * - el resto se agrupa por potencia de 2 en sub_buckets buckets lineales, con error relativo menor a 1/sub_buckets
+ * - registrar un valor es \O(1) y no pide memoria, así se puede dejar prendido
+ * - ocupa memoria fija (unos 15 KiB)
+ */
+class latency_histogram {
+public:
+
+    /**
+     * @brief Construye histograma vacio
+     * \complexity{\O(b)} con b cantidad de buckets
+     */
+    latency_histogram();
+
+    /**
+     * @brief Registrar un valor
+     * @param ticks latencia medida
+     *
+     * \complexity{\O(1)}
+     */
+    void record(std::uint64_t ticks);
+
+    /**
+     * @brief Vaciar el histograma
+     *
+     * \complexity{\O(b)} con b cantidad de buckets
+     */
+    void reset();
+
+    /**
+     * @returns cantidad de valores registrados
+     *
+     * \complexity{\O(1)}
+     */
+    std::uint64_t count() const;
+
+    /**
+     * @returns mayor valor registrado (0 si está vacio)
+     *
+     * \complexity{\O(1)}
+     */
+    std::uint64_t max() const;
+
+    /**
+     * @returns promedio de los valores registrados (0 si está vacio)
+     *
+     * \complexity{\O(1)}
+     */
+    double mean() const;
+
+    /**
+     * @brief Percentil de los valores registrados
+     * @param p percentil entre 0 y 100
+     *
+     * @returns el mayor valor que cae en el mismo bucket que el percentil p (nunca más que max()), 0 si está vacio
+     *
+     * \complexity{\O(b)} con b cantidad de buckets
+     */
+    std::uint64_t percentile(double p) const;
+
+    /**
+     * @brief Escribir una línea con cantidad, promedio, p50, p99, p99.9 y maximo en nanosegundos
+     * @param os stream de salida
+     * @param name nombre de la operación
+     * @param ns_per_tick nanosegundos por tick
+     *
+     * \complexity{\O(b)}
+     */
+    void write_text(std::ostream& os, const char* name, double ns_per_tick) const;
+
+    /**
+     * @brief Escribir un objeto JSON con los mismos datos que write_text
+     * @param os stream de salida
+     * @param ns_per_tick nanosegundos por tick
+     *
+     * \complexity{\O(b)}
+     */
+    void write_json(std::ostream& os, double ns_per_tick) const;
+
+private:
+
+    static const unsigned int sub_bucket_bits = 5;
+    static const std::uint64_t sub_buckets = 1U << sub_bucket_bits;
+    static const unsigned int bucket_count = sub_buckets + (64 - sub_bucket_bits) * sub_buckets;
+
+    /**
+     * @returns índice del bucket donde cae value
+     *
+     * \complexity{\O(1)}
+     */
+    static unsigned int bucket_of(std::uint64_t value);
+
+    /**
+     * @returns mayor valor que cae en el bucket i
+     *
+     * \complexity{\O(1)}
+     */
+    static std::uint64_t bucket_upper(unsigned int i);
+
+    /** @{ */
+    std::uint64_t counts[bucket_count];
+    std::uint64_t total;
+    std::uint64_t sum;
+    std::uint64_t maximum;
+    /** @} */
+};
+
+#endif //LATENCY_HISTOGRAM_H
@@ -0,0 +1,496 @@
+#ifndef PAIRING_HEAP_H
+#define PAIRING_HEAP_H
+
+#include <cassert>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include "utils.h"
+
+/**
+ * Implementación de min_priority_queue<T> sobre pairing heap (Fredman, Sedgewick, Sleator, Tarjan) con la
+ * misma interfaz que fibonacci_heap, así se puede cambiar de uno a otro con un typedef.
+ * - Un único árbol con orden de heap; cada nodo guarda su primer hijo, su hermano siguiente y el anterior
+ *   (o el padre si es el primer hijo): 3 punteros contra 4 punteros, grado y marca del fibonacci heap
+ * - insert, join y decrease_key son un único link (decrease_key corta el subárbol y lo une a la raíz)
+ * - extract_min une los hijos de la raíz en dos pasadas: de a pares de izquierda a derecha y después
+ *   de derecha a izquierda
+ * - decrease_key es \O(log(n)) amortizado en teoría, pero en la práctica suele ganarle al fibonacci heap
+ *   por hacer menos trabajo y tener nodos más chicos
+ * - No tiene política de estadísticas
+ * Asume de T, Compare y Allocator lo mismo que fibonacci_heap
+ */
+template < typename T, typename Compare = std::less<T>, typename Allocator = std::allocator<T> >
+class pairing_heap : private ebo_holder<Compare> {
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using value_compare = Compare;
+    using allocator_type = Allocator;
+
+    class handle;
+
+    /**
+     * @brief Construye heap vacio
+     * \complexity{\O(1)}
+     */
+    pairing_heap();
+
+    /**
+     * @brief Construye heap vacio que ordena con comp
+     * @param comp comparador a usar
+     * @param alloc allocator a usar
+     *
+     * \complexity{\O(1)}
+     */
+    explicit pairing_heap(const value_compare& comp, const allocator_type& alloc = allocator_type());
+
+    /**
+     * @brief Construye heap vacio que pide los nodos a alloc
+     * @param alloc allocator a usar
+     *
+     * \complexity{\O(1)}
+     */
+    explicit pairing_heap(const allocator_type& alloc);
+
+    /**
+     * @brief Construye heap con los elementos de un rango, ver insert_range
+     * @param first inicio del rango
+     * @param last fin del rango
+     * @param comp comparador a usar
+     * @param alloc allocator a usar
+     *
+     * \complexity{\O(n)}
+     */
+    template < typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category >
+    pairing_heap(InputIt first, InputIt last, const value_compare& comp = value_compare(), const allocator_type& alloc = allocator_type());
+
+    /**
+     * @brief Destructor
+     * \complexity{\O(n)}
+     */
+    ~pairing_heap();
+
+    /**
+     * @brief Constructor por copia, mantiene la forma del árbol
+     * \complexity{\O(n)}
+     */
+    pairing_heap(const pairing_heap&);
+
+    /**
+     * @brief Operador de asignacion
+     * \complexity{\O(n)}
+     */
+    pairing_heap& operator=(const pairing_heap&);
+
+    /**
+     * @brief Constructor por movimiento
+     * \complexity{\O(1)}
+     */
+    pairing_heap(pairing_heap&&) noexcept;
+
+    /**
+     * @brief Operador de asignacion por movimiento
+     * \complexity{\O(n)}
+     */
+    pairing_heap& operator=(pairing_heap&&) noexcept;
+
+    /**
+     * @brief Remueve todos los elementos
+     *
+     * \complexity{\O(n)}
+     */
+    void clear();
+
+    /**
+     * @brief Intercambia los elementos de 2 heaps
+     * @param h heap a intercambiar
+     * \pre los allocators se propagan en swap o son iguales
+     *
+     * \complexity{\O(1)}
+     */
+    void swap(pairing_heap& h);
+
+    /**
+     * @brief Devuelve copia del allocator
+     *
+     * \complexity{\O(1)}
+     */
+    allocator_type get_allocator() const;
+
+    /**
+     * @brief Devuelve copia del comparador
+     *
+     * \complexity{\O(1)}
+     */
+    value_compare value_comp() const;
+
+    /**
+     * @returns true \IFF size() == 0
+     *
+     * \complexity{\O(1)}
+     */
+    bool empty() const;
+
+    /**
+     * @returns cantidad de elementos
+     *
+     * \complexity{\O(1)}
+     */
+    size_type size() const;
+
+    /**
+     * @brief Acceso al minimo elemento
+     * \pre !empty()
+     *
+     * @returns referencia constante al minimo
+     *
+     * \complexity{\O(1)}
+     */
+    const value_type& minimum() const;
+
+    /**
+     * @brief Inserción
+     * @param val elemento a insertar
+     *
+     * @returns handle que apunta al elemento insertado
+     *
+     * \complexity{\O(1)}
+     */
+    handle insert(const value_type& val);
+
+    /**
+     * @brief Inserción moviendo el elemento
+     * @param val elemento a insertar, queda en estado válido pero no especificado
+     *
+     * @returns handle que apunta al elemento insertado
+     *
+     * \complexity{\O(1)}
+     */
+    handle insert(value_type&& val);
+
+    /**
+     * @brief Inserción construyendo el elemento dentro del nodo
+     * @param args argumentos para el constructor de T
+     *
+     * @returns handle que apunta al elemento insertado
+     *
+     * \complexity{\O(1)} más la construcción de T
+     */
+    template < typename... Args >
+    handle emplace(Args&&... args);
+
+    /**
+     * @brief Inserción de todos los elementos de un rango
+     * Si el rango es forward y el allocator tiene reserve(n) los nodos se piden todos juntos.
+     * Si la construcción de un elemento lanza una excepción el heap queda como estaba
+     * @param first inicio del rango
+     * @param last fin del rango
+     *
+     * \complexity{\O(k)} con k cantidad de elementos del rango
+     */
+    template < typename InputIt >
+    void insert_range(InputIt first, InputIt last);
+
+    /**
+     * @brief Inserción de todos los elementos de un rango escribiendo sus handles
+     * @param first inicio del rango
+     * @param last fin del rango
+     * @param handles iterador de salida donde se escribe el handle de cada elemento, en el orden del rango
+     *
+     * @returns handles avanzado una posición por elemento insertado
+     *
+     * \complexity{\O(k)} con k cantidad de elementos del rango
+     */
+    template < typename InputIt, typename OutputIt >
+    OutputIt insert_range(InputIt first, InputIt last, OutputIt handles);
+
+    /**
+     * @brief Remover minimo
+     * \complexity{\O(log(n) amortizado)}
+     */
+    void extract_min();
+
+    /**
+     * @brief Remover minimo devolviéndolo
+     * El elemento se mueve fuera del nodo antes de destruirlo
+     * \pre !empty()
+     *
+     * @returns el elemento que era el minimo
+     *
+     * \complexity{\O(log(n) amortizado)}
+     */
+    value_type pop_min();
+
+    /**
+     * @brief Remover los k minimos escribiéndolos en orden en out
+     * @param k cantidad de elementos a remover (se remueven todos si hay menos)
+     * @param out iterador de salida donde se mueven los elementos
+     *
+     * @returns out avanzado una posición por elemento removido
+     *
+     * \complexity{\O(k log(n) amortizado)}
+     */
+    template < typename OutputIt >
+    OutputIt pop_k(size_type k, OutputIt out);
+
+    /**
+     * @brief Remover el minimo mientras pred(minimum()) sea verdadero
+     * @param pred predicado sobre const value_type&
+     * @param out iterador de salida donde se mueven los elementos
+     *
+     * @returns out avanzado una posición por elemento removido
+     *
+     * \complexity{\O(k log(n) amortizado)} con k cantidad de elementos removidos
+     */
+    template < typename Pred, typename OutputIt >
+    OutputIt drain_while(Pred pred, OutputIt out);
+
+    /**
+     * @brief Eliminar elemento
+     * @param x handle que apunta al elemento a eliminar
+     *
+     * \complexity{\O(log(n) amortizado)}
+     */
+    void delete_key(handle& x);
+
+    /**
+     * @brief Decrementar elemento
+     * @param x handle que apunta al elemento a decrementar
+     * @param val nuevo valor del elemento
+     * \pre value_comp()(\P{val}, *\P{x})
+     * \post *\P{x} == \P{val} \AND el resto de la estructura no cambia
+     *
+     * \complexity{\O(log(n) amortizado)}, \O(1) en la práctica
+     */
+    void decrease_key(const handle& x, const value_type& val);
+
+    /**
+     * @brief Decrementar elemento moviendo el nuevo valor
+     * @param x handle que apunta al elemento a decrementar
+     * @param val nuevo valor del elemento, queda en estado válido pero no especificado
+     * \pre value_comp()(\P{val}, *\P{x})
+     *
+     * \complexity{\O(log(n) amortizado)}, \O(1) en la práctica
+     */
+    void decrease_key(const handle& x, value_type&& val);
+
+    /**
+     * @brief Incrementar elemento, nombre de decrease_key para max heaps (Compare = std::greater<T>)
+     * @param x handle que apunta al elemento a incrementar
+     * @param val nuevo valor del elemento
+     * \pre value_comp()(\P{val}, *\P{x})
+     *
+     * \complexity{\O(log(n) amortizado)}, \O(1) en la práctica
+     */
+    void increase_key(const handle& x, const value_type& val);
+
+    /**
+     * @brief Une 2 heaps quedando todos los elementos en uno solo
+     * @param h heap a unir que queda vacio
+     * \pre h.empty() \LOR get_allocator() == h.get_allocator()
+     *
+     * \complexity{\O(1)}
+     */
+    void join(pairing_heap& h);
+
+private:
+
+    using compare_holder = ebo_holder<Compare>;
+
+    /**
+     * Nodo de la estructura:
+     * - child es el primer hijo, right el hermano siguiente
+     * - left es el hermano anterior, o el padre si es el primer hijo (nullptr en la raíz)
+     */
+    struct Node {
+
+        /**
+         * @brief crear nodo suelto
+         * @param args argumentos para construir la clave del nodo
+         *
+         * \complexity{\O(1)} más la construcción de T
+         */
+        template < typename... Args >
+        explicit Node(Args&&... args);
+
+        /** @{ */
+        Node* child;
+        Node* left;
+        Node* right;
+        value_type key;
+        /** @} */
+    };
+
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    /**
+     * @returns true \IFF a va antes que b
+     *
+     * \complexity{\O(cmp(T))}
+     */
+    bool precedes(const value_type& a, const value_type& b) const;
+
+    /**
+     * @brief Pedir y construir un nodo con el allocator
+     *
+     * \complexity{\O(1)} más la construcción de T
+     */
+    template < typename... Args >
+    Node* create_node(Args&&... args);
+
+    /**
+     * @brief Destruir un nodo y devolver su memoria al allocator
+     *
+     * \complexity{\O(1)}
+     */
+    void destroy_node(Node* x);
+
+    /**
+     * @brief Unir dos árboles sueltos: la raíz mayor pasa a ser el primer hijo de la menor
+     * \pre a y b son raíces sin hermanos, o nullptr
+     *
+     * @returns la raíz del árbol unido
+     *
+     * \complexity{\O(1)}
+     */
+    Node* link(Node* a, Node* b);
+
+    /**
+     * @brief Separar el subárbol de x de su padre y sus hermanos
+     * \pre x no es la raíz
+     *
+     * \complexity{\O(1)}
+     */
+    static void detach(Node* x);
+
+    /**
+     * @brief Unir una lista de hermanos en un único árbol en dos pasadas
+     * @param first primer hermano de la lista, o nullptr
+     *
+     * @returns raíz del árbol resultante, o nullptr
+     *
+     * \complexity{\O(k)} con k cantidad de hermanos, \O(log(n)) amortizado
+     */
+    Node* merge_pairs(Node* first);
+
+    /**
+     * @brief Sacar la raíz dejando el árbol de sus hijos en su lugar
+     * \pre !empty()
+     *
+     * @returns la vieja raíz, sin destruir
+     *
+     * \complexity{\O(log(n) amortizado)}
+     */
+    Node* pop_root();
+
+    /**
+     * @brief Poner un nodo recién creado en el heap
+     *
+     * @returns handle que apunta al nodo
+     *
+     * \complexity{\O(1)}
+     */
+    handle link_root(Node* node);
+
+    /**
+     * @brief Destruir todos los nodos del árbol con raíz r, sin recursión
+     *
+     * \complexity{\O(n)}
+     */
+    void destroy_tree(Node* r);
+
+    /**
+     * @brief copiar los nodos de h manteniendo la forma del árbol, sin recursión
+     * Si el allocator tiene reserve(n) se piden todos los nodos juntos
+     * @param h heap a copiar
+     * \pre empty()
+     *
+     * \complexity{\O(n)}
+     */
+    void clone_from(const pairing_heap& h);
+
+    /**
+     * @brief Crear un nodo por cada elemento del rango y unirlos al heap de una sola vez
+     * @param on_insert función que recibe cada nodo creado
+     * Si algo lanza una excepción se destruyen los nodos creados y el heap no cambia
+     *
+     * \complexity{\O(k)} con k cantidad de elementos del rango
+     */
+    template < typename InputIt, typename F >
+    void link_range(InputIt first, InputIt last, F& on_insert);
+
+    /**
+     * @brief Remover minimos mientras keep los acepte moviéndolos a out
+     * @param keep función que recibe el nodo minimo y devuelve si se lo remueve
+     * @param out iterador de salida donde se mueven los elementos
+     *
+     * @returns out avanzado una posición por elemento removido
+     */
+    template < typename Keep, typename OutputIt >
+    OutputIt pop_while(Keep keep, OutputIt out);
+
+    /** @{ */
+    node_allocator alloc;
+    Node* root;
+    size_type n;
+    /** @} */
+};
+
+template < typename T, typename Compare, typename Allocator >
+class pairing_heap<T, Compare, Allocator>::handle {
+public:
+    using value_type = T;
+    using pointer = const T*;
+    using reference = const T&;
+
+    /**
+     * @returns true \IFF apuntan al mismo elemento
+     *
+     * \complexity{\O(1)}
+     */
+    bool operator==(const handle& other) const;
+
+    /**
+     * @returns false \IFF apuntan al mismo elemento
+     *
+     * \complexity{\O(1)}
+     */
+    bool operator!=(const handle& other) const;
+
+    /**
+     * @brief Desreferencia el puntero
+     * \pre El handle debe estar apuntando a un elemento.
+     *
+     * \complexity{\O(1)}
+     */
+    reference operator*() const;
+
+    /**
+     * @brief Operador flechita
+     * \pre El handle debe estar apuntando a un elemento.
+     *
+     * \complexity{\O(1)}
+     */
+    pointer operator->() const;
+
+private:
+
+    friend class pairing_heap;
+
+    /**
+     * @brief Constructor
+     * @param x puntero al nodo que el handle estará ligado
+     */
+    handle(Node* x);
+
+    /** @{ */
+    Node* n;
+    /** @} */
+};
+
+#include "pairing_heap.hpp"
+
+#endif //PAIRING_HEAP_H
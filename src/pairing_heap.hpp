@@ -0,0 +1,451 @@
+#include "pairing_heap.h"
+
+template<typename T, typename Compare, typename Allocator>
+pairing_heap<T, Compare, Allocator>::pairing_heap() : compare_holder(), alloc(), root(nullptr), n(0) {}
+
+template<typename T, typename Compare, typename Allocator>
+pairing_heap<T, Compare, Allocator>::pairing_heap(const value_compare &comp, const allocator_type &alloc) : compare_holder(comp), alloc(alloc), root(nullptr), n(0) {}
+
+template<typename T, typename Compare, typename Allocator>
+pairing_heap<T, Compare, Allocator>::pairing_heap(const allocator_type &alloc) : compare_holder(), alloc(alloc), root(nullptr), n(0) {}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename InputIt, typename>
+pairing_heap<T, Compare, Allocator>::pairing_heap(InputIt first, InputIt last, const value_compare &comp, const allocator_type &alloc) : compare_holder(comp), alloc(alloc), root(nullptr), n(0) {
+    insert_range(first, last);
+}
+
+template<typename T, typename Compare, typename Allocator>
+pairing_heap<T, Compare, Allocator>::~pairing_heap() {
+    clear();
+}
+
+template<typename T, typename Compare, typename Allocator>
+pairing_heap<T, Compare, Allocator>::pairing_heap(const pairing_heap &h) : compare_holder(h.compare_holder::get()), alloc(node_traits::select_on_container_copy_construction(h.alloc)), root(nullptr), n(0) {
+    clone_from(h);
+}
+
+template<typename T, typename Compare, typename Allocator>
+pairing_heap<T, Compare, Allocator> &pairing_heap<T, Compare, Allocator>::operator=(const pairing_heap &h) {
+    if(this != &h){
+        clear();
+        compare_holder::get() = h.compare_holder::get();
+        if(node_traits::propagate_on_container_copy_assignment::value){
+            alloc = h.alloc;
+        }
+        clone_from(h);
+    }
+    return *this;
+}
+
+template<typename T, typename Compare, typename Allocator>
+pairing_heap<T, Compare, Allocator>::pairing_heap(pairing_heap &&h) noexcept : compare_holder(h.compare_holder::get()), alloc(h.alloc), root(h.root), n(h.n) {
+    h.root = nullptr;
+    h.n = 0;
+}
+
+template<typename T, typename Compare, typename Allocator>
+pairing_heap<T, Compare, Allocator> &pairing_heap<T, Compare, Allocator>::operator=(pairing_heap &&h) noexcept {
+    clear();
+    if(node_traits::propagate_on_container_move_assignment::value){
+        alloc = h.alloc;
+    }
+    assert(h.empty() || alloc == h.alloc);
+    std::swap(compare_holder::get(), h.compare_holder::get());
+    std::swap(root, h.root);
+    std::swap(n, h.n);
+    return *this;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void pairing_heap<T, Compare, Allocator>::clear() {
+    destroy_tree(root);
+    root = nullptr;
+    n = 0;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void pairing_heap<T, Compare, Allocator>::swap(pairing_heap &h) {
+    if(node_traits::propagate_on_container_swap::value){
+        std::swap(alloc, h.alloc);
+    }
+    assert(alloc == h.alloc);
+    std::swap(compare_holder::get(), h.compare_holder::get());
+    std::swap(root, h.root);
+    std::swap(n, h.n);
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename pairing_heap<T, Compare, Allocator>::allocator_type pairing_heap<T, Compare, Allocator>::get_allocator() const {
+    return allocator_type(alloc);
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename pairing_heap<T, Compare, Allocator>::value_compare pairing_heap<T, Compare, Allocator>::value_comp() const {
+    return compare_holder::get();
+}
+
+template<typename T, typename Compare, typename Allocator>
+bool pairing_heap<T, Compare, Allocator>::empty() const {
+    return n == 0;
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename pairing_heap<T, Compare, Allocator>::size_type pairing_heap<T, Compare, Allocator>::size() const {
+    return n;
+}
+
+template<typename T, typename Compare, typename Allocator>
+const typename pairing_heap<T, Compare, Allocator>::value_type &pairing_heap<T, Compare, Allocator>::minimum() const {
+    assert(!empty());
+    return root->key;
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename pairing_heap<T, Compare, Allocator>::handle pairing_heap<T, Compare, Allocator>::insert(const value_type &val) {
+    return link_root(create_node(val));
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename pairing_heap<T, Compare, Allocator>::handle pairing_heap<T, Compare, Allocator>::insert(value_type &&val) {
+    return link_root(create_node(std::move(val)));
+}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename... Args>
+typename pairing_heap<T, Compare, Allocator>::handle pairing_heap<T, Compare, Allocator>::emplace(Args &&... args) {
+    return link_root(create_node(std::forward<Args>(args)...));
+}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename InputIt>
+void pairing_heap<T, Compare, Allocator>::insert_range(InputIt first, InputIt last) {
+    auto ignore = [](Node*){};
+    link_range(first, last, ignore);
+}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename InputIt, typename OutputIt>
+OutputIt pairing_heap<T, Compare, Allocator>::insert_range(InputIt first, InputIt last, OutputIt handles) {
+    auto write_handle = [&handles](Node* x){
+        *handles = handle(x);
+        ++handles;
+    };
+    link_range(first, last, write_handle);
+    return handles;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void pairing_heap<T, Compare, Allocator>::extract_min() {
+    if(!empty()){
+        destroy_node(pop_root());
+    }
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename pairing_heap<T, Compare, Allocator>::value_type pairing_heap<T, Compare, Allocator>::pop_min() {
+    assert(!empty());
+    Node* x = pop_root();
+    value_type res(std::move(x->key));
+    destroy_node(x);
+    return res;
+}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename OutputIt>
+OutputIt pairing_heap<T, Compare, Allocator>::pop_k(size_type k, OutputIt out) {
+    size_type remaining = k;
+    return pop_while([&remaining](const Node*){ return remaining-- > 0; }, out);
+}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename Pred, typename OutputIt>
+OutputIt pairing_heap<T, Compare, Allocator>::drain_while(Pred pred, OutputIt out) {
+    return pop_while([&pred](const Node* x){ return static_cast<bool>(pred(static_cast<const value_type&>(x->key))); }, out);
+}
+
+template<typename T, typename Compare, typename Allocator>
+void pairing_heap<T, Compare, Allocator>::delete_key(handle &x) {
+    Node* node = x.n;
+    if(node == root){
+        destroy_node(pop_root());
+        return;
+    }
+    detach(node);
+    root = link(root, merge_pairs(node->child));
+    --n;
+    destroy_node(node);
+}
+
+template<typename T, typename Compare, typename Allocator>
+void pairing_heap<T, Compare, Allocator>::decrease_key(const handle &x, const value_type &val) {
+    assert(precedes(val, x.n->key));
+    x.n->key = val;
+    if(x.n != root){
+        detach(x.n);
+        root = link(root, x.n);
+    }
+}
+
+template<typename T, typename Compare, typename Allocator>
+void pairing_heap<T, Compare, Allocator>::decrease_key(const handle &x, value_type &&val) {
+    assert(precedes(val, x.n->key));
+    x.n->key = std::move(val);
+    if(x.n != root){
+        detach(x.n);
+        root = link(root, x.n);
+    }
+}
+
+template<typename T, typename Compare, typename Allocator>
+void pairing_heap<T, Compare, Allocator>::increase_key(const handle &x, const value_type &val) {
+    decrease_key(x, val);
+}
+
+template<typename T, typename Compare, typename Allocator>
+void pairing_heap<T, Compare, Allocator>::join(pairing_heap &h) {
+    assert(h.empty() || alloc == h.alloc);
+    root = link(root, h.root);
+    n += h.n;
+    h.root = nullptr;
+    h.n = 0;
+}
+
+template<typename T, typename Compare, typename Allocator>
+bool pairing_heap<T, Compare, Allocator>::precedes(const value_type &a, const value_type &b) const {
+    return compare_holder::get()(a, b);
+}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename... Args>
+typename pairing_heap<T, Compare, Allocator>::Node *pairing_heap<T, Compare, Allocator>::create_node(Args &&... args) {
+    Node* x = node_traits::allocate(alloc, 1);
+    try{
+        node_traits::construct(alloc, x, std::forward<Args>(args)...);
+    }catch(...){
+        node_traits::deallocate(alloc, x, 1);
+        throw;
+    }
+    return x;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void pairing_heap<T, Compare, Allocator>::destroy_node(Node *x) {
+    node_traits::destroy(alloc, x);
+    node_traits::deallocate(alloc, x, 1);
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename pairing_heap<T, Compare, Allocator>::Node *pairing_heap<T, Compare, Allocator>::link(Node *a, Node *b) {
+    if(a == nullptr){
+        return b;
+    }
+    if(b == nullptr){
+        return a;
+    }
+    if(precedes(b->key, a->key)){
+        std::swap(a, b);
+    }
+    b->left = a;
+    b->right = a->child;
+    if(a->child != nullptr){
+        a->child->left = b;
+    }
+    a->child = b;
+    return a;
+}
+
+template<typename T, typename Compare, typename Allocator>
+void pairing_heap<T, Compare, Allocator>::detach(Node *x) {
+    if(x->left->child == x){
+        x->left->child = x->right;
+    }else{
+        x->left->right = x->right;
+    }
+    if(x->right != nullptr){
+        x->right->left = x->left;
+    }
+    x->left = nullptr;
+    x->right = nullptr;
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename pairing_heap<T, Compare, Allocator>::Node *pairing_heap<T, Compare, Allocator>::merge_pairs(Node *first) {
+    if(first == nullptr){
+        return nullptr;
+    }
+    // Primera pasada: se unen de a pares y cada par queda en una pila enlazada por right
+    Node* pairs = nullptr;
+    Node* a = first;
+    while (a != nullptr) {
+        Node* b = a->right;
+        Node* next = b == nullptr ? nullptr : b->right;
+        a->left = nullptr;
+        a->right = nullptr;
+        if(b != nullptr){
+            b->left = nullptr;
+            b->right = nullptr;
+            a = link(a, b);
+        }
+        a->right = pairs;
+        pairs = a;
+        a = next;
+    }
+    // Segunda pasada: de derecha a izquierda, el último par absorbe a los anteriores
+    Node* res = pairs;
+    pairs = pairs->right;
+    res->right = nullptr;
+    while (pairs != nullptr) {
+        Node* x = pairs;
+        pairs = pairs->right;
+        x->right = nullptr;
+        res = link(res, x);
+    }
+    return res;
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename pairing_heap<T, Compare, Allocator>::Node *pairing_heap<T, Compare, Allocator>::pop_root() {
+    Node* x = root;
+    root = merge_pairs(x->child);
+    x->child = nullptr;
+    --n;
+    return x;
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename pairing_heap<T, Compare, Allocator>::handle pairing_heap<T, Compare, Allocator>::link_root(Node *node) {
+    root = link(root, node);
+    ++n;
+    return handle(node);
+}
+
+template<typename T, typename Compare, typename Allocator>
+void pairing_heap<T, Compare, Allocator>::destroy_tree(Node *r) {
+    // Lista de nodos pendientes enlazada por right: al destruir un nodo sus hijos pasan al frente
+    Node* pending = r;
+    while (pending != nullptr) {
+        Node* x = pending;
+        pending = x->right;
+        if(x->child != nullptr){
+            Node* last = x->child;
+            while (last->right != nullptr) {
+                last = last->right;
+            }
+            last->right = pending;
+            pending = x->child;
+        }
+        destroy_node(x);
+    }
+}
+
+template<typename T, typename Compare, typename Allocator>
+void pairing_heap<T, Compare, Allocator>::clone_from(const pairing_heap &h) {
+    assert(empty());
+    if(h.empty()){
+        return;
+    }
+    allocator_reserve(alloc, h.size());
+    try{
+        // Recorrido en preorden de h; left lleva al hermano anterior o al padre, así no hace falta pila
+        const Node* i = h.root;
+        Node* c = create_node(i->key);
+        root = c;
+        for (;;) {
+            if(i->child != nullptr){
+                Node* x = create_node(i->child->key);
+                c->child = x;
+                x->left = c;
+                i = i->child;
+                c = x;
+                continue;
+            }
+            while (i != h.root && i->right == nullptr) {
+                while (i->left->child != i) {
+                    i = i->left;
+                    c = c->left;
+                }
+                i = i->left;
+                c = c->left;
+            }
+            if(i == h.root){
+                break;
+            }
+            Node* x = create_node(i->right->key);
+            c->right = x;
+            x->left = c;
+            i = i->right;
+            c = x;
+        }
+    }catch(...){
+        destroy_tree(root);
+        root = nullptr;
+        throw;
+    }
+    n = h.n;
+}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename InputIt, typename F>
+void pairing_heap<T, Compare, Allocator>::link_range(InputIt first, InputIt last, F &on_insert) {
+    allocator_reserve(alloc, range_size_hint(first, last));
+    Node* range = nullptr;
+    size_type k = 0;
+    try{
+        for (; first != last; ++first) {
+            Node* x = create_node(*first);
+            range = link(range, x);
+            ++k;
+            on_insert(x);
+        }
+    }catch(...){
+        destroy_tree(range);
+        throw;
+    }
+    root = link(root, range);
+    n += k;
+}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename Keep, typename OutputIt>
+OutputIt pairing_heap<T, Compare, Allocator>::pop_while(Keep keep, OutputIt out) {
+    while (!empty() && keep(static_cast<const Node*>(root))) {
+        Node* x = pop_root();
+        try{
+            *out = std::move(x->key);
+            ++out;
+        }catch(...){
+            destroy_node(x);
+            throw;
+        }
+        destroy_node(x);
+    }
+    return out;
+}
+
+template<typename T, typename Compare, typename Allocator>
+template<typename... Args>
+pairing_heap<T, Compare, Allocator>::Node::Node(Args &&... args) : child(nullptr), left(nullptr), right(nullptr), key(std::forward<Args>(args)...) {}
+
+template<typename T, typename Compare, typename Allocator>
+bool pairing_heap<T, Compare, Allocator>::handle::operator==(const handle &other) const {
+    return n == other.n;
+}
+
+template<typename T, typename Compare, typename Allocator>
+bool pairing_heap<T, Compare, Allocator>::handle::operator!=(const handle &other) const {
+    return n != other.n;
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename pairing_heap<T, Compare, Allocator>::handle::reference pairing_heap<T, Compare, Allocator>::handle::operator*() const {
+    return n->key;
+}
+
+template<typename T, typename Compare, typename Allocator>
+typename pairing_heap<T, Compare, Allocator>::handle::pointer pairing_heap<T, Compare, Allocator>::handle::operator->() const {
+    return &n->key;
+}
+
+template<typename T, typename Compare, typename Allocator>
+pairing_heap<T, Compare, Allocator>::handle::handle(Node *x) : n(x) {}
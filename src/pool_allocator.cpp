@@ -0,0 +1,63 @@
+#include "pool_allocator.h"
+#include <new>
+
+node_pool::node_pool(std::size_t blocks_per_chunk) : free_lists(), free_counts(), blocks_per_chunk(blocks_per_chunk > 0 ? blocks_per_chunk : 1) {}
+
+node_pool::~node_pool() {
+    for (std::size_t i = 0; i < chunks.size(); ++i) {
+        ::operator delete(chunks[i]);
+    }
+}
+
+void *node_pool::allocate(std::size_t size, std::size_t count) {
+    std::size_t c = size_class(size, count);
+    if(c == size_classes){
+        return ::operator new(size * count);
+    }
+    if(free_lists[c] == nullptr){
+        refill(c, blocks_per_chunk);
+    }
+    free_block* block = free_lists[c];
+    free_lists[c] = block->next;
+    --free_counts[c];
+    return block;
+}
+
+void node_pool::deallocate(void *p, std::size_t size, std::size_t count) {
+    std::size_t c = size_class(size, count);
+    if(c == size_classes){
+        ::operator delete(p);
+        return;
+    }
+    free_block* block = static_cast<free_block*>(p);
+    block->next = free_lists[c];
+    free_lists[c] = block;
+    ++free_counts[c];
+}
+
+void node_pool::reserve(std::size_t size, std::size_t count) {
+    std::size_t c = size_class(size, 1);
+    if(c < size_classes && free_counts[c] < count){
+        refill(c, count - free_counts[c]);
+    }
+}
+
+std::size_t node_pool::size_class(std::size_t size, std::size_t count) {
+    if(count != 1 || size == 0 || size > granularity * size_classes){
+        return size_classes;
+    }
+    return (size - 1) / granularity;
+}
+
+void node_pool::refill(std::size_t c, std::size_t blocks) {
+    std::size_t block_size = (c + 1) * granularity;
+    chunks.reserve(chunks.size() + 1);
+    char* chunk = static_cast<char*>(::operator new(block_size * blocks));
+    chunks.push_back(chunk);
+    for (std::size_t i = blocks; i > 0; --i) {
+        free_block* block = reinterpret_cast<free_block*>(chunk + (i - 1) * block_size);
+        block->next = free_lists[c];
+        free_lists[c] = block;
+    }
+    free_counts[c] += blocks;
+}
@@ -0,0 +1,196 @@
+#ifndef POOL_ALLOCATOR_H
+#define POOL_ALLOCATOR_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/**
+ * Pool de bloques de tamaño fijo.
+ * - Pide memoria al sistema en chunks de varios bloques y la recicla con listas libres
+ * - Hay una lista libre por clase de tamaño (múltiplos de alignof(std::max_align_t))
+ * - Los pedidos de más de un elemento o de tamaño grande van directo a ::operator new
+ * - La memoria de los chunks se devuelve al sistema recién cuando se destruye el pool
+ * - No es thread-safe
+ */
+class node_pool {
+public:
+
+    /**
+     * @brief Construye pool vacio
+     * @param blocks_per_chunk cantidad de bloques que se piden al sistema cada vez que una lista libre se vacía
+     *
+     * \complexity{\O(1)}
+     */
+    explicit node_pool(std::size_t blocks_per_chunk = 1024);
+
+    /**
+     * @brief Destructor, libera todos los chunks
+     * Todo puntero obtenido del pool queda invalidado
+     *
+     * \complexity{\O(c)} con c cantidad de chunks pedidos
+     */
+    ~node_pool();
+
+    node_pool(const node_pool&) = delete;
+    node_pool& operator=(const node_pool&) = delete;
+
+    /**
+     * @brief Pedir memoria
+     * @param size tamaño en bytes del bloque
+     * @param count cantidad de bloques contiguos
+     *
+     * @returns puntero a memoria alineada a alignof(std::max_align_t) para count bloques de size bytes
+     *
+     * \complexity{\O(1) amortizado}
+     */
+    void* allocate(std::size_t size, std::size_t count);
+
+    /**
+     * @brief Devolver memoria al pool
+     * @param p puntero obtenido de allocate con los mismos size y count
+     * @param size tamaño en bytes del bloque
+     * @param count cantidad de bloques contiguos
+     *
+     * \complexity{\O(1)}
+     */
+    void deallocate(void* p, std::size_t size, std::size_t count);
+
+    /**
+     * @brief Asegurar que los próximos count pedidos de un bloque de size bytes no pidan memoria al sistema
+     * Si hacen falta bloques se piden todos en un único chunk
+     * @param size tamaño en bytes del bloque
+     * @param count cantidad de bloques
+     *
+     * \complexity{\O(count)}
+     */
+    void reserve(std::size_t size, std::size_t count);
+
+private:
+
+    /**
+     * Bloque libre, se guarda dentro de la misma memoria que se recicla
+     */
+    struct free_block {
+        free_block* next;
+    };
+
+    /**
+     * @brief Indice de la lista libre que corresponde a un tamaño
+     * @returns size_classes si el tamaño no se maneja con listas libres
+     *
+     * \complexity{\O(1)}
+     */
+    static std::size_t size_class(std::size_t size, std::size_t count);
+
+    /**
+     * @brief Pedir un chunk nuevo al sistema y repartirlo en la lista libre de la clase c
+     * @param c clase de tamaño
+     * @param blocks cantidad de bloques del chunk
+     *
+     * \complexity{\O(blocks)}
+     */
+    void refill(std::size_t c, std::size_t blocks);
+
+    static const std::size_t granularity = alignof(std::max_align_t);
+    static const std::size_t size_classes = 16;
+
+    /** @{ */
+    free_block* free_lists[size_classes];
+    std::size_t free_counts[size_classes];
+    std::vector<void*> chunks;
+    std::size_t blocks_per_chunk;
+    /** @} */
+};
+
+/**
+ * Allocator compatible con std::allocator_traits que recicla memoria a través de un node_pool.
+ * - Las copias (incluyendo las obtenidas por rebind) comparten el mismo pool y son iguales
+ * - Dos allocators construidos por defecto tienen pools distintos y no son iguales
+ * - Se propaga en copia, movimiento y swap de los contenedores
+ */
+template < typename T >
+class pool_allocator {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    /**
+     * @brief Construye allocator con un pool nuevo
+     * @param blocks_per_chunk cantidad de bloques por chunk del pool
+     *
+     * \complexity{\O(1)}
+     */
+    explicit pool_allocator(std::size_t blocks_per_chunk = 1024);
+
+    /**
+     * @brief Constructor por copia, comparte el pool
+     * No hay constructor por movimiento para que el original nunca quede sin pool
+     *
+     * \complexity{\O(1)}
+     */
+    pool_allocator(const pool_allocator&) noexcept = default;
+
+    /**
+     * @brief Conversión desde allocator de otro tipo, comparte el pool
+     *
+     * \complexity{\O(1)}
+     */
+    template < typename U >
+    pool_allocator(const pool_allocator<U>& other) noexcept;
+
+    pool_allocator& operator=(const pool_allocator&) noexcept = default;
+
+    /**
+     * @brief Pedir memoria para n elementos
+     *
+     * \complexity{\O(1) amortizado}
+     */
+    T* allocate(size_type n);
+
+    /**
+     * @brief Devolver memoria de n elementos
+     *
+     * \complexity{\O(1)}
+     */
+    void deallocate(T* p, size_type n);
+
+    /**
+     * @brief Asegurar que los próximos n pedidos de un elemento no pidan memoria al sistema
+     *
+     * \complexity{\O(n)}
+     */
+    void reserve(size_type n);
+
+    /**
+     * @returns true \IFF comparten el mismo pool
+     *
+     * \complexity{\O(1)}
+     */
+    template < typename U >
+    bool operator==(const pool_allocator<U>& other) const;
+
+    /**
+     * @returns false \IFF comparten el mismo pool
+     *
+     * \complexity{\O(1)}
+     */
+    template < typename U >
+    bool operator!=(const pool_allocator<U>& other) const;
+
+private:
+
+    template < typename U >
+    friend class pool_allocator;
+
+    /** @{ */
+    std::shared_ptr<node_pool> pool;
+    /** @} */
+};
+
+#include "pool_allocator.hpp"
+
+#endif //POOL_ALLOCATOR_H
@@ -0,0 +1,35 @@
+#include "pool_allocator.h"
+
+template<typename T>
+pool_allocator<T>::pool_allocator(std::size_t blocks_per_chunk) : pool(std::make_shared<node_pool>(blocks_per_chunk)) {}
+
+template<typename T>
+template<typename U>
+pool_allocator<T>::pool_allocator(const pool_allocator<U> &other) noexcept : pool(other.pool) {}
+
+template<typename T>
+T *pool_allocator<T>::allocate(size_type n) {
+    return static_cast<T*>(pool->allocate(sizeof(T), n));
+}
+
+template<typename T>
+void pool_allocator<T>::deallocate(T *p, size_type n) {
+    pool->deallocate(p, sizeof(T), n);
+}
+
+template<typename T>
+void pool_allocator<T>::reserve(size_type n) {
+    pool->reserve(sizeof(T), n);
+}
+
+template<typename T>
+template<typename U>
+bool pool_allocator<T>::operator==(const pool_allocator<U> &other) const {
+    return pool == other.pool;
+}
+
+template<typename T>
+template<typename U>
+bool pool_allocator<T>::operator!=(const pool_allocator<U> &other) const {
+    return pool != other.pool;
+}
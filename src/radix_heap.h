@@ -0,0 +1,386 @@
+#ifndef RADIX_HEAP_H
+#define RADIX_HEAP_H
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include "utils.h"
+
+/**
+ * Cola de prioridad monótona para claves enteras sin signo, separando prioridad y dato como keyed_fibonacci_heap.
+ * Sirve cuando las claves que salen nunca decrecen, como las distancias de Dijkstra con pesos no negativos:
+ * - Se guarda last, el último mínimo consultado o extraído. Toda clave insertada o decrementada es \GEQ last
+ * - El balde 0 tiene las claves iguales a last y el balde b > 0 las que difieren de last por primera vez
+ *   (mirando desde el bit más alto) en el bit b - 1. No se compara nunca para ubicar un elemento
+ * - Al pedir el minimo con el balde 0 vacio se busca el minimo del primer balde no vacio, pasa a ser last
+ *   y los elementos de ese balde se reparten en baldes más chicos
+ * Cada elemento solo baja de balde, así que se mueve a lo sumo B veces con B los bits de Key:
+ * insert y decrease_key son \O(1) y extract_min \O(log(C)) amortizado con C la diferencia máxima entre claves
+ * Asume de Key:
+ * - es un tipo entero sin signo de hasta 64 bits
+ * Asume de Value:
+ * - no se compara nunca, solo se construye, mueve y destruye
+ * Asume de Allocator:
+ * - cumple los requisitos de allocator de la biblioteca estándar (se usa con rebind a Node)
+ * No hay join: los dos heaps pueden tener distinto last
+ */
+template < typename Key, typename Value, typename Allocator = std::allocator<std::pair<const Key, Value> > >
+class radix_heap {
+    static_assert(std::is_integral<Key>::value && std::is_unsigned<Key>::value, "radix_heap requiere claves enteras sin signo");
+    static_assert(std::numeric_limits<Key>::digits <= std::numeric_limits<unsigned long long int>::digits, "radix_heap admite claves de hasta 64 bits");
+
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using size_type = size_t;
+    using allocator_type = Allocator;
+
+    class handle;
+
+    /**
+     * @brief Construye heap vacio con last = 0
+     * \complexity{\O(1)}
+     */
+    radix_heap();
+
+    /**
+     * @brief Construye heap vacio que pide los nodos a alloc
+     * @param alloc allocator a usar
+     *
+     * \complexity{\O(1)}
+     */
+    explicit radix_heap(const allocator_type& alloc);
+
+    /**
+     * @brief Destructor
+     * \complexity{\O(n)}
+     */
+    ~radix_heap();
+
+    /**
+     * @brief Constructor por copia, con el mismo last y los mismos baldes
+     * \complexity{\O(n)}
+     */
+    radix_heap(const radix_heap&);
+
+    /**
+     * @brief Operador de asignacion
+     * \complexity{\O(n)}
+     */
+    radix_heap& operator=(const radix_heap&);
+
+    /**
+     * @brief Constructor por movimiento
+     * \complexity{\O(B)} con B los bits de Key
+     */
+    radix_heap(radix_heap&&) noexcept;
+
+    /**
+     * @brief Operador de asignacion por movimiento
+     * \complexity{\O(n)}
+     */
+    radix_heap& operator=(radix_heap&&) noexcept;
+
+    /**
+     * @brief Remueve todos los elementos y vuelve last a 0
+     *
+     * \complexity{\O(n)}
+     */
+    void clear();
+
+    /**
+     * @brief Intercambia los elementos de 2 heaps
+     * @param h heap a intercambiar
+     * \pre los allocators se propagan en swap o son iguales
+     *
+     * \complexity{\O(B)} con B los bits de Key
+     */
+    void swap(radix_heap& h);
+
+    /**
+     * @brief Devuelve copia del allocator
+     *
+     * \complexity{\O(1)}
+     */
+    allocator_type get_allocator() const;
+
+    /**
+     * @returns true \IFF size() == 0
+     *
+     * \complexity{\O(1)}
+     */
+    bool empty() const;
+
+    /**
+     * @returns cantidad de elementos
+     *
+     * \complexity{\O(1)}
+     */
+    size_type size() const;
+
+    /**
+     * @returns last, la cota inferior de las claves que se pueden insertar o decrementar
+     *
+     * \complexity{\O(1)}
+     */
+    key_type last_minimum() const;
+
+    /**
+     * @brief Acceso a la prioridad minima
+     * No es const: si hace falta reparte un balde y last pasa a ser el minimo
+     * \pre !empty()
+     *
+     * @returns referencia constante a la prioridad del minimo
+     *
+     * \complexity{\O(log(C)) amortizado}
+     */
+    const key_type& minimum();
+
+    /**
+     * @brief Acceso al dato del minimo, igual que minimum() last pasa a ser el minimo
+     * \pre !empty()
+     *
+     * @returns referencia al dato del minimo
+     *
+     * \complexity{\O(log(C)) amortizado}
+     */
+    mapped_type& minimum_value();
+
+    /**
+     * @brief Inserción
+     * @param key prioridad del elemento
+     * @param value dato del elemento
+     * \pre \P{key} \GEQ last_minimum()
+     *
+     * @returns handle que apunta al elemento insertado
+     *
+     * \complexity{\O(1)}
+     */
+    handle insert(const key_type& key, const mapped_type& value);
+
+    /**
+     * @brief Inserción moviendo el dato
+     * @param key prioridad del elemento
+     * @param value dato del elemento
+     * \pre \P{key} \GEQ last_minimum()
+     *
+     * @returns handle que apunta al elemento insertado
+     *
+     * \complexity{\O(1)}
+     */
+    handle insert(const key_type& key, mapped_type&& value);
+
+    /**
+     * @brief Inserción construyendo el dato dentro del nodo
+     * @param key prioridad del elemento
+     * @param args argumentos para el constructor de Value
+     * \pre \P{key} \GEQ last_minimum()
+     *
+     * @returns handle que apunta al elemento insertado
+     *
+     * \complexity{\O(1)} más la construcción de Value
+     */
+    template < typename... Args >
+    handle emplace(const key_type& key, Args&&... args);
+
+    /**
+     * @brief Remover minimo, last pasa a ser su prioridad
+     * \complexity{\O(log(C)) amortizado}
+     */
+    void extract_min();
+
+    /**
+     * @brief Remover minimo devolviendo prioridad y dato movidos fuera del nodo
+     * \pre !empty()
+     *
+     * \complexity{\O(log(C)) amortizado}
+     */
+    std::pair<key_type, mapped_type> pop_min();
+
+    /**
+     * @brief Eliminar elemento
+     * @param x handle que apunta al elemento a eliminar
+     *
+     * \complexity{\O(1)}
+     */
+    void delete_key(handle& x);
+
+    /**
+     * @brief Decrementar prioridad, el dato no se toca
+     * @param x handle que apunta al elemento a decrementar
+     * @param key nueva prioridad del elemento
+     * \pre last_minimum() \LEQ \P{key} \AND \P{key} < \P{x}.key()
+     * \post \P{x}.key() == \P{key} \AND el resto de la estructura no cambia
+     *
+     * \complexity{\O(1)}
+     */
+    void decrease_key(const handle& x, const key_type& key);
+
+private:
+
+    static constexpr unsigned int bucket_count = std::numeric_limits<Key>::digits + 1;
+
+    /**
+     * Nodo de la estructura:
+     * - Enlaces de la lista doble de su balde y el número de balde
+     * - Después la prioridad y al final el dato
+     */
+    struct Node {
+
+        /**
+         * @brief crear nodo suelto
+         * @param key prioridad
+         * @param args argumentos para construir el dato
+         *
+         * \complexity{\O(1)} más la construcción de Value
+         */
+        template < typename... Args >
+        explicit Node(const key_type& key, Args&&... args);
+
+        /** @{ */
+        Node* prev;
+        Node* next;
+        unsigned int bucket;
+        key_type key;
+        mapped_type value;
+        /** @} */
+    };
+
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    /**
+     * @brief Pedir y construir un nodo con el allocator
+     *
+     * \complexity{\O(1)} más la construcción de Value
+     */
+    template < typename... Args >
+    Node* create_node(Args&&... args);
+
+    /**
+     * @brief Destruir un nodo y devolver su memoria al allocator
+     * @param x nodo a destruir
+     *
+     * \complexity{\O(1)}
+     */
+    void destroy_node(Node* x);
+
+    /**
+     * @returns balde de key respecto de last
+     * \pre key \GEQ last
+     *
+     * \complexity{\O(1)}
+     */
+    unsigned int bucket_of(const key_type& key) const;
+
+    /**
+     * @brief Poner un nodo al principio de su balde según su prioridad
+     * @param x nodo suelto
+     *
+     * \complexity{\O(1)}
+     */
+    void push_bucket(Node* x);
+
+    /**
+     * @brief Sacar un nodo de su balde sin destruirlo
+     * @param x nodo a sacar
+     *
+     * \complexity{\O(1)}
+     */
+    void unlink(Node* x);
+
+    /**
+     * @brief Dejar el minimo en el balde 0
+     * Si el balde 0 está vacio el minimo del primer balde no vacio pasa a ser last y ese balde se reparte
+     * \pre !empty()
+     * \post buckets[0] != nullptr \AND buckets[0]->key == last
+     *
+     * \complexity{\O(tamaño del balde repartido)}
+     */
+    void settle();
+
+    /**
+     * @brief Poner un nodo nuevo en su balde
+     * @param node nodo a agregar
+     *
+     * @returns handle que apunta al nodo
+     *
+     * \complexity{\O(1)}
+     */
+    handle link_node(Node* node);
+
+    /**
+     * @brief copiar los nodos de h en los mismos baldes
+     * Si el allocator tiene reserve(n) se piden todos los nodos juntos
+     * @param h heap a copiar
+     * \pre empty()
+     *
+     * \complexity{\O(n)}
+     */
+    void clone_from(const radix_heap& h);
+
+    /** @{ */
+    Node* buckets[bucket_count];
+    // Bit b - 1 prendido \IFF el balde b > 0 no está vacio
+    unsigned long long int occupied;
+    key_type last;
+    size_type count;
+    node_allocator alloc;
+    /** @} */
+};
+
+template < typename Key, typename Value, typename Allocator >
+class radix_heap<Key, Value, Allocator>::handle {
+public:
+
+    /**
+     * @returns true \IFF apuntan al mismo elemento
+     *
+     * \complexity{\O(1)}
+     */
+    bool operator==(const handle& other) const;
+
+    /**
+     * @returns false \IFF apuntan al mismo elemento
+     *
+     * \complexity{\O(1)}
+     */
+    bool operator!=(const handle& other) const;
+
+    /**
+     * @brief Prioridad del elemento
+     * \pre El handle debe estar apuntando a un elemento.
+     *
+     * \complexity{\O(1)}
+     */
+    const key_type& key() const;
+
+    /**
+     * @brief Dato del elemento, modificable porque no participa del orden
+     * \pre El handle debe estar apuntando a un elemento.
+     *
+     * \complexity{\O(1)}
+     */
+    mapped_type& value() const;
+
+private:
+
+    friend class radix_heap;
+
+    /**
+     * @brief Constructor
+     * @param x puntero al nodo que el handle estará ligado
+     */
+    handle(Node* x);
+
+    /** @{ */
+    Node* n;
+    /** @} */
+};
+
+#include "radix_heap.hpp"
+
+#endif //RADIX_HEAP_H
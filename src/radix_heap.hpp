@@ -0,0 +1,303 @@
+#include "radix_heap.h"
+
+template<typename Key, typename Value, typename Allocator>
+radix_heap<Key, Value, Allocator>::radix_heap() : occupied(0), last(0), count(0), alloc() {
+    std::fill(buckets, buckets + bucket_count, nullptr);
+}
+
+template<typename Key, typename Value, typename Allocator>
+radix_heap<Key, Value, Allocator>::radix_heap(const allocator_type &alloc) : occupied(0), last(0), count(0), alloc(alloc) {
+    std::fill(buckets, buckets + bucket_count, nullptr);
+}
+
+template<typename Key, typename Value, typename Allocator>
+radix_heap<Key, Value, Allocator>::~radix_heap() {
+    clear();
+}
+
+template<typename Key, typename Value, typename Allocator>
+radix_heap<Key, Value, Allocator>::radix_heap(const radix_heap &h) : occupied(0), last(0), count(0), alloc(node_traits::select_on_container_copy_construction(h.alloc)) {
+    std::fill(buckets, buckets + bucket_count, nullptr);
+    clone_from(h);
+}
+
+template<typename Key, typename Value, typename Allocator>
+radix_heap<Key, Value, Allocator> &radix_heap<Key, Value, Allocator>::operator=(const radix_heap &h) {
+    if(this != &h){
+        clear();
+        if(node_traits::propagate_on_container_copy_assignment::value){
+            alloc = h.alloc;
+        }
+        clone_from(h);
+    }
+    return *this;
+}
+
+template<typename Key, typename Value, typename Allocator>
+radix_heap<Key, Value, Allocator>::radix_heap(radix_heap &&h) noexcept : occupied(h.occupied), last(h.last), count(h.count), alloc(h.alloc) {
+    std::copy(h.buckets, h.buckets + bucket_count, buckets);
+    std::fill(h.buckets, h.buckets + bucket_count, nullptr);
+    h.occupied = 0;
+    h.last = 0;
+    h.count = 0;
+}
+
+template<typename Key, typename Value, typename Allocator>
+radix_heap<Key, Value, Allocator> &radix_heap<Key, Value, Allocator>::operator=(radix_heap &&h) noexcept {
+    clear();
+    if(node_traits::propagate_on_container_move_assignment::value){
+        alloc = h.alloc;
+    }
+    assert(h.empty() || alloc == h.alloc);
+    std::swap_ranges(buckets, buckets + bucket_count, h.buckets);
+    std::swap(occupied, h.occupied);
+    std::swap(last, h.last);
+    std::swap(count, h.count);
+    return *this;
+}
+
+template<typename Key, typename Value, typename Allocator>
+void radix_heap<Key, Value, Allocator>::clear() {
+    for (unsigned int b = 0; b < bucket_count; ++b) {
+        Node* x = buckets[b];
+        while (x != nullptr) {
+            Node* next = x->next;
+            destroy_node(x);
+            x = next;
+        }
+        buckets[b] = nullptr;
+    }
+    occupied = 0;
+    last = 0;
+    count = 0;
+}
+
+template<typename Key, typename Value, typename Allocator>
+void radix_heap<Key, Value, Allocator>::swap(radix_heap &h) {
+    if(node_traits::propagate_on_container_swap::value){
+        std::swap(alloc,h.alloc);
+    }
+    assert(alloc == h.alloc);
+    std::swap_ranges(buckets, buckets + bucket_count, h.buckets);
+    std::swap(occupied, h.occupied);
+    std::swap(last, h.last);
+    std::swap(count, h.count);
+}
+
+template<typename Key, typename Value, typename Allocator>
+typename radix_heap<Key, Value, Allocator>::allocator_type radix_heap<Key, Value, Allocator>::get_allocator() const {
+    return allocator_type(alloc);
+}
+
+template<typename Key, typename Value, typename Allocator>
+bool radix_heap<Key, Value, Allocator>::empty() const {
+    return count == 0;
+}
+
+template<typename Key, typename Value, typename Allocator>
+typename radix_heap<Key, Value, Allocator>::size_type radix_heap<Key, Value, Allocator>::size() const {
+    return count;
+}
+
+template<typename Key, typename Value, typename Allocator>
+typename radix_heap<Key, Value, Allocator>::key_type radix_heap<Key, Value, Allocator>::last_minimum() const {
+    return last;
+}
+
+template<typename Key, typename Value, typename Allocator>
+const typename radix_heap<Key, Value, Allocator>::key_type &radix_heap<Key, Value, Allocator>::minimum() {
+    settle();
+    return buckets[0]->key;
+}
+
+template<typename Key, typename Value, typename Allocator>
+typename radix_heap<Key, Value, Allocator>::mapped_type &radix_heap<Key, Value, Allocator>::minimum_value() {
+    settle();
+    return buckets[0]->value;
+}
+
+template<typename Key, typename Value, typename Allocator>
+typename radix_heap<Key, Value, Allocator>::handle radix_heap<Key, Value, Allocator>::insert(const key_type &key, const mapped_type &value) {
+    return link_node(create_node(key, value));
+}
+
+template<typename Key, typename Value, typename Allocator>
+typename radix_heap<Key, Value, Allocator>::handle radix_heap<Key, Value, Allocator>::insert(const key_type &key, mapped_type &&value) {
+    return link_node(create_node(key, std::move(value)));
+}
+
+template<typename Key, typename Value, typename Allocator>
+template<typename... Args>
+typename radix_heap<Key, Value, Allocator>::handle radix_heap<Key, Value, Allocator>::emplace(const key_type &key, Args &&... args) {
+    return link_node(create_node(key, std::forward<Args>(args)...));
+}
+
+template<typename Key, typename Value, typename Allocator>
+void radix_heap<Key, Value, Allocator>::extract_min() {
+    if(!empty()){
+        settle();
+        Node* x = buckets[0];
+        unlink(x);
+        destroy_node(x);
+        --count;
+    }
+}
+
+template<typename Key, typename Value, typename Allocator>
+std::pair<typename radix_heap<Key, Value, Allocator>::key_type, typename radix_heap<Key, Value, Allocator>::mapped_type> radix_heap<Key, Value, Allocator>::pop_min() {
+    assert(!empty());
+    settle();
+    Node* x = buckets[0];
+    unlink(x);
+    --count;
+    std::pair<key_type, mapped_type> res(x->key, std::move(x->value));
+    destroy_node(x);
+    return res;
+}
+
+template<typename Key, typename Value, typename Allocator>
+void radix_heap<Key, Value, Allocator>::delete_key(handle &x) {
+    unlink(x.n);
+    destroy_node(x.n);
+    --count;
+}
+
+template<typename Key, typename Value, typename Allocator>
+void radix_heap<Key, Value, Allocator>::decrease_key(const handle &x, const key_type &key) {
+    assert(last <= key && key < x.n->key);
+    x.n->key = key;
+    if(bucket_of(key) != x.n->bucket){
+        unlink(x.n);
+        push_bucket(x.n);
+    }
+}
+
+template<typename Key, typename Value, typename Allocator>
+template<typename... Args>
+typename radix_heap<Key, Value, Allocator>::Node *radix_heap<Key, Value, Allocator>::create_node(Args &&... args) {
+    Node* x = node_traits::allocate(alloc, 1);
+    try{
+        node_traits::construct(alloc, x, std::forward<Args>(args)...);
+    }catch(...){
+        node_traits::deallocate(alloc, x, 1);
+        throw;
+    }
+    return x;
+}
+
+template<typename Key, typename Value, typename Allocator>
+void radix_heap<Key, Value, Allocator>::destroy_node(Node *x) {
+    node_traits::destroy(alloc, x);
+    node_traits::deallocate(alloc, x, 1);
+}
+
+template<typename Key, typename Value, typename Allocator>
+unsigned int radix_heap<Key, Value, Allocator>::bucket_of(const key_type &key) const {
+    assert(last <= key);
+    return key == last ? 0 : floor_log2ul(static_cast<unsigned long long int>(key ^ last)) + 1;
+}
+
+template<typename Key, typename Value, typename Allocator>
+void radix_heap<Key, Value, Allocator>::push_bucket(Node *x) {
+    unsigned int b = bucket_of(x->key);
+    x->bucket = b;
+    x->prev = nullptr;
+    x->next = buckets[b];
+    if(x->next != nullptr){
+        x->next->prev = x;
+    }
+    buckets[b] = x;
+    if(b != 0){
+        occupied |= 1ULL << (b - 1);
+    }
+}
+
+template<typename Key, typename Value, typename Allocator>
+void radix_heap<Key, Value, Allocator>::unlink(Node *x) {
+    if(x->prev != nullptr){
+        x->prev->next = x->next;
+    }else{
+        buckets[x->bucket] = x->next;
+        if(x->next == nullptr && x->bucket != 0){
+            occupied &= ~(1ULL << (x->bucket - 1));
+        }
+    }
+    if(x->next != nullptr){
+        x->next->prev = x->prev;
+    }
+}
+
+template<typename Key, typename Value, typename Allocator>
+void radix_heap<Key, Value, Allocator>::settle() {
+    assert(!empty());
+    if(buckets[0] != nullptr){
+        return;
+    }
+    // Primer balde no vacio: el bit prendido más bajo de occupied
+    unsigned int b = floor_log2ul(occupied & (~occupied + 1)) + 1;
+    Node* x = buckets[b];
+    buckets[b] = nullptr;
+    occupied &= ~(1ULL << (b - 1));
+    last = x->key;
+    for (Node* y = x->next; y != nullptr; y = y->next) {
+        if(y->key < last){
+            last = y->key;
+        }
+    }
+    // Todas las claves del balde coinciden con last hasta el bit b - 1, así que caen en baldes menores a b
+    while (x != nullptr) {
+        Node* next = x->next;
+        push_bucket(x);
+        x = next;
+    }
+}
+
+template<typename Key, typename Value, typename Allocator>
+typename radix_heap<Key, Value, Allocator>::handle radix_heap<Key, Value, Allocator>::link_node(Node *node) {
+    push_bucket(node);
+    ++count;
+    return handle(node);
+}
+
+template<typename Key, typename Value, typename Allocator>
+void radix_heap<Key, Value, Allocator>::clone_from(const radix_heap &h) {
+    allocator_reserve(alloc, h.size());
+    last = h.last;
+    try{
+        for (unsigned int b = 0; b < bucket_count; ++b) {
+            for (const Node* x = h.buckets[b]; x != nullptr; x = x->next) {
+                link_node(create_node(x->key, x->value));
+            }
+        }
+    }catch(...){
+        clear();
+        throw;
+    }
+}
+
+template<typename Key, typename Value, typename Allocator>
+template<typename... Args>
+radix_heap<Key, Value, Allocator>::Node::Node(const key_type &key, Args &&... args) : prev(nullptr), next(nullptr), bucket(0), key(key), value(std::forward<Args>(args)...) {}
+
+template<typename Key, typename Value, typename Allocator>
+bool radix_heap<Key, Value, Allocator>::handle::operator==(const handle &other) const {
+    return n == other.n;
+}
+
+template<typename Key, typename Value, typename Allocator>
+bool radix_heap<Key, Value, Allocator>::handle::operator!=(const handle &other) const {
+    return n != other.n;
+}
+
+template<typename Key, typename Value, typename Allocator>
+const typename radix_heap<Key, Value, Allocator>::key_type &radix_heap<Key, Value, Allocator>::handle::key() const {
+    return n->key;
+}
+
+template<typename Key, typename Value, typename Allocator>
+typename radix_heap<Key, Value, Allocator>::mapped_type &radix_heap<Key, Value, Allocator>::handle::value() const {
+    return n->value;
+}
+
+template<typename Key, typename Value, typename Allocator>
+radix_heap<Key, Value, Allocator>::handle::handle(Node *x) : n(x) {}
@@ -0,0 +1,112 @@
+#include "timer_queue.h"
+#include <cassert>
+
+timer_queue::timer_queue() : sequence(0) {}
+
+bool timer_queue::empty() const {
+    return heap.empty();
+}
+
+timer_queue::size_type timer_queue::size() const {
+    return heap.size();
+}
+
+timer_queue::time_type timer_queue::next_deadline() const {
+    assert(!empty());
+    return heap.minimum().first;
+}
+
+bool timer_queue::pending(timer_id id) const {
+    return find(id) != slots.size();
+}
+
+timer_queue::timer_id timer_queue::schedule(time_type deadline, callback_type callback) {
+    std::uint32_t i;
+    if(free_slots.empty()){
+        i = static_cast<std::uint32_t>(slots.size());
+        heap_type::handle node = heap.insert(key_type(deadline, sequence), i);
+        try {
+            slots.emplace_back(node);
+        } catch (...) {
+            heap.delete_key(node);
+            throw;
+        }
+    }else{
+        i = free_slots.back();
+        slots[i].node = heap.insert(key_type(deadline, sequence), i);
+        free_slots.pop_back();
+    }
+    ++sequence;
+    slot& s = slots[i];
+    s.callback = std::move(callback);
+    s.active = true;
+    return (static_cast<timer_id>(s.generation) << 32) | i;
+}
+
+bool timer_queue::cancel(timer_id id) {
+    size_type i = find(id);
+    if(i == slots.size()){
+        return false;
+    }
+    heap.delete_key(slots[i].node);
+    release(static_cast<std::uint32_t>(i));
+    return true;
+}
+
+bool timer_queue::reschedule(timer_id id, time_type deadline) {
+    size_type i = find(id);
+    if(i == slots.size()){
+        return false;
+    }
+    slot& s = slots[i];
+    key_type key(deadline, sequence++);
+    if(deadline < s.node.key().first){
+        heap.decrease_key(s.node, key);
+    }else{
+        // Primero el nodo nuevo: si insert lanza una excepción el timer sigue con su nodo viejo
+        heap_type::handle fresh = heap.insert(key, static_cast<std::uint32_t>(i));
+        heap.delete_key(s.node);
+        s.node = fresh;
+    }
+    return true;
+}
+
+timer_queue::size_type timer_queue::run_expired(time_type now) {
+    size_type fired = 0;
+    while (!heap.empty() && heap.minimum().first <= now) {
+        std::uint32_t i = heap.minimum_value();
+        heap.extract_min();
+        callback_type callback = std::move(slots[i].callback);
+        release(i);
+        ++fired;
+        callback();
+    }
+    return fired;
+}
+
+void timer_queue::clear() {
+    heap.clear();
+    for (size_type i = 0; i < slots.size(); ++i) {
+        if(slots[i].active){
+            release(static_cast<std::uint32_t>(i));
+        }
+    }
+}
+
+timer_queue::size_type timer_queue::find(timer_id id) const {
+    size_type i = static_cast<size_type>(id & 0xFFFFFFFFU);
+    if(i >= slots.size() || !slots[i].active || slots[i].generation != static_cast<std::uint32_t>(id >> 32)){
+        return slots.size();
+    }
+    return i;
+}
+
+void timer_queue::release(std::uint32_t i) {
+    slot& s = slots[i];
+    s.callback = nullptr;
+    s.active = false;
+    ++s.generation;
+    free_slots.push_back(i);
+}
+
+timer_queue::slot::slot(const heap_type::handle &h) : node(h), generation(0), active(false) {}
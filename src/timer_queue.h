@@ -0,0 +1,162 @@
+#ifndef TIMER_QUEUE_H
+#define TIMER_QUEUE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+#include "keyed_fibonacci_heap.h"
+
+/**
+ * Cola de timers sobre keyed_fibonacci_heap, pensada para servicios con muchos timeouts que en su mayoría se
+ * cancelan o se adelantan antes de vencer.
+ * - schedule devuelve un id; cancel y reschedule con un id que ya venció o se canceló no hacen nada
+ *   (cada id lleva una generación, así un id viejo nunca toca a otro timer que reusó el lugar)
+ * - cancel es delete_key, adelantar un timer es decrease_key y atrasarlo es delete_key más una inserción
+ * - run_expired(now) ejecuta en orden de vencimiento todos los timers con deadline <= now; los que vencen
+ *   a la vez se ejecutan en el orden en que se programaron
+ * - Los callbacks se guardan fuera del heap, así los nodos que recorre consolidate() quedan chicos
+ * - El tiempo está en las unidades que use quien llama (ticks, milisegundos, etc)
+ */
+class timer_queue {
+public:
+    using time_type = std::uint64_t;
+    using callback_type = std::function<void()>;
+    using timer_id = std::uint64_t;
+    using size_type = size_t;
+
+    /**
+     * @brief Construye cola sin timers
+     * \complexity{\O(1)}
+     */
+    timer_queue();
+
+    /**
+     * @returns true \IFF no hay timers pendientes
+     *
+     * \complexity{\O(1)}
+     */
+    bool empty() const;
+
+    /**
+     * @returns cantidad de timers pendientes
+     *
+     * \complexity{\O(1)}
+     */
+    size_type size() const;
+
+    /**
+     * @returns vencimiento del próximo timer
+     * \pre !empty()
+     *
+     * \complexity{\O(1)}
+     */
+    time_type next_deadline() const;
+
+    /**
+     * @returns true \IFF id corresponde a un timer que no venció ni se canceló
+     *
+     * \complexity{\O(1)}
+     */
+    bool pending(timer_id id) const;
+
+    /**
+     * @brief Programar un timer
+     * @param deadline momento en que vence
+     * @param callback función a ejecutar cuando vence
+     *
+     * @returns id del timer
+     *
+     * \complexity{\O(1)} amortizado
+     */
+    timer_id schedule(time_type deadline, callback_type callback);
+
+    /**
+     * @brief Cancelar un timer sin ejecutarlo
+     * @param id timer a cancelar
+     *
+     * @returns false \IFF el timer ya no estaba pendiente
+     *
+     * \complexity{\O(log(n) amortizado)}
+     */
+    bool cancel(timer_id id);
+
+    /**
+     * @brief Cambiar el vencimiento de un timer
+     * Si se adelanta es decrease_key; si se atrasa (o no cambia) se saca y se vuelve a insertar, y queda después
+     * de los otros timers con el mismo vencimiento
+     * @param id timer a reprogramar
+     * @param deadline nuevo vencimiento
+     *
+     * @returns false \IFF el timer ya no estaba pendiente
+     *
+     * \complexity{\O(1) amortizado} si se adelanta, \O(log(n) amortizado) si no
+     */
+    bool reschedule(timer_id id, time_type deadline);
+
+    /**
+     * @brief Ejecutar los timers vencidos
+     * Cada timer se saca de la cola antes de ejecutar su callback, así el callback puede programar, cancelar o
+     * reprogramar timers. Los que programe con deadline <= now también se ejecutan en esta llamada.
+     * Si un callback lanza una excepción, su timer ya no está y el resto queda pendiente
+     * @param now momento actual
+     *
+     * @returns cantidad de timers ejecutados
+     *
+     * \complexity{\O(k log(n) amortizado)} con k timers vencidos
+     */
+    size_type run_expired(time_type now);
+
+    /**
+     * @brief Cancelar todos los timers
+     *
+     * \complexity{\O(n)}
+     */
+    void clear();
+
+private:
+
+    /**
+     * Prioridad en el heap: vencimiento y número de orden de programación para desempatar
+     */
+    using key_type = std::pair<time_type, std::uint64_t>;
+    using heap_type = keyed_fibonacci_heap<key_type, std::uint32_t>;
+
+    /**
+     * Lugar de un timer, se reusa cuando el timer vence o se cancela
+     */
+    struct slot {
+        explicit slot(const heap_type::handle& h);
+
+        /** @{ */
+        heap_type::handle node;
+        callback_type callback;
+        std::uint32_t generation;
+        bool active;
+        /** @} */
+    };
+
+    /**
+     * @returns índice del lugar de id si el timer está pendiente, o slots.size() si no
+     *
+     * \complexity{\O(1)}
+     */
+    size_type find(timer_id id) const;
+
+    /**
+     * @brief Liberar el lugar i para que lo use otro timer, invalidando su id
+     *
+     * \complexity{\O(1)}
+     */
+    void release(std::uint32_t i);
+
+    /** @{ */
+    heap_type heap;
+    std::vector<slot> slots;
+    std::vector<std::uint32_t> free_slots;
+    std::uint64_t sequence;
+    /** @} */
+};
+
+#endif //TIMER_QUEUE_H
@@ -1,11 +1,42 @@
 #include "utils.h"
+#include <climits>
 
-unsigned int log2ul(unsigned long long int n){
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+/**
+ * @brief Posición del bit más significativo de m | 1
+ *
+ * \complexity{\O(1)}
+ */
+static unsigned int highest_bit(unsigned long long int m){
+    m |= 1U;
+#if defined(__GNUC__) || defined(__clang__)
+    return sizeof(unsigned long long int) * CHAR_BIT - 1 - __builtin_clzll(m);
+#elif defined(_MSC_VER) && defined(_WIN64)
+    unsigned long res;
+    _BitScanReverse64(&res, m);
+    return res;
+#else
     unsigned int res = 0;
-    unsigned long long int temp = 1;
-    while(temp < n){
-        ++res;
-        temp = temp << 1U;
+    for (unsigned int shift = sizeof(unsigned long long int) * CHAR_BIT / 2; shift > 0; shift >>= 1U) {
+        unsigned long long int high = m >> shift;
+        if(high != 0){
+            m = high;
+            res += shift;
+        }
     }
     return res;
-}
\ No newline at end of file
+#endif
+}
+
+unsigned int log2ul(unsigned long long int n){
+    unsigned int res = highest_bit(n - 1) + 1;
+    // Se compila a un movimiento condicional, sin saltos
+    return n > 1 ? res : 0;
+}
+
+unsigned int floor_log2ul(unsigned long long int n){
+    return highest_bit(n);
+}
@@ -1,16 +1,174 @@
 #ifndef UTILS_H
 #define UTILS_H
 
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
 /**
  * @brief Logaritmo en base 2
  * @param n número a hacerle logaritmo
  *
- * @returns log2(n) redondeado para arriba
+ * @returns log2(n) redondeado para arriba (0 si n \LEQ 1)
  *
- * \complexity{log(n)}
+ * Usa la instrucción de contar ceros a la izquierda cuando el compilador la provee
+ * y si no una búsqueda binaria de cantidad fija de pasos
  *
- * \bug Si el resultado esperado es 64 se cuelga
+ * \complexity{\O(1)}
  */
 unsigned int log2ul(unsigned long long int n);
 
+/**
+ * @brief Logaritmo en base 2 redondeado para abajo
+ * @param n número a hacerle logaritmo
+ *
+ * @returns posición del bit más significativo de n (0 si n \LEQ 1)
+ *
+ * \complexity{\O(1)}
+ */
+unsigned int floor_log2ul(unsigned long long int n);
+
+/**
+ * @brief Logaritmo en base 2 redondeado para abajo, evaluable en tiempo de compilación
+ * @param n número a hacerle logaritmo
+ *
+ * @returns log2(n) redondeado para abajo (0 si n \LEQ 1)
+ *
+ * \complexity{\O(log(n))} recursiones (a lo sumo 64), pensado para constantes
+ */
+constexpr unsigned int constexpr_floor_log2ul(unsigned long long int n){
+    return n < 2 ? 0 : 1 + constexpr_floor_log2ul(n >> 1U);
+}
+
+/**
+ * @brief Logaritmo en base 2, evaluable en tiempo de compilación
+ * @param n número a hacerle logaritmo
+ *
+ * @returns log2(n) redondeado para arriba (0 si n \LEQ 1), igual que log2ul(n)
+ *
+ * \complexity{\O(log(n))} recursiones (a lo sumo 64), pensado para constantes
+ */
+constexpr unsigned int constexpr_log2ul(unsigned long long int n){
+    return n < 2 ? 0 : 1 + constexpr_floor_log2ul(n - 1);
+}
+
+/**
+ * @brief Auxiliar de fibonacci_rank_bound
+ * @param n cantidad de nodos
+ * @param f F(k+2)
+ * @param g F(k+3)
+ * @param k grado candidato
+ *
+ * \complexity{\O(log(n))} recursiones
+ */
+constexpr unsigned int fibonacci_rank_bound_from(unsigned long long int n, unsigned long long int f, unsigned long long int g, unsigned int k){
+    return (g > n || g < f) ? k : fibonacci_rank_bound_from(n, g, f + g, k + 1);
+}
+
+/**
+ * @brief Máximo grado posible de un nodo en un fibonacci heap de n elementos
+ * @param n cantidad de elementos
+ *
+ * Un nodo de grado k tiene al menos F(k+2) descendientes (contándose) con F los números de Fibonacci,
+ * y F(k+2) \GEQ phi^k, así que el grado está acotado por log_phi(n) ~ 1.44 log2(n)
+ *
+ * @returns el mayor k tal que F(k+2) \LEQ n (0 si n \LEQ 1)
+ *
+ * \complexity{\O(log(n))} recursiones, pensado para constantes
+ */
+constexpr unsigned int fibonacci_rank_bound(unsigned long long int n){
+    return fibonacci_rank_bound_from(n, 1, 2, 0);
+}
+
+/**
+ * Guarda un objeto de tipo T aplicando empty base optimization cuando T es una clase vacía no final
+ * (comparadores y allocators sin estado no ocupan lugar en la clase que hereda de ebo_holder).
+ * Tag permite heredar de más de un ebo_holder del mismo tipo.
+ */
+template < typename T, int Tag = 0, bool = std::is_empty<T>::value && !__is_final(T) >
+class ebo_holder {
+public:
+    ebo_holder() : value() {}
+    explicit ebo_holder(const T& v) : value(v) {}
+
+    /**
+     * @returns referencia al objeto guardado
+     *
+     * \complexity{\O(1)}
+     */
+    T& get() { return value; }
+    const T& get() const { return value; }
+
+private:
+    T value;
+};
+
+template < typename T, int Tag >
+class ebo_holder<T, Tag, true> : private T {
+public:
+    ebo_holder() : T() {}
+    explicit ebo_holder(const T& v) : T(v) {}
+
+    T& get() { return *this; }
+    const T& get() const { return *this; }
+};
+
+/**
+ * @brief Auxiliar de allocator_reserve para allocators con reserve(n)
+ */
+template < typename A >
+auto allocator_reserve_impl(A& alloc, std::size_t n, int) -> decltype(alloc.reserve(n), void()) {
+    alloc.reserve(n);
+}
+
+/**
+ * @brief Auxiliar de allocator_reserve para allocators sin reserve(n)
+ */
+template < typename A >
+void allocator_reserve_impl(A&, std::size_t, long) {}
+
+/**
+ * @brief Avisar al allocator que se van a pedir n elementos de a uno
+ * Si el allocator tiene reserve(n) (como pool_allocator) lo llama, si no no hace nada
+ * @param alloc allocator
+ * @param n cantidad de elementos
+ *
+ * \complexity{\O(1)} más lo que cueste reserve
+ */
+template < typename A >
+void allocator_reserve(A& alloc, std::size_t n) {
+    allocator_reserve_impl(alloc, n, 0);
+}
+
+/**
+ * @brief Auxiliar de range_size_hint para iteradores de una sola pasada, no se pueden recorrer dos veces
+ */
+template < typename It >
+std::size_t range_size_hint_impl(It, It, std::input_iterator_tag) {
+    return 0;
+}
+
+/**
+ * @brief Auxiliar de range_size_hint para iteradores forward o mejores
+ */
+template < typename It >
+std::size_t range_size_hint_impl(It first, It last, std::forward_iterator_tag) {
+    return static_cast<std::size_t>(std::distance(first, last));
+}
+
+/**
+ * @brief Cantidad de elementos de un rango si se puede saber sin consumirlo
+ * @param first inicio del rango
+ * @param last fin del rango
+ *
+ * @returns std::distance(first, last) para iteradores forward o mejores, 0 para input iterators
+ *
+ * \complexity{\O(1)} para random access, \O(distance) para el resto de los forward
+ */
+template < typename It >
+std::size_t range_size_hint(It first, It last) {
+    return range_size_hint_impl(first, last, typename std::iterator_traits<It>::iterator_category());
+}
+
 #endif //UTILS_H
@@ -0,0 +1,160 @@
+#include "gtest/gtest.h"
+#include "../src/blocking_fibonacci_heap.h"
+#include <atomic>
+#include <chrono>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+TEST(blocking_fibonacci_heap_test, sin_esperas_saca_en_orden) {
+    blocking_fibonacci_heap<int> q;
+    EXPECT_EQ(q.capacity(),0);
+    EXPECT_TRUE(q.empty());
+    int x = 7;
+    EXPECT_FALSE(q.try_pop(x));
+    EXPECT_EQ(x,7);
+    for (int i = 10; i > 0; --i) {
+        EXPECT_TRUE(q.push(i));
+    }
+    EXPECT_EQ(q.size(),10);
+    for (int i = 1; i <= 10; ++i) {
+        ASSERT_TRUE(q.try_pop(x));
+        EXPECT_EQ(x,i);
+    }
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(blocking_fibonacci_heap_test, pop_wait_for_vence) {
+    blocking_fibonacci_heap<int> q;
+    int x = 7;
+    auto antes = chrono::steady_clock::now();
+    EXPECT_FALSE(q.pop_wait_for(x, chrono::milliseconds(20)));
+    EXPECT_GE(chrono::steady_clock::now() - antes, chrono::milliseconds(20));
+    EXPECT_EQ(x,7);
+    q.push(3);
+    EXPECT_TRUE(q.pop_wait_for(x, chrono::milliseconds(20)));
+    EXPECT_EQ(x,3);
+}
+
+TEST(blocking_fibonacci_heap_test, pop_wait_espera_un_push) {
+    blocking_fibonacci_heap<int> q;
+    int x = 0;
+    bool ok = false;
+    thread consumidor([&]{ ok = q.pop_wait(x); });
+    this_thread::sleep_for(chrono::milliseconds(10));
+    q.push(42);
+    consumidor.join();
+    EXPECT_TRUE(ok);
+    EXPECT_EQ(x,42);
+}
+
+TEST(blocking_fibonacci_heap_test, capacidad_frena_productores) {
+    blocking_fibonacci_heap<int> q(2);
+    EXPECT_TRUE(q.try_push(5));
+    EXPECT_TRUE(q.try_push(4));
+    EXPECT_FALSE(q.try_push(3));
+    atomic<bool> insertado(false);
+    thread productor([&]{ q.push(1); insertado = true; });
+    this_thread::sleep_for(chrono::milliseconds(20));
+    EXPECT_FALSE(insertado);
+    EXPECT_EQ(q.size(),2);
+    int x;
+    ASSERT_TRUE(q.try_pop(x));
+    EXPECT_EQ(x,4);
+    productor.join();
+    EXPECT_TRUE(insertado);
+    ASSERT_TRUE(q.try_pop(x));
+    EXPECT_EQ(x,1);
+    ASSERT_TRUE(q.try_pop(x));
+    EXPECT_EQ(x,5);
+}
+
+TEST(blocking_fibonacci_heap_test, close_despierta_y_deja_vaciar) {
+    blocking_fibonacci_heap<int> q(1);
+    q.push(9);
+    bool push_ok = true;
+    thread productor([&]{ push_ok = q.push(8); });
+    this_thread::sleep_for(chrono::milliseconds(10));
+    q.close();
+    productor.join();
+    EXPECT_FALSE(push_ok);
+    EXPECT_TRUE(q.closed());
+    EXPECT_FALSE(q.push(1));
+    EXPECT_FALSE(q.try_push(1));
+    int x;
+    EXPECT_TRUE(q.pop_wait(x));
+    EXPECT_EQ(x,9);
+    EXPECT_FALSE(q.pop_wait(x));
+    EXPECT_FALSE(q.pop_wait_for(x, chrono::hours(1)));
+
+    blocking_fibonacci_heap<int> vacia;
+    vector<thread> consumidores;
+    atomic<int> fallidos(0);
+    for (int i = 0; i < 4; ++i) {
+        consumidores.emplace_back([&]{
+            int y;
+            if(!vacia.pop_wait(y)){
+                ++fallidos;
+            }
+        });
+    }
+    this_thread::sleep_for(chrono::milliseconds(10));
+    vacia.close();
+    for (auto& t : consumidores) {
+        t.join();
+    }
+    EXPECT_EQ(fallidos,4);
+}
+
+TEST(blocking_fibonacci_heap_test, drain_saca_todo_en_orden) {
+    blocking_fibonacci_heap<int> q;
+    for (int i = 5; i > 0; --i) {
+        q.push(i);
+    }
+    q.close();
+    vector<int> res;
+    q.drain(back_inserter(res));
+    EXPECT_EQ(res,vector<int>({1, 2, 3, 4, 5}));
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(blocking_fibonacci_heap_test, productores_y_consumidores) {
+    const int productores = 4;
+    const int consumidores = 4;
+    const int por_productor = 5000;
+    blocking_fibonacci_heap<int> q(64);
+    vector<atomic<int> > vistos(productores * por_productor);
+    for (auto& v : vistos) {
+        v = 0;
+    }
+    vector<thread> hilos;
+    for (int c = 0; c < consumidores; ++c) {
+        hilos.emplace_back([&]{
+            int x;
+            while (q.pop_wait(x)) {
+                ++vistos[x];
+            }
+        });
+    }
+    vector<thread> prods;
+    for (int p = 0; p < productores; ++p) {
+        prods.emplace_back([&, p]{
+            for (int i = 0; i < por_productor; ++i) {
+                EXPECT_TRUE(q.push(p * por_productor + i));
+            }
+        });
+    }
+    for (auto& t : prods) {
+        t.join();
+    }
+    q.close();
+    for (auto& t : hilos) {
+        t.join();
+    }
+    for (auto& v : vistos) {
+        ASSERT_EQ(v,1);
+    }
+    EXPECT_TRUE(q.empty());
+}
@@ -0,0 +1,189 @@
+#include "gtest/gtest.h"
+#include "../src/compact_fibonacci_heap.h"
+#include <algorithm>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+TEST(compact_fibonacci_heap_test, vacio) {
+    compact_fibonacci_heap<int> f;
+    EXPECT_TRUE(f.empty());
+    EXPECT_EQ(f.size(),0);
+    EXPECT_EQ(f.capacity(),0);
+}
+
+TEST(compact_fibonacci_heap_test, nodo_mas_chico) {
+    // 5 índices de 32 bits más la clave
+    EXPECT_EQ(compact_fibonacci_heap<int>::bytes_per_element(),24);
+    EXPECT_LE(compact_fibonacci_heap<long long>::bytes_per_element(),32);
+}
+
+TEST(compact_fibonacci_heap_test, ordena) {
+    mt19937 gen(3);
+    uniform_int_distribution<int> dist(-100000,100000);
+    vector<int> esperado(5000);
+    compact_fibonacci_heap<int> f;
+    for (int& x : esperado) {
+        x = dist(gen);
+        f.insert(x);
+    }
+    sort(esperado.begin(), esperado.end());
+    vector<int> obtenido;
+    while (!f.empty()) {
+        obtenido.push_back(f.pop_min());
+    }
+    EXPECT_EQ(obtenido,esperado);
+}
+
+TEST(compact_fibonacci_heap_test, operaciones_al_azar) {
+    // Mismas operaciones en el heap compacto y en un multiset con (clave, id)
+    using heap = compact_fibonacci_heap<pair<int, int> >;
+    mt19937 gen(11);
+    heap f;
+    multiset<pair<int, int> > ref;
+    vector<heap::handle> handles;
+    vector<pair<int, int> > keys;
+    vector<bool> alive;
+    for (int paso = 0; paso < 50000; ++paso) {
+        unsigned int op = gen() % 10;
+        if(op < 4 || ref.empty()){
+            pair<int, int> k(static_cast<int>(gen() % 1000000), static_cast<int>(keys.size()));
+            handles.push_back(f.insert(k));
+            keys.push_back(k);
+            alive.push_back(true);
+            ref.insert(k);
+        }else if(op < 6){
+            EXPECT_EQ(f.minimum(),*ref.begin());
+            alive[f.minimum().second] = false;
+            ref.erase(ref.begin());
+            f.extract_min();
+        }else{
+            size_t i = gen() % keys.size();
+            if(!alive[i]){
+                continue;
+            }
+            ref.erase(ref.find(keys[i]));
+            if(op < 9){
+                keys[i].first -= static_cast<int>(gen() % 1000) + 1;
+                f.decrease_key(handles[i], keys[i]);
+                ref.insert(keys[i]);
+            }else{
+                f.delete_key(handles[i]);
+                alive[i] = false;
+            }
+        }
+        ASSERT_EQ(f.size(),ref.size());
+    }
+    for (size_t i = 0; i < keys.size(); ++i) {
+        if(alive[i]){
+            EXPECT_EQ(f.get(handles[i]),keys[i]);
+        }
+    }
+    while (!f.empty()) {
+        EXPECT_EQ(f.pop_min(),*ref.begin());
+        ref.erase(ref.begin());
+    }
+}
+
+TEST(compact_fibonacci_heap_test, handles_sobreviven_al_crecer) {
+    compact_fibonacci_heap<string> f;
+    vector<compact_fibonacci_heap<string>::handle> handles;
+    for (int i = 0; i < 1000; ++i) {
+        handles.push_back(f.insert(string(40, 'a') + to_string(1000 + i)));
+        // Insertar un elemento del propio heap justo cuando el arreglo se llena
+        if(f.size() == f.capacity()){
+            handles.push_back(f.insert(f.get(handles.front())));
+        }
+    }
+    EXPECT_EQ(f.get(handles[0]),string(40, 'a') + "1000");
+    EXPECT_EQ(f.get(handles[1]),string(40, 'a') + "1001");
+    EXPECT_EQ(f.get(handles.back()),string(40, 'a') + "1999");
+    f.decrease_key(handles.back(), "0");
+    EXPECT_EQ(f.minimum(),"0");
+}
+
+TEST(compact_fibonacci_heap_test, reusa_posiciones_libres) {
+    compact_fibonacci_heap<int> f;
+    f.reserve(100);
+    EXPECT_EQ(f.capacity(),100);
+    for (int ronda = 0; ronda < 10; ++ronda) {
+        for (int i = 0; i < 100; ++i) {
+            f.insert(i * 7 % 100);
+        }
+        for (int i = 0; i < 100; ++i) {
+            EXPECT_EQ(f.pop_min(),i);
+        }
+    }
+    EXPECT_EQ(f.capacity(),100);
+}
+
+TEST(compact_fibonacci_heap_test, copia_conserva_handles) {
+    compact_fibonacci_heap<int> f;
+    vector<compact_fibonacci_heap<int>::handle> handles;
+    for (int i = 0; i < 300; ++i) {
+        handles.push_back(f.insert(1000 + i));
+    }
+    f.extract_min();
+    compact_fibonacci_heap<int> copia(f);
+    copia.decrease_key(handles[150], 1);
+    EXPECT_EQ(copia.minimum(),1);
+    EXPECT_EQ(f.minimum(),1001);
+    f = copia;
+    EXPECT_EQ(f.get(handles[150]),1);
+    compact_fibonacci_heap<int> movido(std::move(copia));
+    EXPECT_TRUE(copia.empty());
+    EXPECT_EQ(movido.size(),299);
+}
+
+TEST(compact_fibonacci_heap_test, unir) {
+    compact_fibonacci_heap<int> a;
+    compact_fibonacci_heap<int> b;
+    for (int i = 0; i < 100; ++i) {
+        (i % 2 == 0 ? a : b).insert(i);
+    }
+    a.extract_min();
+    b.extract_min();
+    a.join(b);
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(a.size(),98);
+    for (int i = 2; i < 100; ++i) {
+        EXPECT_EQ(a.pop_min(),i);
+    }
+}
+
+struct copia_que_falla_al_crecer {
+    static int copias_restantes;
+    int v;
+    copia_que_falla_al_crecer(int v) : v(v) {}
+    copia_que_falla_al_crecer(const copia_que_falla_al_crecer& o) : v(o.v) {
+        if(copias_restantes == 0){
+            throw runtime_error("copia");
+        }
+        --copias_restantes;
+    }
+    copia_que_falla_al_crecer& operator=(const copia_que_falla_al_crecer&) = default;
+    bool operator<(const copia_que_falla_al_crecer& o) const { return v < o.v; }
+};
+int copia_que_falla_al_crecer::copias_restantes = -1;
+
+TEST(compact_fibonacci_heap_test, excepcion_al_crecer) {
+    compact_fibonacci_heap<copia_que_falla_al_crecer> f;
+    for (int i = 0; i < 16; ++i) {
+        f.emplace(100 - i);
+    }
+    EXPECT_EQ(f.capacity(),16);
+    // Sin constructor por movimiento se copia al crecer, y la quinta copia falla
+    copia_que_falla_al_crecer::copias_restantes = 4;
+    EXPECT_THROW(f.emplace(0), runtime_error);
+    copia_que_falla_al_crecer::copias_restantes = -1;
+    EXPECT_EQ(f.capacity(),16);
+    EXPECT_EQ(f.size(),16);
+    for (int i = 85; i <= 100; ++i) {
+        EXPECT_EQ(f.pop_min().v,i);
+    }
+}
@@ -0,0 +1,102 @@
+#include "gtest/gtest.h"
+#include "../src/concurrent_fibonacci_heap.h"
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+TEST(concurrent_fibonacci_heap_test, vacio) {
+    concurrent_fibonacci_heap<int> f(3);
+    EXPECT_EQ(f.stripes(),4);
+    EXPECT_TRUE(f.empty());
+    int x = 7;
+    EXPECT_FALSE(f.try_pop(x));
+    EXPECT_FALSE(f.try_minimum(x));
+    EXPECT_EQ(x,7);
+    f.extract_min();
+    EXPECT_EQ(f.size(),0);
+}
+
+TEST(concurrent_fibonacci_heap_test, un_hilo) {
+    concurrent_fibonacci_heap<int> f;
+    for (int i = 100; i > 0; --i) {
+        f.insert(i);
+    }
+    int x = 0;
+    EXPECT_TRUE(f.try_minimum(x));
+    EXPECT_EQ(x,1);
+    vector<int> primeros;
+    f.pop_k(10, back_inserter(primeros));
+    EXPECT_EQ(primeros.size(),10);
+    EXPECT_EQ(primeros.front(),1);
+    EXPECT_EQ(primeros.back(),10);
+    EXPECT_EQ(f.size(),90);
+    f.clear();
+    EXPECT_TRUE(f.empty());
+}
+
+TEST(concurrent_fibonacci_heap_test, muchos_productores) {
+    const int hilos = 8;
+    const int por_hilo = 5000;
+    concurrent_fibonacci_heap<int> f(4);
+    vector<thread> productores;
+    for (int t = 0; t < hilos; ++t) {
+        productores.emplace_back([&f, t]{
+            for (int i = 0; i < por_hilo; ++i) {
+                f.insert(i * hilos + t);
+            }
+        });
+    }
+    for (thread& p : productores) {
+        p.join();
+    }
+    EXPECT_EQ(f.size(),hilos * por_hilo);
+    // Terminados los productores los minimos salen en orden exacto
+    int x;
+    for (int i = 0; i < hilos * por_hilo; ++i) {
+        ASSERT_TRUE(f.try_pop(x));
+        ASSERT_EQ(x,i);
+    }
+    EXPECT_FALSE(f.try_pop(x));
+}
+
+TEST(concurrent_fibonacci_heap_test, productores_y_consumidores_a_la_vez) {
+    const int hilos = 4;
+    const int por_hilo = 20000;
+    concurrent_fibonacci_heap<int> f;
+    atomic<int> terminados(0);
+    vector<vector<int> > sacados(2);
+    vector<thread> todos;
+    for (int t = 0; t < hilos; ++t) {
+        todos.emplace_back([&f, &terminados, t]{
+            for (int i = 0; i < por_hilo; ++i) {
+                f.insert(i * hilos + t);
+            }
+            ++terminados;
+        });
+    }
+    for (int c = 0; c < 2; ++c) {
+        todos.emplace_back([&f, &terminados, &sacados, c]{
+            int x;
+            while (terminados.load() < hilos || !f.empty()) {
+                if(f.try_pop(x)){
+                    sacados[c].push_back(x);
+                }
+            }
+        });
+    }
+    for (thread& t : todos) {
+        t.join();
+    }
+    vector<int> todos_sacados(sacados[0]);
+    todos_sacados.insert(todos_sacados.end(), sacados[1].begin(), sacados[1].end());
+    sort(todos_sacados.begin(), todos_sacados.end());
+    ASSERT_EQ(todos_sacados.size(),hilos * por_hilo);
+    for (int i = 0; i < hilos * por_hilo; ++i) {
+        ASSERT_EQ(todos_sacados[i],i);
+    }
+    EXPECT_TRUE(f.empty());
+}
@@ -0,0 +1,110 @@
+#include "gtest/gtest.h"
+#include "../src/dary_heap.h"
+#include <algorithm>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Insertar, decrementar, borrar y sacar al azar comparando contra un multiset.
+ * Los 16 bits bajos de cada clave son el id del elemento, así se sabe qué handle dejó de valer al sacar el minimo
+ */
+template < unsigned int D >
+static void igual_que_multiset(unsigned int seed) {
+    mt19937 gen(seed);
+    uniform_int_distribution<long long> distribution(0, 100000);
+    dary_heap<long long, D> f;
+    multiset<long long> esperado;
+    vector<typename dary_heap<long long, D>::handle> handles;
+    vector<size_t> vivos;
+    for (int paso = 0; paso < 20000; ++paso) {
+        unsigned int op = gen() % 8;
+        if(op < 4 || vivos.empty()){
+            long long k = distribution(gen) << 16 | static_cast<long long>(handles.size());
+            vivos.push_back(handles.size());
+            handles.push_back(f.insert(k));
+            esperado.insert(k);
+        }else if(op == 4){
+            size_t id = vivos[gen() % vivos.size()];
+            long long viejo = *handles[id];
+            long long nuevo = viejo - ((1 + distribution(gen) % 1000) << 16);
+            f.decrease_key(handles[id], nuevo);
+            esperado.erase(viejo);
+            esperado.insert(nuevo);
+        }else{
+            size_t pos = gen() % vivos.size();
+            size_t id = vivos[pos];
+            if(op == 5){
+                esperado.erase(*handles[id]);
+                f.delete_key(handles[id]);
+            }else{
+                ASSERT_EQ(f.minimum(),*esperado.begin());
+                id = static_cast<size_t>(f.pop_min() & 0xFFFF);
+                esperado.erase(esperado.begin());
+                pos = static_cast<size_t>(find(vivos.begin(), vivos.end(), id) - vivos.begin());
+            }
+            vivos[pos] = vivos.back();
+            vivos.pop_back();
+        }
+        ASSERT_EQ(f.size(),esperado.size());
+    }
+    vector<long long> res;
+    f.pop_k(f.size(), back_inserter(res));
+    EXPECT_TRUE(equal(res.begin(), res.end(), esperado.begin()));
+}
+
+TEST(dary_heap_test, igual_que_multiset_con_distintos_D) {
+    igual_que_multiset<2>(1);
+    igual_que_multiset<3>(2);
+    igual_que_multiset<8>(3);
+}
+
+TEST(dary_heap_test, handles_despues_de_crecer_y_unir) {
+    dary_heap<int, 8> f1;
+    dary_heap<int, 8> f2;
+    vector<dary_heap<int, 8>::handle> handles;
+    for (int i = 0; i < 1000; ++i) {
+        handles.push_back(f1.insert(i * 2));
+        handles.push_back(f2.insert(i * 2 + 1));
+    }
+    dary_heap<int, 8> f3(std::move(f1));
+    f3.join(f2);
+    EXPECT_TRUE(f2.empty());
+    EXPECT_EQ(f3.size(),2000);
+    for (int i = 0; i < 2000; ++i) {
+        EXPECT_EQ(*handles[i],i);
+    }
+    f3.decrease_key(handles[1999], -1);
+    f3.delete_key(handles[0]);
+    EXPECT_EQ(f3.pop_min(),-1);
+    EXPECT_EQ(f3.pop_min(),1);
+    EXPECT_EQ(*handles[4],4);
+}
+
+TEST(dary_heap_test, insert_range_arma_el_heap_de_abajo_hacia_arriba) {
+    vector<int> numeros(5000);
+    for (size_t i = 0; i < numeros.size(); ++i) {
+        numeros[i] = static_cast<int>((i * 7919) % 5000);
+    }
+    dary_heap<int, 4> f;
+    f.insert(-1);
+    vector<dary_heap<int, 4>::handle> handles;
+    f.insert_range(numeros.begin(), numeros.end(), back_inserter(handles));
+    ASSERT_EQ(handles.size(),numeros.size());
+    for (size_t i = 0; i < numeros.size(); ++i) {
+        EXPECT_EQ(*handles[i],numeros[i]);
+    }
+    vector<int> pocos = {-5, 7000, 3};
+    f.insert_range(pocos.begin(), pocos.end());
+    sort(numeros.begin(), numeros.end());
+    EXPECT_EQ(f.pop_min(),-5);
+    EXPECT_EQ(f.pop_min(),-1);
+    vector<int> res;
+    f.drain_while([](int x){ return x < 5000; }, back_inserter(res));
+    numeros.insert(lower_bound(numeros.begin(), numeros.end(), 3), 3);
+    EXPECT_EQ(res,numeros);
+    EXPECT_EQ(f.pop_min(),7000);
+}
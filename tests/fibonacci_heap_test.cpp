@@ -1,35 +1,43 @@
 #include "gtest/gtest.h"
 #include "../src/fibonacci_heap.h"
+#include "../src/pool_allocator.h"
 #include <algorithm>
+#include <atomic>
 #include <utility>
 #include <chrono>
+#include <iterator>
+#include <list>
+#include <sstream>
+#include <cstdlib>
+#include <memory>
+#include <new>
 #include <random>
 #include <string>
 #include <vector>
+#if defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+#endif
 
 using namespace std;
 
-struct player{
-    string name;
-    int points;
+// Contador de pedidos de memoria global para verificar operaciones que no deben pedir memoria (lo usan otros tests)
+atomic<size_t> global_allocations(0);
 
-    bool operator<(const player& other) const {
-        return points < other.points;
+void* operator new(size_t size) {
+    ++global_allocations;
+    void* p = malloc(size == 0 ? 1 : size);
+    if(p == nullptr){
+        throw bad_alloc();
     }
-};
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    free(p);
+}
 
 random_device rd;
 uniform_int_distribution<unsigned int> distribution(0,100);
-bernoulli_distribution bernoulli(0.5);
-
-fibonacci_heap<unsigned int> random_fib(unsigned int size){
-    fibonacci_heap<unsigned int> res;
-    for (unsigned int i = 0; i < size; ++i) {
-        unsigned int number = distribution(rd);
-        res.insert(number);
-    }
-    return res;
-}
 
 TEST(utils_test, log2ul) {
     EXPECT_EQ(log2ul(0),0);
@@ -45,575 +53,191 @@ TEST(utils_test, log2ul) {
     EXPECT_EQ(log2ul(4294967295),32);
     EXPECT_EQ(log2ul(9223372036854775807),63);
     EXPECT_EQ(log2ul(9223372036854775808ULL),63);
+    EXPECT_EQ(log2ul(9223372036854775809ULL),64);
+    EXPECT_EQ(log2ul(18446744073709551615ULL),64);
+}
+
+TEST(utils_test, constexpr_log2ul) {
+    static_assert(constexpr_log2ul(0) == 0, "log2 de 0");
+    static_assert(constexpr_log2ul(1) == 0, "log2 de 1");
+    static_assert(constexpr_log2ul(5) == 3, "log2 de 5");
+    static_assert(constexpr_floor_log2ul(5) == 2, "log2 de 5");
+    static_assert(constexpr_log2ul(18446744073709551615ULL) == 64, "log2 del maximo");
+    for (unsigned long long int i = 0; i < 5000; ++i) {
+        EXPECT_EQ(log2ul(i),constexpr_log2ul(i));
+    }
+    for (unsigned int b = 1; b < 64; ++b) {
+        unsigned long long int p = 1ULL << b;
+        EXPECT_EQ(log2ul(p - 1),constexpr_log2ul(p - 1));
+        EXPECT_EQ(log2ul(p),constexpr_log2ul(p));
+        EXPECT_EQ(log2ul(p + 1),constexpr_log2ul(p + 1));
+    }
 }
 
-TEST(fibonacci_heap_test, constructor_empty) {
-    fibonacci_heap<int> f1;
-    fibonacci_heap<double> f2;
-    fibonacci_heap<pair<int,unsigned int> > f3;
-}
-
-TEST(fibonacci_heap_test, copiar_empty) {
-    fibonacci_heap<pair<int,double> > f;
-    fibonacci_heap<pair<int,double> > f2;
-    fibonacci_heap<pair<int,double> > f1(f);
-    f2 = f;
-    f = f1;
-}
-
-TEST(fibonacci_heap_test, clear_empty) {
-    fibonacci_heap<pair<int,double> > f;
-    f.clear();
-}
-
-TEST(fibonacci_heap_test, swap_empty) {
-    fibonacci_heap<pair<int,double> > f1;
-    fibonacci_heap<pair<int,double> > f2;
-    f1.swap(f2);
-}
-
-TEST(fibonacci_heap_test, empty_empty) {
-    fibonacci_heap<int> f1;
-    fibonacci_heap<double> f2;
-    fibonacci_heap<pair<int,unsigned int> > f3;
-    EXPECT_TRUE(f1.empty());
-    EXPECT_TRUE(f2.empty());
-    EXPECT_TRUE(f3.empty());
-}
-
-TEST(fibonacci_heap_test, size_empty) {
-    fibonacci_heap<int> f1;
-    fibonacci_heap<double> f2;
-    fibonacci_heap<pair<int,unsigned int> > f3;
-    EXPECT_EQ(f1.size(),0);
-    EXPECT_EQ(f2.size(),0);
-    EXPECT_EQ(f3.size(),0);
-}
-
-TEST(fibonacci_heap_test, insert_one) {
-    fibonacci_heap<int> f1;
-    fibonacci_heap<double> f2;
-    fibonacci_heap<pair<int,unsigned int> > f3;
-    f1.insert(3);
-    f2.insert(2.3);
-    f3.insert({-2,1});
-}
-
-TEST(fibonacci_heap_test, minimum_one) {
-    fibonacci_heap<int> f1;
-    fibonacci_heap<double> f2;
-    fibonacci_heap<pair<int,unsigned int> > f3;
-    f1.insert(3);
-    f2.insert(2.3);
-    f3.insert({-2,1});
-    EXPECT_EQ(f1.minimum(),3);
-    EXPECT_DOUBLE_EQ(f2.minimum(),2.3);
-    EXPECT_EQ(f3.minimum().first,-2);
-    EXPECT_EQ(f3.minimum().second,1);
-}
-
-TEST(fibonacci_heap_test, extract_minimum_one) {
-    fibonacci_heap<int> f1;
-    fibonacci_heap<double> f2;
-    fibonacci_heap<pair<int,unsigned int> > f3;
-    f1.insert(3);
-    f2.insert(2.3);
-    f3.insert({-2,1});
-    f1.extract_min();
-    f2.extract_min();
-    f3.extract_min();
-}
-
-TEST(fibonacci_heap_test, delete_key_one) {
-    fibonacci_heap<int> f1;
-    fibonacci_heap<double> f2;
-    fibonacci_heap<pair<int,unsigned int> > f3;
-    fibonacci_heap<int>::handle h1 = f1.insert(3);
-    fibonacci_heap<double>::handle h2 = f2.insert(2.3);
-    fibonacci_heap<pair<int,unsigned int> >::handle h3 = f3.insert({-2,1});
-    f1.delete_key(h1);
-    f2.delete_key(h2);
-    f3.delete_key(h3);
-}
-
-TEST(fibonacci_heap_test, decrease_key_one) {
-    fibonacci_heap<int> f1;
-    fibonacci_heap<double> f2;
-    fibonacci_heap<pair<int,unsigned int> > f3;
-    fibonacci_heap<int>::handle h1 = f1.insert(3);
-    fibonacci_heap<double>::handle h2 = f2.insert(2.3);
-    fibonacci_heap<pair<int,unsigned int> >::handle h3 = f3.insert({-2,1});
-    f1.decrease_key(h1,-2);
-    f2.decrease_key(h2,1.1);
-    f3.decrease_key(h3,{-2,0});
-}
-
-TEST(fibonacci_heap_test, join_empty) {
-    fibonacci_heap<pair<int,unsigned int> > f1;
-    fibonacci_heap<pair<int,unsigned int> > f2;
-    f1.join(f2);
-}
-
-TEST(fibonacci_heap_test, handle) {
-    fibonacci_heap<pair<double,int> > f1;
-    fibonacci_heap<pair<double,int> >::handle h1 = f1.insert({1.1,-1});
-    fibonacci_heap<pair<double,int> >::handle h2 = f1.insert({2.2,-2});
-    fibonacci_heap<pair<double,int> >::handle h3 = f1.insert({3.3,-3});
-    fibonacci_heap<pair<double,int> >::handle h4(h1);
-    EXPECT_DOUBLE_EQ(h1->first,1.1);
-    EXPECT_DOUBLE_EQ(h2->first,2.2);
-    EXPECT_DOUBLE_EQ(h3->first,3.3);
-    EXPECT_EQ(h1,h4);
-    EXPECT_NE(h1,h2);
-    EXPECT_NE(h1,h3);
-    EXPECT_NE(h3,h2);
-    EXPECT_EQ(f1.minimum(),*h1);
-    f1.extract_min();
-    h1 = h2;
-    h4 = h3;
-    EXPECT_EQ(h1,h2);
-    EXPECT_EQ(h4,h3);
-    EXPECT_NE(h1,h4);
-    EXPECT_EQ(h1->second,-2);
-    EXPECT_EQ(h4->second,-3);
-    EXPECT_EQ(h2->second,-2);
-    EXPECT_EQ(h3->second,-3);
-    EXPECT_EQ(f1.minimum(),*h1);
-    EXPECT_EQ(*h2,*h1);
-    EXPECT_EQ(*h3,*h4);
-    fibonacci_heap<pair<double,int> > f2;
-    h1 = f2.insert({4.7,3});
-    f1.join(f2);
-    EXPECT_NE(h1,h2);
-    EXPECT_EQ(h4,h3);
-    EXPECT_NE(h1,h4);
-    EXPECT_EQ(h1->second,3);
-    EXPECT_EQ(h4->second,-3);
-    EXPECT_EQ(h2->second,-2);
-    EXPECT_EQ(h3->second,-3);
-    EXPECT_EQ(f1.minimum(),*h2);
-    EXPECT_NE(*h2,*h1);
-    EXPECT_EQ(*h3,*h4);
-    f1.extract_min();
-    h2 = h1;
-    EXPECT_EQ(h1,h2);
-    EXPECT_EQ(h4,h3);
-    EXPECT_NE(h1,h4);
-    EXPECT_EQ(h1->second,3);
-    EXPECT_EQ(h4->second,-3);
-    EXPECT_EQ(h2->second,3);
-    EXPECT_EQ(h3->second,-3);
-    EXPECT_EQ(f1.minimum(),*h3);
-    EXPECT_EQ(*h2,*h1);
-    EXPECT_EQ(*h3,*h4);
-}
-
-TEST(fibonacci_heap_test, join_handle) {
-    fibonacci_heap<pair<double,int> > f1;
-    fibonacci_heap<pair<double,int> > f2;
-    fibonacci_heap<pair<double,int> >::handle h1 = f1.insert({1.1,-1});
-    fibonacci_heap<pair<double,int> >::handle h2 = f2.insert({1.1,-1});
-    fibonacci_heap<pair<double,int> >::handle h3 = f1.insert({3.3,-3});
-    EXPECT_DOUBLE_EQ(h1->first,1.1);
-    EXPECT_DOUBLE_EQ(h2->first,1.1);
-    EXPECT_DOUBLE_EQ(h3->first,3.3);
-    EXPECT_NE(h2,h1);
-    EXPECT_NE(h1,h3);
-    EXPECT_NE(h3,h2);
-    EXPECT_EQ(f1.minimum(),*h1);
-    EXPECT_EQ(f2.minimum(),*h2);
-    f1.join(f2);
-    EXPECT_DOUBLE_EQ(h1->first,1.1);
-    EXPECT_DOUBLE_EQ(h2->first,1.1);
-    EXPECT_DOUBLE_EQ(h3->first,3.3);
-    EXPECT_NE(h2,h1);
-    EXPECT_NE(h1,h3);
-    EXPECT_NE(h3,h2);
-    EXPECT_EQ(f1.minimum(),*h1);
-    EXPECT_EQ(f1.minimum(),*h2);
+TEST(utils_test, fibonacci_rank_bound) {
+    static_assert(fibonacci_rank_bound(18446744073709551615ULL) == 91, "cota para 64 bits");
+    EXPECT_EQ(fibonacci_rank_bound(0),0);
+    EXPECT_EQ(fibonacci_rank_bound(1),0);
+    EXPECT_EQ(fibonacci_rank_bound(2),1);
+    EXPECT_EQ(fibonacci_rank_bound(3),2);
+    EXPECT_EQ(fibonacci_rank_bound(4),2);
+    EXPECT_EQ(fibonacci_rank_bound(5),3);
+    EXPECT_EQ(fibonacci_rank_bound(7),3);
+    EXPECT_EQ(fibonacci_rank_bound(8),4);
+    EXPECT_EQ(fibonacci_rank_bound(4294967295ULL),45);
 }
 
-TEST(fibonacci_heap_test, tipo_raro) {
-    fibonacci_heap<player> f1;
-    fibonacci_heap<player> f2;
-    EXPECT_TRUE(f1.empty());
-    EXPECT_TRUE(f2.empty());
-    EXPECT_EQ(f1.size(),0);
-    EXPECT_EQ(f2.size(),0);
-    vector<fibonacci_heap<player>::handle> handles;
-    handles.push_back(f1.insert({"FACUNDO",7}));
-    handles.push_back(f1.insert({"NICOLAS",24}));
-    handles.push_back(f1.insert({"PABLO",17}));
-    handles.push_back(f1.insert({"MATIAS",23}));
-    handles.push_back(f1.insert({"MIGUEL",26}));
-    handles.push_back(f1.insert({"AGUSTIN",46}));
-    handles.push_back(f1.insert({"GONZALO",30}));
-    handles.push_back(f1.insert({"ENZO",35}));
-    handles.push_back(f1.insert({"JUAN",18}));
-    handles.push_back(f1.insert({"MIKE",21}));
-    handles.push_back(f1.insert({"ANGEL",39}));
-    handles.push_back(f1.insert({"RICARDO",52}));
-    handles.push_back(f1.insert({"LUCAS",2}));
-    handles.push_back(f2.insert({"RODOLFO",38}));
-    handles.push_back(f2.insert({"RAUL",41}));
-    handles.push_back(f2.insert({"CIRO",1}));
-    EXPECT_FALSE(f1.empty());
-    EXPECT_FALSE(f2.empty());
-    EXPECT_EQ(f1.size(),13);
-    EXPECT_EQ(f2.size(),3);
-    EXPECT_EQ(f1.minimum().name,handles[12]->name);
-    EXPECT_EQ(f2.minimum().name,handles.back()->name);
-    f1.extract_min();
-    f2.extract_min();
-    EXPECT_FALSE(f1.empty());
-    EXPECT_FALSE(f2.empty());
-    EXPECT_EQ(f1.size(),12);
-    EXPECT_EQ(f2.size(),2);
-    EXPECT_EQ(f1.minimum().name,handles[0]->name);
-    EXPECT_EQ(f2.minimum().name,"RODOLFO");
-    f1.join(f2);
-    EXPECT_FALSE(f1.empty());
-    EXPECT_TRUE(f2.empty());
-    EXPECT_EQ(f1.size(),14);
-    EXPECT_EQ(f2.size(),0);
-    EXPECT_EQ(f1.minimum().name,handles[0]->name);
-    f1.extract_min();
-    EXPECT_FALSE(f1.empty());
-    EXPECT_EQ(f1.size(),13);
-    EXPECT_EQ(f1.minimum().name,"PABLO");
-    f1.decrease_key(handles[11],{"RICARDO",17});
-    EXPECT_FALSE(f1.empty());
-    EXPECT_EQ(f1.size(),13);
-    EXPECT_EQ(f1.minimum().name,"PABLO");
-    EXPECT_EQ(handles[11]->points,17);
-    f1.extract_min();
-    EXPECT_FALSE(f1.empty());
-    EXPECT_EQ(f1.size(),12);
-    EXPECT_EQ(f1.minimum().name,"RICARDO");
-    f1.delete_key(handles[6]);
-    EXPECT_FALSE(f1.empty());
-    EXPECT_EQ(f1.size(),11);
-    EXPECT_EQ(f1.minimum().name,"RICARDO");
-    f1.decrease_key(handles[5],{"AGUSTIN",15});
-    EXPECT_FALSE(f1.empty());
-    EXPECT_EQ(f1.size(),11);
-    EXPECT_EQ(f1.minimum().name,"AGUSTIN");
-    EXPECT_EQ(handles[5]->points,15);
-    f1.decrease_key(handles[13],{"RODOLFO",18});
-    EXPECT_FALSE(f1.empty());
-    EXPECT_EQ(f1.size(),11);
-    EXPECT_EQ(f1.minimum().name,"AGUSTIN");
-    EXPECT_EQ(handles[13]->points,18);
-    f1.decrease_key(handles[8],{"JUAN",14});
-    EXPECT_FALSE(f1.empty());
-    EXPECT_EQ(f1.size(),11);
-    EXPECT_EQ(f1.minimum().name,"JUAN");
-    EXPECT_EQ(handles[8]->points,14);
-    f1.extract_min();
-    EXPECT_FALSE(f1.empty());
-    EXPECT_EQ(f1.size(),10);
-    EXPECT_EQ(f1.minimum().name,"AGUSTIN");
-    f1.delete_key(handles[11]);
-    EXPECT_FALSE(f1.empty());
-    EXPECT_EQ(f1.size(),9);
-    EXPECT_EQ(f1.minimum().name,"AGUSTIN");
-    f1.clear();
-    EXPECT_TRUE(f1.empty());
-    EXPECT_EQ(f1.size(),0);
-}
+static size_t comparaciones = 0;
 
-TEST(fibonacci_heap_test, copiar_y_borrar) {
-    fibonacci_heap<int> f1;
-    fibonacci_heap<int> f2;
-    vector<fibonacci_heap<int>::handle> handles;
-    handles.push_back(f1.insert(-100));
-    handles.push_back(f1.insert(-50));
-    handles.push_back(f1.insert(-101));
-    f1.extract_min();
-    f2 = f1;
-    EXPECT_EQ(f1.size(),2);
-    EXPECT_EQ(f2.size(),2);
-    f1.delete_key(handles[1]);
-    EXPECT_EQ(f1.size(),1);
-    EXPECT_EQ(f2.size(),2);
-    f1.decrease_key(handles[0],-200);
-    EXPECT_EQ(f1.minimum(),-200);
-    EXPECT_EQ(f2.minimum(),-100);
-}
+struct contar_comparaciones {
+    bool operator()(unsigned int a, unsigned int b) const {
+        ++comparaciones;
+        return a < b;
+    }
+};
 
-TEST(fibonacci_heap_test, arbol_palito) {
-    fibonacci_heap<int> f1;
-    fibonacci_heap<int> f2;
-    vector<fibonacci_heap<int>::handle> handles;
-    handles.push_back(f1.insert(-100));
-    handles.push_back(f1.insert(-50));
-    handles.push_back(f1.insert(-101));
+TEST(fibonacci_heap_test, copiar_mantiene_forma) {
+    fibonacci_heap<unsigned int, contar_comparaciones> f1;
+    for (unsigned int i = 0; i < 4096; ++i) {
+        f1.insert(distribution(rd));
+    }
     f1.extract_min();
-    handles.back() = f2.insert(10);
-    handles.push_back(f2.insert(15));
-    handles.push_back(f2.insert(5));
-    f2.extract_min();
-    f1.join(f2);
-    handles.back() = f1.insert(-101);
+    comparaciones = 0;
+    fibonacci_heap<unsigned int, contar_comparaciones> f2(f1);
+    EXPECT_EQ(comparaciones,0);
+    EXPECT_EQ(f2.size(),f1.size());
+    EXPECT_EQ(f2.minimum(),f1.minimum());
     f1.extract_min();
-    f1.delete_key(handles[1]);
-    handles.back() = f2.insert(20);
-    handles.push_back(f2.insert(30));
-    handles.push_back(f2.insert(40));
-    handles.push_back(f2.insert(50));
-    handles.push_back(f2.insert(1));
+    size_t original = comparaciones;
+    comparaciones = 0;
     f2.extract_min();
-    f2.delete_key(handles[5]);
-    f1.join(f2);
-    handles.back() = f1.insert(-101);
-    f1.extract_min();
-    f1.delete_key(handles[2]);
-    f1.delete_key(handles[3]);
-    handles.back() = f2.insert(20);
-    handles.push_back(f2.insert(30));
-    handles.push_back(f2.insert(40));
-    handles.push_back(f2.insert(50));
-    handles.push_back(f2.insert(60));
-    handles.push_back(f2.insert(70));
-    handles.push_back(f2.insert(80));
-    handles.push_back(f2.insert(90));
-    handles.push_back(f2.insert(1));
-    f2.extract_min();
-    f2.delete_key(handles[9]);
-    f2.delete_key(handles[10]);
-    f2.delete_key(handles[11]);
-    f2.delete_key(handles[13]);
-    f1.join(f2);
-    handles.back() = f1.insert(-101);
-    f1.extract_min();
-    f1.delete_key(handles[7]);
-    f1.delete_key(handles[6]);
-    f1.delete_key(handles[4]);
-    EXPECT_FALSE(f1.empty());
-    EXPECT_EQ(f1.size(),5);
-    EXPECT_EQ(-100,f1.minimum());
+    // La copia tiene los mismos árboles, su primer extract_min no vuelve a consolidar n raíces
+    EXPECT_EQ(comparaciones,original);
+    EXPECT_LT(comparaciones,100);
+    while(!f1.empty()){
+        EXPECT_EQ(f1.minimum(),f2.minimum());
+        f1.extract_min();
+        f2.extract_min();
+    }
     EXPECT_TRUE(f2.empty());
-    EXPECT_EQ(f2.size(),0);
 }
 
-TEST(fibonacci_heap_test, cascading_cut) {
-    fibonacci_heap<int> f;
-    vector<fibonacci_heap<int>::handle> handles;
-    for (int i = 65; i > 0; --i) {
-        handles.push_back(f.insert(i));
+// Arma un único árbol que es una cadena de profundidad depth: cada paso cuelga la cadena
+// de una raíz nueva más chica y después borra el hermano que quedó al consolidar
+fibonacci_heap<int> arbol_profundo(int depth){
+    fibonacci_heap<int> res;
+    int top = 0;
+    res.insert(top);
+    res.insert(top + 1);
+    res.insert(top - 1);
+    res.extract_min();
+    for (int i = 0; i < depth; ++i) {
+        res.insert(top - 1);
+        fibonacci_heap<int>::handle filler = res.insert(top + 1);
+        res.insert(top - 2);
+        res.extract_min();
+        res.delete_key(filler);
+        --top;
     }
-    EXPECT_FALSE(f.empty());
-    EXPECT_EQ(f.size(),65);
-    EXPECT_EQ(f.minimum(),1);
-    f.extract_min();
-    EXPECT_FALSE(f.empty());
-    EXPECT_EQ(f.size(),64);
-    EXPECT_EQ(f.minimum(),2);
-    for (int j = 0; j < 64; ++j) {
-        EXPECT_EQ(*handles[j],65-j);
-    }
-    f.delete_key(handles[0]);
-    f.delete_key(handles[2]);
-    f.delete_key(handles[6]);
-    f.delete_key(handles[14]);
-    f.delete_key(handles[30]);
-    f.delete_key(handles[1]);
-    EXPECT_FALSE(f.empty());
-    EXPECT_EQ(f.size(),58);
-    EXPECT_EQ(f.minimum(),2);
-}
-
-TEST(fibonacci_heap_test, move_operator) {
-    unsigned int n1 = distribution(rd);
-    unsigned int n2 = distribution(rd);
-    fibonacci_heap<unsigned int> f1(random_fib(n1));
-    EXPECT_FALSE(f1.empty());
-    EXPECT_EQ(f1.size(),n1);
-    fibonacci_heap<unsigned int> f2 = f1;
-    f2 = random_fib(n2);
-    EXPECT_FALSE(f2.empty());
-    EXPECT_EQ(f2.size(),n2);
+    return res;
 }
 
-TEST(fibonacci_heap_test, copy_a_lot) {
-    unsigned int n1 = distribution(rd);
-    unsigned int n2 = distribution(rd);
-    fibonacci_heap<unsigned int> f1(random_fib(n1));
-    for (unsigned int i = 0; i < n2; ++i) {
-        unsigned int n3 = distribution(rd) + 1;
-        fibonacci_heap<unsigned int> f2(random_fib(n3));
-        unsigned int m = f2.minimum();
-        f1 = f2;
-        EXPECT_EQ(f1.empty(),f2.empty());
-        EXPECT_EQ(f1.size(),f2.size());
-        EXPECT_EQ(f1.minimum(),f2.minimum());
-        EXPECT_FALSE(f1.empty());
-        EXPECT_EQ(f1.size(),n3);
-        EXPECT_EQ(f1.minimum(),m);
-    }
+// Corre test en un hilo con una pila de stack_size bytes (donde no hay pthreads corre en el hilo actual)
+void con_pila_chica(size_t stack_size, void (*test)()){
+#if defined(__unix__) || defined(__APPLE__)
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, stack_size);
+    pthread_t thread;
+    void* (*start)(void*) = [](void* arg) -> void* {
+        reinterpret_cast<void (*)()>(arg)();
+        return nullptr;
+    };
+    ASSERT_EQ(pthread_create(&thread, &attr, start, reinterpret_cast<void*>(test)), 0);
+    pthread_join(thread, nullptr);
+    pthread_attr_destroy(&attr);
+#else
+    (void)stack_size;
+    test();
+#endif
+}
+
+TEST(fibonacci_heap_test, arbol_profundo_en_pila_chica){
+    con_pila_chica(256 * 1024, []{
+        const int depth = 200000;
+        fibonacci_heap<int> f = arbol_profundo(depth);
+        EXPECT_EQ(f.size(),depth + 2);
+        fibonacci_heap<int> copy(f);
+        f.clear();
+        EXPECT_TRUE(f.empty());
+        f = copy;
+        for (int i = -depth; i < -depth + 100; ++i) {
+            EXPECT_EQ(copy.pop_min(),i);
+        }
+    });
 }
 
-TEST(fibonacci_heap_test, heapsort){
-    unsigned int n = distribution(rd);
-    vector<unsigned int> v;
-    fibonacci_heap<unsigned int> f;
-    for (unsigned int i = 0; i < n; ++i) {
-        unsigned int number = distribution(rd);
-        v.push_back(number);
-        f.insert(number);
+TEST(fibonacci_heap_test, estadisticas){
+    using counted_heap = fibonacci_heap<int, less<int>, allocator<int>, fibonacci_stats>;
+    EXPECT_TRUE(is_empty<no_stats>::value);
+    EXPECT_EQ(sizeof(counted_heap),sizeof(fibonacci_heap<int>) + sizeof(fibonacci_stats));
+    counted_heap f;
+    for (int i = 0; i < 1000; ++i) {
+        f.insert(i);
     }
-    sort(v.begin(),v.end());
-    vector<unsigned int> res;
+    f.extract_min();
+    // 999 raíces sueltas terminan en un árbol binomial por cada bit de 999
+    EXPECT_EQ(f.stats().consolidations,1);
+    EXPECT_EQ(f.stats().consolidated_roots,999);
+    EXPECT_EQ(f.stats().max_roots,999);
+    EXPECT_EQ(f.stats().links,999 - 8);
+    EXPECT_EQ(f.stats().max_degree,9);
+    EXPECT_EQ(f.stats().allocations,1000);
+    EXPECT_EQ(f.stats().deallocations,1);
+    EXPECT_GE(f.stats().comparisons,f.stats().links);
+    EXPECT_EQ(f.stats().cuts,0);
+    f.reset_stats();
+    EXPECT_EQ(f.stats().links,0);
+    EXPECT_EQ(f.stats().comparisons,0);
+    EXPECT_EQ(f.stats().allocations,0);
+    f.clear();
+    EXPECT_EQ(f.stats().deallocations,999);
 
-    while(!f.empty()) {
-        res.push_back(f.minimum());
-        f.extract_min();
+    // 16 claves quedan en un único árbol B4, cada nodo que no es la raíz se corta exactamente una vez
+    vector<counted_heap::handle> handles;
+    for (int i = 0; i < 16; ++i) {
+        handles.push_back(f.insert(i));
     }
-    EXPECT_EQ(res,v);
-}
-
-TEST(fibonacci_heap_test, random_insert_extract){
-    unsigned int insert_amount = distribution(rd);
-    unsigned int extract_min_amount = min(distribution(rd),insert_amount);
-    fibonacci_heap<unsigned int> f;
-    unsigned int size = 0;
-    unsigned int minimum = 101;
-    while(insert_amount && extract_min_amount){
-        if(extract_min_amount && size && bernoulli(rd)){
-            f.extract_min();
-            --size;
-            --extract_min_amount;
-            if(size){
-                minimum = f.minimum();
-            }else{
-                minimum = 1000;
-            }
-        }else if(insert_amount){
-            unsigned int n = distribution(rd);
-            minimum = min(minimum,n);
-            f.insert(n);
-            ++size;
-            --insert_amount;
-        }
-        EXPECT_EQ(f.empty(),size == 0);
-        EXPECT_EQ(f.size(),size);
-        if(!f.empty()){
-            EXPECT_EQ(f.minimum(),minimum);
-        }
+    f.insert(-1);
+    f.extract_min();
+    f.reset_stats();
+    for (int i = 15; i > 0; --i) {
+        f.decrease_key(handles[i], -i);
     }
-}
-
-TEST(fibonacci_heap_test, random_join){
-    fibonacci_heap<unsigned int> f1;
-    unsigned int size = 1;
-    unsigned int minimum = 101;
-    f1.insert(101);
-    unsigned int join_amount = distribution(rd);
-    while(join_amount){
-        unsigned int n = distribution(rd);
-        fibonacci_heap<unsigned int> f2 = random_fib(n);
-        if(bernoulli(rd)){
-            f2.insert(0);
-            f2.extract_min();
-        }
-        if(!f2.empty()){
-            minimum = min(minimum,f2.minimum());
-        }
-        f1.join(f2);
-        size += n;
-        --join_amount;
-        EXPECT_TRUE(f2.empty());
-        EXPECT_FALSE(f1.empty());
-        EXPECT_EQ(f1.size(),size);
-        EXPECT_EQ(f1.minimum(),minimum);
+    EXPECT_EQ(f.stats().cuts,15);
+    EXPECT_GT(f.stats().cascading_cuts,0);
+    EXPECT_GT(f.stats().max_cascade_depth,0);
+    EXPECT_LE(f.stats().cascading_cuts,f.stats().cuts);
+    EXPECT_EQ(f.stats().consolidations,0);
+    counted_heap copy(f);
+    EXPECT_EQ(copy.stats().allocations,16);
+    EXPECT_EQ(copy.stats().cuts,0);
+
+    // Al mover e intercambiar las estadísticas siguen a los nodos
+    counted_heap moved(std::move(copy));
+    EXPECT_EQ(moved.stats().allocations,16);
+    EXPECT_EQ(copy.stats().allocations,0);
+    moved.clear();
+    EXPECT_EQ(moved.stats().deallocations,16);
+    counted_heap other;
+    other.insert(1);
+    moved.reset_stats();
+    for (int i = 0; i < 5; ++i) {
+        moved.insert(i);
     }
-    f1.extract_min();
-    EXPECT_EQ(f1.size(),size-1);
+    moved.swap(other);
+    EXPECT_EQ(other.size(),5);
+    EXPECT_EQ(other.stats().allocations,5);
+    EXPECT_EQ(moved.size(),1);
+    EXPECT_EQ(moved.stats().allocations,1);
 }
-
-TEST(fibonacci_heap_test, random_all){
-    unsigned int insert_amount = distribution(rd);
-    unsigned int extract_min_amount = min(distribution(rd),insert_amount);
-    unsigned int delete_amount = min(distribution(rd),insert_amount-extract_min_amount);
-    unsigned int decrease_amount = distribution(rd);
-    unsigned int swap_amount = distribution(rd);
-    fibonacci_heap<int> f1;
-    fibonacci_heap<int> f2;
-    unsigned int size1 = 1;
-    int min1 = 101 + distribution(rd);
-    fibonacci_heap<int>::handle h1 = f1.insert(min1);
-    bool handleValido1 = true;
-    unsigned int size2 = 1;
-    int min2 = 101 + distribution(rd);
-    fibonacci_heap<int>::handle h2 = f2.insert(min2);
-    bool handleValido2 = true;
-    while(insert_amount || extract_min_amount || delete_amount || decrease_amount || swap_amount){
-        if(insert_amount && bernoulli(rd)){
-            int n = distribution(rd);
-            h1 = f1.insert(n);
-            min1 = min(min1,n);
-            ++size1;
-            handleValido1 = true;
-            --insert_amount;
-        }else if(extract_min_amount && size1 && bernoulli(rd)){
-            f1.extract_min();
-            --size1;
-            handleValido1 = false;
-            --extract_min_amount;
-            if(size1){
-                min1 = f1.minimum();
-            }else{
-                min1 = 1000;
-            }
-        }else if(delete_amount && handleValido1 && bernoulli(rd)){
-            f1.delete_key(h1);
-            --size1;
-            handleValido1 = false;
-            --delete_amount;
-            if(size1){
-                min1 = f1.minimum();
-            }else{
-                min1 = 1000;
-            }
-        }else if(decrease_amount && handleValido1 && bernoulli(rd)){
-            f1.decrease_key(h1,*h1 - 1);
-            min1 = min(min1,*h1);
-            --decrease_amount;
-        }else if(swap_amount && bernoulli(rd)){
-            f1.swap(f2);
-            swap(size1,size2);
-            swap(min1,min2);
-            swap(h1,h2);
-            swap(handleValido1,handleValido2);
-            --swap_amount;
-        }else{
-            int n = distribution(rd);
-            h1 = f1.insert(n);
-            min1 = min(min1,n);
-            ++size1;
-            handleValido1 = true;
-        }
-        EXPECT_EQ(f1.empty(),size1 == 0);
-        EXPECT_EQ(f1.size(),size1);
-        if(handleValido1){
-            EXPECT_EQ(f1.minimum(),min1);
-        }
-        EXPECT_EQ(f2.empty(),size2 == 0);
-        EXPECT_EQ(f2.size(),size2);
-        if(handleValido2){
-            EXPECT_EQ(f2.minimum(),min2);
-        }
-    }
-    f1.join(f2);
-    EXPECT_FALSE(f1.empty());
-    EXPECT_EQ(f1.size(),size1+size2);
-    EXPECT_EQ(f1.minimum(),min(min1,min2));
-    EXPECT_TRUE(f2.empty());
-    EXPECT_EQ(f2.size(),0);
-    f1.clear();
-    f2.clear();
-    EXPECT_TRUE(f1.empty());
-    EXPECT_EQ(f1.size(),0);
-    EXPECT_TRUE(f2.empty());
-    EXPECT_EQ(f2.size(),0);
-}
\ No newline at end of file
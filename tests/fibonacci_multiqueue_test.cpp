@@ -0,0 +1,96 @@
+#include "gtest/gtest.h"
+#include "../src/fibonacci_multiqueue.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+TEST(fibonacci_multiqueue_test, vacia) {
+    fibonacci_multiqueue<int> q(2, 4);
+    EXPECT_EQ(q.queues(),8);
+    EXPECT_TRUE(q.empty());
+    int x = 3;
+    EXPECT_FALSE(q.try_pop(x));
+    EXPECT_EQ(x,3);
+}
+
+TEST(fibonacci_multiqueue_test, saca_todo_casi_en_orden) {
+    const int n = 20000;
+    fibonacci_multiqueue<int> q(2, 4);
+    for (int i = n - 1; i >= 0; --i) {
+        q.insert(i);
+    }
+    EXPECT_EQ(q.size(),n);
+    // Árbol de Fenwick con los ya sacados: el rank error de x es x menos los menores a x ya sacados
+    vector<int> fenwick(n + 1, 0);
+    vector<bool> visto(n, false);
+    long long rank_error_total = 0;
+    int x;
+    int sacados = 0;
+    while (q.try_pop(x)) {
+        ASSERT_TRUE(x >= 0 && x < n && !visto[x]);
+        visto[x] = true;
+        int menores_sacados = 0;
+        for (int i = x; i > 0; i -= i & -i) {
+            menores_sacados += fenwick[i];
+        }
+        rank_error_total += x - menores_sacados;
+        for (int i = x + 1; i <= n; i += i & -i) {
+            ++fenwick[i];
+        }
+        ++sacados;
+    }
+    EXPECT_TRUE(q.empty());
+    EXPECT_EQ(sacados,n);
+    // Con dos opciones al azar el rank error esperado es del orden de la cantidad de colas
+    EXPECT_LT(static_cast<double>(rank_error_total) / n, 4.0 * q.queues());
+}
+
+TEST(fibonacci_multiqueue_test, una_sola_cola_es_exacta) {
+    fibonacci_multiqueue<int> q(1, 1);
+    for (int i = 100; i > 0; --i) {
+        q.insert(i);
+    }
+    int x;
+    for (int i = 1; i <= 100; ++i) {
+        ASSERT_TRUE(q.try_pop(x));
+        EXPECT_EQ(x,i);
+    }
+}
+
+TEST(fibonacci_multiqueue_test, muchos_hilos) {
+    const int hilos = 8;
+    const int por_hilo = 10000;
+    fibonacci_multiqueue<int> q(2, hilos);
+    vector<vector<int> > sacados(hilos);
+    vector<thread> todos;
+    for (int t = 0; t < hilos; ++t) {
+        todos.emplace_back([&q, &sacados, t]{
+            int x;
+            for (int i = 0; i < por_hilo; ++i) {
+                q.insert(i * hilos + t);
+                if(i % 2 == 1 && q.try_pop(x)){
+                    sacados[t].push_back(x);
+                }
+            }
+        });
+    }
+    for (thread& t : todos) {
+        t.join();
+    }
+    vector<int> todos_sacados;
+    for (const vector<int>& s : sacados) {
+        todos_sacados.insert(todos_sacados.end(), s.begin(), s.end());
+    }
+    int x;
+    while (q.try_pop(x)) {
+        todos_sacados.push_back(x);
+    }
+    sort(todos_sacados.begin(), todos_sacados.end());
+    ASSERT_EQ(todos_sacados.size(),hilos * por_hilo);
+    for (int i = 0; i < hilos * por_hilo; ++i) {
+        ASSERT_EQ(todos_sacados[i],i);
+    }
+}
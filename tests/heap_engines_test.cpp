@@ -0,0 +1,994 @@
+#include "gtest/gtest.h"
+#include "../src/dary_heap.h"
+#include "../src/fibonacci_heap.h"
+#include "../src/hollow_heap.h"
+#include "../src/pairing_heap.h"
+#include "../src/pool_allocator.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+extern atomic<size_t> global_allocations;
+
+/**
+ * Cada motor expone heap<T, Compare, Allocator>, así los mismos tests corren sobre todos los heaps
+ * con la interfaz de fibonacci_heap. extra_allocations es cuántas veces más que fibonacci_heap pide memoria
+ * al copiar o insertar un rango: arreglos contiguos o el pool de un segundo tipo de nodo
+ */
+struct fibonacci_engine {
+    template < typename T, typename Compare = less<T>, typename Allocator = allocator<T> >
+    using heap = fibonacci_heap<T, Compare, Allocator>;
+    static const size_t extra_allocations = 0;
+};
+
+struct pairing_engine {
+    template < typename T, typename Compare = less<T>, typename Allocator = allocator<T> >
+    using heap = pairing_heap<T, Compare, Allocator>;
+    static const size_t extra_allocations = 0;
+};
+
+struct dary_engine {
+    template < typename T, typename Compare = less<T>, typename Allocator = allocator<T> >
+    using heap = dary_heap<T, 4, Compare, Allocator>;
+    static const size_t extra_allocations = 1;
+};
+
+struct hollow_engine {
+    template < typename T, typename Compare = less<T>, typename Allocator = allocator<T> >
+    using heap = hollow_heap<T, Compare, Allocator>;
+    static const size_t extra_allocations = 3;
+};
+
+template < typename Engine, typename T, typename Compare = less<T>, typename Allocator = allocator<T> >
+using heap_of = typename Engine::template heap<T, Compare, Allocator>;
+
+template < typename Engine >
+class heap_engine_test : public ::testing::Test {};
+
+typedef ::testing::Types<fibonacci_engine, pairing_engine, dary_engine, hollow_engine> heap_engines;
+TYPED_TEST_CASE(heap_engine_test, heap_engines);
+
+struct player{
+    string name;
+    int points;
+
+    bool operator<(const player& other) const {
+        return points < other.points;
+    }
+};
+
+static random_device rd;
+static uniform_int_distribution<unsigned int> distribution(0,100);
+static bernoulli_distribution bernoulli(0.5);
+
+template < typename Heap >
+Heap random_heap(unsigned int size){
+    Heap res;
+    for (unsigned int i = 0; i < size; ++i) {
+        unsigned int number = distribution(rd);
+        res.insert(number);
+    }
+    return res;
+}
+
+struct by_points {
+    bool operator()(const player& a, const player& b) const {
+        return a.points > b.points;
+    }
+};
+
+bool menor_absoluto(int a, int b){
+    return abs(a) < abs(b);
+}
+
+struct solo_mover {
+    unique_ptr<int> valor;
+
+    solo_mover(int v) : valor(new int(v)) {}
+    solo_mover(int a, int b) : valor(new int(a + b)) {}
+    solo_mover(solo_mover&&) = default;
+    solo_mover& operator=(solo_mover&&) = default;
+
+    bool operator<(const solo_mover& other) const {
+        return *valor < *other.valor;
+    }
+};
+
+struct copia_que_falla {
+    // Cantidad de copias que se pueden hacer antes de fallar, negativo para no fallar nunca
+    static int copias_restantes;
+    int valor;
+
+    copia_que_falla(int v) : valor(v) {}
+    copia_que_falla(const copia_que_falla& other) : valor(other.valor) {
+        if(copias_restantes-- == 0){
+            throw runtime_error("copia");
+        }
+    }
+
+    bool operator<(const copia_que_falla& other) const {
+        return valor < other.valor;
+    }
+};
+
+int copia_que_falla::copias_restantes = -1;
+
+TYPED_TEST(heap_engine_test, constructor_empty) {
+    heap_of<TypeParam, int> f1;
+    heap_of<TypeParam, double> f2;
+    heap_of<TypeParam, pair<int,unsigned int> > f3;
+}
+
+TYPED_TEST(heap_engine_test, copiar_empty) {
+    heap_of<TypeParam, pair<int,double> > f;
+    heap_of<TypeParam, pair<int,double> > f2;
+    heap_of<TypeParam, pair<int,double> > f1(f);
+    f2 = f;
+    f = f1;
+}
+
+TYPED_TEST(heap_engine_test, clear_empty) {
+    heap_of<TypeParam, pair<int,double> > f;
+    f.clear();
+}
+
+TYPED_TEST(heap_engine_test, swap_empty) {
+    heap_of<TypeParam, pair<int,double> > f1;
+    heap_of<TypeParam, pair<int,double> > f2;
+    f1.swap(f2);
+}
+
+TYPED_TEST(heap_engine_test, empty_empty) {
+    heap_of<TypeParam, int> f1;
+    heap_of<TypeParam, double> f2;
+    heap_of<TypeParam, pair<int,unsigned int> > f3;
+    EXPECT_TRUE(f1.empty());
+    EXPECT_TRUE(f2.empty());
+    EXPECT_TRUE(f3.empty());
+}
+
+TYPED_TEST(heap_engine_test, size_empty) {
+    heap_of<TypeParam, int> f1;
+    heap_of<TypeParam, double> f2;
+    heap_of<TypeParam, pair<int,unsigned int> > f3;
+    EXPECT_EQ(f1.size(),0);
+    EXPECT_EQ(f2.size(),0);
+    EXPECT_EQ(f3.size(),0);
+}
+
+TYPED_TEST(heap_engine_test, insert_one) {
+    heap_of<TypeParam, int> f1;
+    heap_of<TypeParam, double> f2;
+    heap_of<TypeParam, pair<int,unsigned int> > f3;
+    f1.insert(3);
+    f2.insert(2.3);
+    f3.insert({-2,1});
+}
+
+TYPED_TEST(heap_engine_test, minimum_one) {
+    heap_of<TypeParam, int> f1;
+    heap_of<TypeParam, double> f2;
+    heap_of<TypeParam, pair<int,unsigned int> > f3;
+    f1.insert(3);
+    f2.insert(2.3);
+    f3.insert({-2,1});
+    EXPECT_EQ(f1.minimum(),3);
+    EXPECT_DOUBLE_EQ(f2.minimum(),2.3);
+    EXPECT_EQ(f3.minimum().first,-2);
+    EXPECT_EQ(f3.minimum().second,1);
+}
+
+TYPED_TEST(heap_engine_test, extract_minimum_one) {
+    heap_of<TypeParam, int> f1;
+    heap_of<TypeParam, double> f2;
+    heap_of<TypeParam, pair<int,unsigned int> > f3;
+    f1.insert(3);
+    f2.insert(2.3);
+    f3.insert({-2,1});
+    f1.extract_min();
+    f2.extract_min();
+    f3.extract_min();
+}
+
+TYPED_TEST(heap_engine_test, delete_key_one) {
+    heap_of<TypeParam, int> f1;
+    heap_of<TypeParam, double> f2;
+    heap_of<TypeParam, pair<int,unsigned int> > f3;
+    typename heap_of<TypeParam, int>::handle h1 = f1.insert(3);
+    typename heap_of<TypeParam, double>::handle h2 = f2.insert(2.3);
+    typename heap_of<TypeParam, pair<int,unsigned int> >::handle h3 = f3.insert({-2,1});
+    f1.delete_key(h1);
+    f2.delete_key(h2);
+    f3.delete_key(h3);
+}
+
+TYPED_TEST(heap_engine_test, decrease_key_one) {
+    heap_of<TypeParam, int> f1;
+    heap_of<TypeParam, double> f2;
+    heap_of<TypeParam, pair<int,unsigned int> > f3;
+    typename heap_of<TypeParam, int>::handle h1 = f1.insert(3);
+    typename heap_of<TypeParam, double>::handle h2 = f2.insert(2.3);
+    typename heap_of<TypeParam, pair<int,unsigned int> >::handle h3 = f3.insert({-2,1});
+    f1.decrease_key(h1,-2);
+    f2.decrease_key(h2,1.1);
+    f3.decrease_key(h3,{-2,0});
+}
+
+TYPED_TEST(heap_engine_test, join_empty) {
+    heap_of<TypeParam, pair<int,unsigned int> > f1;
+    heap_of<TypeParam, pair<int,unsigned int> > f2;
+    f1.join(f2);
+}
+
+TYPED_TEST(heap_engine_test, handle) {
+    heap_of<TypeParam, pair<double,int> > f1;
+    typename heap_of<TypeParam, pair<double,int> >::handle h1 = f1.insert({1.1,-1});
+    typename heap_of<TypeParam, pair<double,int> >::handle h2 = f1.insert({2.2,-2});
+    typename heap_of<TypeParam, pair<double,int> >::handle h3 = f1.insert({3.3,-3});
+    typename heap_of<TypeParam, pair<double,int> >::handle h4(h1);
+    EXPECT_DOUBLE_EQ(h1->first,1.1);
+    EXPECT_DOUBLE_EQ(h2->first,2.2);
+    EXPECT_DOUBLE_EQ(h3->first,3.3);
+    EXPECT_EQ(h1,h4);
+    EXPECT_NE(h1,h2);
+    EXPECT_NE(h1,h3);
+    EXPECT_NE(h3,h2);
+    EXPECT_EQ(f1.minimum(),*h1);
+    f1.extract_min();
+    h1 = h2;
+    h4 = h3;
+    EXPECT_EQ(h1,h2);
+    EXPECT_EQ(h4,h3);
+    EXPECT_NE(h1,h4);
+    EXPECT_EQ(h1->second,-2);
+    EXPECT_EQ(h4->second,-3);
+    EXPECT_EQ(h2->second,-2);
+    EXPECT_EQ(h3->second,-3);
+    EXPECT_EQ(f1.minimum(),*h1);
+    EXPECT_EQ(*h2,*h1);
+    EXPECT_EQ(*h3,*h4);
+    heap_of<TypeParam, pair<double,int> > f2;
+    h1 = f2.insert({4.7,3});
+    f1.join(f2);
+    EXPECT_NE(h1,h2);
+    EXPECT_EQ(h4,h3);
+    EXPECT_NE(h1,h4);
+    EXPECT_EQ(h1->second,3);
+    EXPECT_EQ(h4->second,-3);
+    EXPECT_EQ(h2->second,-2);
+    EXPECT_EQ(h3->second,-3);
+    EXPECT_EQ(f1.minimum(),*h2);
+    EXPECT_NE(*h2,*h1);
+    EXPECT_EQ(*h3,*h4);
+    f1.extract_min();
+    h2 = h1;
+    EXPECT_EQ(h1,h2);
+    EXPECT_EQ(h4,h3);
+    EXPECT_NE(h1,h4);
+    EXPECT_EQ(h1->second,3);
+    EXPECT_EQ(h4->second,-3);
+    EXPECT_EQ(h2->second,3);
+    EXPECT_EQ(h3->second,-3);
+    EXPECT_EQ(f1.minimum(),*h3);
+    EXPECT_EQ(*h2,*h1);
+    EXPECT_EQ(*h3,*h4);
+}
+
+TYPED_TEST(heap_engine_test, join_handle) {
+    heap_of<TypeParam, pair<double,int> > f1;
+    heap_of<TypeParam, pair<double,int> > f2;
+    typename heap_of<TypeParam, pair<double,int> >::handle h1 = f1.insert({1.1,-1});
+    typename heap_of<TypeParam, pair<double,int> >::handle h2 = f2.insert({1.1,-1});
+    typename heap_of<TypeParam, pair<double,int> >::handle h3 = f1.insert({3.3,-3});
+    EXPECT_DOUBLE_EQ(h1->first,1.1);
+    EXPECT_DOUBLE_EQ(h2->first,1.1);
+    EXPECT_DOUBLE_EQ(h3->first,3.3);
+    EXPECT_NE(h2,h1);
+    EXPECT_NE(h1,h3);
+    EXPECT_NE(h3,h2);
+    EXPECT_EQ(f1.minimum(),*h1);
+    EXPECT_EQ(f2.minimum(),*h2);
+    f1.join(f2);
+    EXPECT_DOUBLE_EQ(h1->first,1.1);
+    EXPECT_DOUBLE_EQ(h2->first,1.1);
+    EXPECT_DOUBLE_EQ(h3->first,3.3);
+    EXPECT_NE(h2,h1);
+    EXPECT_NE(h1,h3);
+    EXPECT_NE(h3,h2);
+    EXPECT_EQ(f1.minimum(),*h1);
+    EXPECT_EQ(f1.minimum(),*h2);
+}
+
+TYPED_TEST(heap_engine_test, tipo_raro) {
+    heap_of<TypeParam, player> f1;
+    heap_of<TypeParam, player> f2;
+    EXPECT_TRUE(f1.empty());
+    EXPECT_TRUE(f2.empty());
+    EXPECT_EQ(f1.size(),0);
+    EXPECT_EQ(f2.size(),0);
+    vector<typename heap_of<TypeParam, player>::handle> handles;
+    handles.push_back(f1.insert({"FACUNDO",7}));
+    handles.push_back(f1.insert({"NICOLAS",24}));
+    handles.push_back(f1.insert({"PABLO",17}));
+    handles.push_back(f1.insert({"MATIAS",23}));
+    handles.push_back(f1.insert({"MIGUEL",26}));
+    handles.push_back(f1.insert({"AGUSTIN",46}));
+    handles.push_back(f1.insert({"GONZALO",30}));
+    handles.push_back(f1.insert({"ENZO",35}));
+    handles.push_back(f1.insert({"JUAN",18}));
+    handles.push_back(f1.insert({"MIKE",21}));
+    handles.push_back(f1.insert({"ANGEL",39}));
+    handles.push_back(f1.insert({"RICARDO",52}));
+    handles.push_back(f1.insert({"LUCAS",2}));
+    handles.push_back(f2.insert({"RODOLFO",38}));
+    handles.push_back(f2.insert({"RAUL",41}));
+    handles.push_back(f2.insert({"CIRO",1}));
+    EXPECT_FALSE(f1.empty());
+    EXPECT_FALSE(f2.empty());
+    EXPECT_EQ(f1.size(),13);
+    EXPECT_EQ(f2.size(),3);
+    EXPECT_EQ(f1.minimum().name,handles[12]->name);
+    EXPECT_EQ(f2.minimum().name,handles.back()->name);
+    f1.extract_min();
+    f2.extract_min();
+    EXPECT_FALSE(f1.empty());
+    EXPECT_FALSE(f2.empty());
+    EXPECT_EQ(f1.size(),12);
+    EXPECT_EQ(f2.size(),2);
+    EXPECT_EQ(f1.minimum().name,handles[0]->name);
+    EXPECT_EQ(f2.minimum().name,"RODOLFO");
+    f1.join(f2);
+    EXPECT_FALSE(f1.empty());
+    EXPECT_TRUE(f2.empty());
+    EXPECT_EQ(f1.size(),14);
+    EXPECT_EQ(f2.size(),0);
+    EXPECT_EQ(f1.minimum().name,handles[0]->name);
+    f1.extract_min();
+    EXPECT_FALSE(f1.empty());
+    EXPECT_EQ(f1.size(),13);
+    EXPECT_EQ(f1.minimum().name,"PABLO");
+    f1.decrease_key(handles[11],{"RICARDO",17});
+    EXPECT_FALSE(f1.empty());
+    EXPECT_EQ(f1.size(),13);
+    EXPECT_EQ(f1.minimum().name,"PABLO");
+    EXPECT_EQ(handles[11]->points,17);
+    f1.extract_min();
+    EXPECT_FALSE(f1.empty());
+    EXPECT_EQ(f1.size(),12);
+    EXPECT_EQ(f1.minimum().name,"RICARDO");
+    f1.delete_key(handles[6]);
+    EXPECT_FALSE(f1.empty());
+    EXPECT_EQ(f1.size(),11);
+    EXPECT_EQ(f1.minimum().name,"RICARDO");
+    f1.decrease_key(handles[5],{"AGUSTIN",15});
+    EXPECT_FALSE(f1.empty());
+    EXPECT_EQ(f1.size(),11);
+    EXPECT_EQ(f1.minimum().name,"AGUSTIN");
+    EXPECT_EQ(handles[5]->points,15);
+    f1.decrease_key(handles[13],{"RODOLFO",18});
+    EXPECT_FALSE(f1.empty());
+    EXPECT_EQ(f1.size(),11);
+    EXPECT_EQ(f1.minimum().name,"AGUSTIN");
+    EXPECT_EQ(handles[13]->points,18);
+    f1.decrease_key(handles[8],{"JUAN",14});
+    EXPECT_FALSE(f1.empty());
+    EXPECT_EQ(f1.size(),11);
+    EXPECT_EQ(f1.minimum().name,"JUAN");
+    EXPECT_EQ(handles[8]->points,14);
+    f1.extract_min();
+    EXPECT_FALSE(f1.empty());
+    EXPECT_EQ(f1.size(),10);
+    EXPECT_EQ(f1.minimum().name,"AGUSTIN");
+    f1.delete_key(handles[11]);
+    EXPECT_FALSE(f1.empty());
+    EXPECT_EQ(f1.size(),9);
+    EXPECT_EQ(f1.minimum().name,"AGUSTIN");
+    f1.clear();
+    EXPECT_TRUE(f1.empty());
+    EXPECT_EQ(f1.size(),0);
+}
+
+TYPED_TEST(heap_engine_test, copiar_y_borrar) {
+    heap_of<TypeParam, int> f1;
+    heap_of<TypeParam, int> f2;
+    vector<typename heap_of<TypeParam, int>::handle> handles;
+    handles.push_back(f1.insert(-100));
+    handles.push_back(f1.insert(-50));
+    handles.push_back(f1.insert(-101));
+    f1.extract_min();
+    f2 = f1;
+    EXPECT_EQ(f1.size(),2);
+    EXPECT_EQ(f2.size(),2);
+    f1.delete_key(handles[1]);
+    EXPECT_EQ(f1.size(),1);
+    EXPECT_EQ(f2.size(),2);
+    f1.decrease_key(handles[0],-200);
+    EXPECT_EQ(f1.minimum(),-200);
+    EXPECT_EQ(f2.minimum(),-100);
+}
+
+TYPED_TEST(heap_engine_test, arbol_palito) {
+    heap_of<TypeParam, int> f1;
+    heap_of<TypeParam, int> f2;
+    vector<typename heap_of<TypeParam, int>::handle> handles;
+    handles.push_back(f1.insert(-100));
+    handles.push_back(f1.insert(-50));
+    handles.push_back(f1.insert(-101));
+    f1.extract_min();
+    handles.back() = f2.insert(10);
+    handles.push_back(f2.insert(15));
+    handles.push_back(f2.insert(5));
+    f2.extract_min();
+    f1.join(f2);
+    handles.back() = f1.insert(-101);
+    f1.extract_min();
+    f1.delete_key(handles[1]);
+    handles.back() = f2.insert(20);
+    handles.push_back(f2.insert(30));
+    handles.push_back(f2.insert(40));
+    handles.push_back(f2.insert(50));
+    handles.push_back(f2.insert(1));
+    f2.extract_min();
+    f2.delete_key(handles[5]);
+    f1.join(f2);
+    handles.back() = f1.insert(-101);
+    f1.extract_min();
+    f1.delete_key(handles[2]);
+    f1.delete_key(handles[3]);
+    handles.back() = f2.insert(20);
+    handles.push_back(f2.insert(30));
+    handles.push_back(f2.insert(40));
+    handles.push_back(f2.insert(50));
+    handles.push_back(f2.insert(60));
+    handles.push_back(f2.insert(70));
+    handles.push_back(f2.insert(80));
+    handles.push_back(f2.insert(90));
+    handles.push_back(f2.insert(1));
+    f2.extract_min();
+    f2.delete_key(handles[9]);
+    f2.delete_key(handles[10]);
+    f2.delete_key(handles[11]);
+    f2.delete_key(handles[13]);
+    f1.join(f2);
+    handles.back() = f1.insert(-101);
+    f1.extract_min();
+    f1.delete_key(handles[7]);
+    f1.delete_key(handles[6]);
+    f1.delete_key(handles[4]);
+    EXPECT_FALSE(f1.empty());
+    EXPECT_EQ(f1.size(),5);
+    EXPECT_EQ(-100,f1.minimum());
+    EXPECT_TRUE(f2.empty());
+    EXPECT_EQ(f2.size(),0);
+}
+
+TYPED_TEST(heap_engine_test, cascading_cut) {
+    heap_of<TypeParam, int> f;
+    vector<typename heap_of<TypeParam, int>::handle> handles;
+    for (int i = 65; i > 0; --i) {
+        handles.push_back(f.insert(i));
+    }
+    EXPECT_FALSE(f.empty());
+    EXPECT_EQ(f.size(),65);
+    EXPECT_EQ(f.minimum(),1);
+    f.extract_min();
+    EXPECT_FALSE(f.empty());
+    EXPECT_EQ(f.size(),64);
+    EXPECT_EQ(f.minimum(),2);
+    for (int j = 0; j < 64; ++j) {
+        EXPECT_EQ(*handles[j],65-j);
+    }
+    f.delete_key(handles[0]);
+    f.delete_key(handles[2]);
+    f.delete_key(handles[6]);
+    f.delete_key(handles[14]);
+    f.delete_key(handles[30]);
+    f.delete_key(handles[1]);
+    EXPECT_FALSE(f.empty());
+    EXPECT_EQ(f.size(),58);
+    EXPECT_EQ(f.minimum(),2);
+}
+
+TYPED_TEST(heap_engine_test, move_operator) {
+    unsigned int n1 = distribution(rd);
+    unsigned int n2 = distribution(rd);
+    heap_of<TypeParam, unsigned int> f1(random_heap<heap_of<TypeParam, unsigned int> >(n1));
+    EXPECT_FALSE(f1.empty());
+    EXPECT_EQ(f1.size(),n1);
+    heap_of<TypeParam, unsigned int> f2 = f1;
+    f2 = random_heap<heap_of<TypeParam, unsigned int> >(n2);
+    EXPECT_FALSE(f2.empty());
+    EXPECT_EQ(f2.size(),n2);
+}
+
+TYPED_TEST(heap_engine_test, copy_a_lot) {
+    unsigned int n1 = distribution(rd);
+    unsigned int n2 = distribution(rd);
+    heap_of<TypeParam, unsigned int> f1(random_heap<heap_of<TypeParam, unsigned int> >(n1));
+    for (unsigned int i = 0; i < n2; ++i) {
+        unsigned int n3 = distribution(rd) + 1;
+        heap_of<TypeParam, unsigned int> f2(random_heap<heap_of<TypeParam, unsigned int> >(n3));
+        unsigned int m = f2.minimum();
+        f1 = f2;
+        EXPECT_EQ(f1.empty(),f2.empty());
+        EXPECT_EQ(f1.size(),f2.size());
+        EXPECT_EQ(f1.minimum(),f2.minimum());
+        EXPECT_FALSE(f1.empty());
+        EXPECT_EQ(f1.size(),n3);
+        EXPECT_EQ(f1.minimum(),m);
+        f1.extract_min();
+        f2.extract_min();
+        while(!f1.empty()){
+            EXPECT_EQ(f1.minimum(),f2.minimum());
+            f1.extract_min();
+            f2.extract_min();
+        }
+        EXPECT_TRUE(f2.empty());
+    }
+}
+
+TYPED_TEST(heap_engine_test, copiar_con_pool) {
+    pool_allocator<int> a(1);
+    heap_of<TypeParam, int, less<int>, pool_allocator<int> > f1(a);
+    for (int i = 0; i < 1000; ++i) {
+        f1.insert(i);
+    }
+    f1.extract_min();
+    size_t before = global_allocations;
+    heap_of<TypeParam, int, less<int>, pool_allocator<int> > f2(f1);
+    // Todos los nodos de la copia salen de un único chunk
+    EXPECT_LE(global_allocations - before,2 + TypeParam::extra_allocations);
+    EXPECT_EQ(f2.size(),999);
+    EXPECT_EQ(f2.pop_min(),1);
+}
+
+TYPED_TEST(heap_engine_test, heapsort){
+    unsigned int n = distribution(rd);
+    vector<unsigned int> v;
+    heap_of<TypeParam, unsigned int> f;
+    for (unsigned int i = 0; i < n; ++i) {
+        unsigned int number = distribution(rd);
+        v.push_back(number);
+        f.insert(number);
+    }
+    sort(v.begin(),v.end());
+    vector<unsigned int> res;
+
+    while(!f.empty()) {
+        res.push_back(f.minimum());
+        f.extract_min();
+    }
+    EXPECT_EQ(res,v);
+}
+
+TYPED_TEST(heap_engine_test, random_insert_extract){
+    unsigned int insert_amount = distribution(rd);
+    unsigned int extract_min_amount = min(distribution(rd),insert_amount);
+    heap_of<TypeParam, unsigned int> f;
+    unsigned int size = 0;
+    unsigned int minimum = 101;
+    while(insert_amount && extract_min_amount){
+        if(extract_min_amount && size && bernoulli(rd)){
+            f.extract_min();
+            --size;
+            --extract_min_amount;
+            if(size){
+                minimum = f.minimum();
+            }else{
+                minimum = 1000;
+            }
+        }else if(insert_amount){
+            unsigned int n = distribution(rd);
+            minimum = min(minimum,n);
+            f.insert(n);
+            ++size;
+            --insert_amount;
+        }
+        EXPECT_EQ(f.empty(),size == 0);
+        EXPECT_EQ(f.size(),size);
+        if(!f.empty()){
+            EXPECT_EQ(f.minimum(),minimum);
+        }
+    }
+}
+
+TYPED_TEST(heap_engine_test, random_join){
+    heap_of<TypeParam, unsigned int> f1;
+    unsigned int size = 1;
+    unsigned int minimum = 101;
+    f1.insert(101);
+    unsigned int join_amount = distribution(rd);
+    while(join_amount){
+        unsigned int n = distribution(rd);
+        heap_of<TypeParam, unsigned int> f2 = random_heap<heap_of<TypeParam, unsigned int> >(n);
+        if(bernoulli(rd)){
+            f2.insert(0);
+            f2.extract_min();
+        }
+        if(!f2.empty()){
+            minimum = min(minimum,f2.minimum());
+        }
+        f1.join(f2);
+        size += n;
+        --join_amount;
+        EXPECT_TRUE(f2.empty());
+        EXPECT_FALSE(f1.empty());
+        EXPECT_EQ(f1.size(),size);
+        EXPECT_EQ(f1.minimum(),minimum);
+    }
+    f1.extract_min();
+    EXPECT_EQ(f1.size(),size-1);
+}
+
+TYPED_TEST(heap_engine_test, random_all){
+    unsigned int insert_amount = distribution(rd);
+    unsigned int extract_min_amount = min(distribution(rd),insert_amount);
+    unsigned int delete_amount = min(distribution(rd),insert_amount-extract_min_amount);
+    unsigned int decrease_amount = distribution(rd);
+    unsigned int swap_amount = distribution(rd);
+    heap_of<TypeParam, int> f1;
+    heap_of<TypeParam, int> f2;
+    unsigned int size1 = 1;
+    int min1 = 101 + distribution(rd);
+    typename heap_of<TypeParam, int>::handle h1 = f1.insert(min1);
+    bool handleValido1 = true;
+    unsigned int size2 = 1;
+    int min2 = 101 + distribution(rd);
+    typename heap_of<TypeParam, int>::handle h2 = f2.insert(min2);
+    bool handleValido2 = true;
+    while(insert_amount || extract_min_amount || delete_amount || decrease_amount || swap_amount){
+        if(insert_amount && bernoulli(rd)){
+            int n = distribution(rd);
+            h1 = f1.insert(n);
+            min1 = min(min1,n);
+            ++size1;
+            handleValido1 = true;
+            --insert_amount;
+        }else if(extract_min_amount && size1 && bernoulli(rd)){
+            f1.extract_min();
+            --size1;
+            handleValido1 = false;
+            --extract_min_amount;
+            if(size1){
+                min1 = f1.minimum();
+            }else{
+                min1 = 1000;
+            }
+        }else if(delete_amount && handleValido1 && bernoulli(rd)){
+            f1.delete_key(h1);
+            --size1;
+            handleValido1 = false;
+            --delete_amount;
+            if(size1){
+                min1 = f1.minimum();
+            }else{
+                min1 = 1000;
+            }
+        }else if(decrease_amount && handleValido1 && bernoulli(rd)){
+            f1.decrease_key(h1,*h1 - 1);
+            min1 = min(min1,*h1);
+            --decrease_amount;
+        }else if(swap_amount && bernoulli(rd)){
+            f1.swap(f2);
+            swap(size1,size2);
+            swap(min1,min2);
+            swap(h1,h2);
+            swap(handleValido1,handleValido2);
+            --swap_amount;
+        }else{
+            int n = distribution(rd);
+            h1 = f1.insert(n);
+            min1 = min(min1,n);
+            ++size1;
+            handleValido1 = true;
+        }
+        EXPECT_EQ(f1.empty(),size1 == 0);
+        EXPECT_EQ(f1.size(),size1);
+        if(handleValido1){
+            EXPECT_EQ(f1.minimum(),min1);
+        }
+        EXPECT_EQ(f2.empty(),size2 == 0);
+        EXPECT_EQ(f2.size(),size2);
+        if(handleValido2){
+            EXPECT_EQ(f2.minimum(),min2);
+        }
+    }
+    f1.join(f2);
+    EXPECT_FALSE(f1.empty());
+    EXPECT_EQ(f1.size(),size1+size2);
+    EXPECT_EQ(f1.minimum(),min(min1,min2));
+    EXPECT_TRUE(f2.empty());
+    EXPECT_EQ(f2.size(),0);
+    f1.clear();
+    f2.clear();
+    EXPECT_TRUE(f1.empty());
+    EXPECT_EQ(f1.size(),0);
+    EXPECT_TRUE(f2.empty());
+    EXPECT_EQ(f2.size(),0);
+}
+TYPED_TEST(heap_engine_test, pool_allocator){
+    pool_allocator<int> a(4);
+    heap_of<TypeParam, int, less<int>, pool_allocator<int> > f1(a);
+    heap_of<TypeParam, int, less<int>, pool_allocator<int> > f2(a);
+    vector<typename heap_of<TypeParam, int, less<int>, pool_allocator<int> >::handle> handles;
+    for (int i = 50; i > 0; --i) {
+        handles.push_back(f1.insert(i));
+        f2.insert(i + 100);
+    }
+    EXPECT_TRUE(f1.get_allocator() == a);
+    f1.extract_min();
+    f1.delete_key(handles[10]);
+    f1.decrease_key(handles[0],-1);
+    f1.join(f2);
+    EXPECT_EQ(f1.size(),98);
+    EXPECT_TRUE(f2.empty());
+    heap_of<TypeParam, int, less<int>, pool_allocator<int> > f3(f1);
+    EXPECT_TRUE(f3.get_allocator() == a);
+    vector<int> res;
+    while(!f1.empty()) {
+        res.push_back(f1.minimum());
+        f1.extract_min();
+    }
+    EXPECT_EQ(res.size(),98);
+    EXPECT_EQ(res.front(),-1);
+    EXPECT_TRUE(is_sorted(res.begin(),res.end()));
+    for (int i = 0; i < 1000; ++i) {
+        f1.insert(i);
+    }
+    f1.clear();
+    f3 = f1;
+    EXPECT_TRUE(f3.empty());
+}
+
+TYPED_TEST(heap_engine_test, extract_min_sin_pedir_memoria){
+    pool_allocator<unsigned int> a;
+    heap_of<TypeParam, unsigned int, less<unsigned int>, pool_allocator<unsigned int> > f(a);
+    for (unsigned int i = 0; i < 10000; ++i) {
+        f.insert(distribution(rd));
+    }
+    size_t before = global_allocations;
+    unsigned int last = 0;
+    while(!f.empty()) {
+        EXPECT_LE(last,f.minimum());
+        last = f.minimum();
+        f.extract_min();
+    }
+    EXPECT_EQ(global_allocations.load(),before);
+}
+
+TYPED_TEST(heap_engine_test, max_heap){
+    heap_of<TypeParam, int, greater<int> > f;
+    vector<typename heap_of<TypeParam, int, greater<int> >::handle> handles;
+    for (int i = 0; i < 20; ++i) {
+        handles.push_back(f.insert(i));
+    }
+    EXPECT_EQ(f.minimum(),19);
+    f.extract_min();
+    EXPECT_EQ(f.minimum(),18);
+    f.increase_key(handles[3],100);
+    EXPECT_EQ(f.minimum(),100);
+    f.delete_key(handles[3]);
+    f.increase_key(handles[10],50);
+    EXPECT_EQ(f.minimum(),50);
+    vector<int> res;
+    while(!f.empty()) {
+        res.push_back(f.minimum());
+        f.extract_min();
+    }
+    EXPECT_EQ(res.size(),18);
+    EXPECT_TRUE(is_sorted(res.rbegin(),res.rend()));
+}
+
+TYPED_TEST(heap_engine_test, comparador_propio){
+    heap_of<TypeParam, player, by_points> f1;
+    heap_of<TypeParam, player, by_points> f2;
+    f1.insert({"FACUNDO",7});
+    f1.insert({"NICOLAS",24});
+    f2.insert({"PABLO",17});
+    f2.insert({"RICARDO",52});
+    f1.join(f2);
+    EXPECT_EQ(f1.minimum().name,"RICARDO");
+    heap_of<TypeParam, player, by_points> f3(f1);
+    f1.extract_min();
+    EXPECT_EQ(f1.minimum().name,"NICOLAS");
+    EXPECT_EQ(f3.minimum().name,"RICARDO");
+}
+
+TYPED_TEST(heap_engine_test, comparador_con_estado){
+    heap_of<TypeParam, int, bool(*)(int,int)> f(menor_absoluto);
+    f.insert(-5);
+    f.insert(3);
+    f.insert(-1);
+    f.insert(4);
+    EXPECT_EQ(f.minimum(),-1);
+    f.extract_min();
+    EXPECT_EQ(f.minimum(),3);
+    heap_of<TypeParam, int, bool(*)(int,int)> f2;
+    f2 = f;
+    f2.extract_min();
+    EXPECT_EQ(f2.minimum(),4);
+    EXPECT_LT(sizeof(heap_of<TypeParam, int>),sizeof(heap_of<TypeParam, int, bool(*)(int,int)>));
+}
+
+TYPED_TEST(heap_engine_test, insertar_moviendo){
+    heap_of<TypeParam, solo_mover> f;
+    f.insert(solo_mover(5));
+    f.emplace(3);
+    f.emplace(4,4);
+    typename heap_of<TypeParam, solo_mover>::handle h = f.emplace(10);
+    f.decrease_key(h,solo_mover(1));
+    EXPECT_EQ(*f.minimum().valor,1);
+    solo_mover m = f.pop_min();
+    EXPECT_EQ(*m.valor,1);
+    EXPECT_EQ(*f.pop_min().valor,3);
+    EXPECT_EQ(*f.pop_min().valor,5);
+    EXPECT_EQ(*f.pop_min().valor,8);
+    EXPECT_TRUE(f.empty());
+}
+
+TYPED_TEST(heap_engine_test, pop_min){
+    heap_of<TypeParam, player> f;
+    string nombre = "FACUNDO";
+    f.insert(player{nombre,7});
+    f.emplace(player{"NICOLAS",24});
+    player p{"PABLO",17};
+    f.insert(std::move(p));
+    EXPECT_EQ(f.pop_min().name,"FACUNDO");
+    EXPECT_EQ(f.size(),2);
+    EXPECT_EQ(f.pop_min().name,"PABLO");
+    EXPECT_EQ(f.pop_min().name,"NICOLAS");
+    EXPECT_TRUE(f.empty());
+    unsigned int n = distribution(rd);
+    heap_of<TypeParam, unsigned int> f2 = random_heap<heap_of<TypeParam, unsigned int> >(n);
+    unsigned int last = 0;
+    while(!f2.empty()){
+        unsigned int m = f2.pop_min();
+        EXPECT_LE(last,m);
+        last = m;
+    }
+}
+
+TYPED_TEST(heap_engine_test, construir_desde_rango){
+    vector<unsigned int> numbers;
+    for (unsigned int i = 0; i < 1000; ++i) {
+        numbers.push_back(distribution(rd));
+    }
+    heap_of<TypeParam, unsigned int> f(numbers.begin(), numbers.end());
+    EXPECT_EQ(f.size(),numbers.size());
+    heap_of<TypeParam, unsigned int, greater<unsigned int> > f2(numbers.begin(), numbers.end(), greater<unsigned int>());
+    sort(numbers.begin(), numbers.end());
+    for (size_t i = 0; i < numbers.size(); ++i) {
+        EXPECT_EQ(f.pop_min(),numbers[i]);
+        EXPECT_EQ(f2.pop_min(),numbers[numbers.size() - 1 - i]);
+    }
+    istringstream in("5 3 8 1");
+    heap_of<TypeParam, int> f3((istream_iterator<int>(in)), istream_iterator<int>());
+    EXPECT_EQ(f3.size(),4);
+    EXPECT_EQ(f3.minimum(),1);
+    list<int> empty_list;
+    heap_of<TypeParam, int> f4(empty_list.begin(), empty_list.end());
+    EXPECT_TRUE(f4.empty());
+}
+
+TYPED_TEST(heap_engine_test, insertar_rango_con_handles){
+    heap_of<TypeParam, int> f;
+    f.insert(50);
+    vector<int> numbers = {10, 40, 20, 30};
+    vector<typename heap_of<TypeParam, int>::handle> handles;
+    f.insert_range(numbers.begin(), numbers.end(), back_inserter(handles));
+    EXPECT_EQ(f.size(),5);
+    EXPECT_EQ(f.minimum(),10);
+    ASSERT_EQ(handles.size(),numbers.size());
+    for (size_t i = 0; i < numbers.size(); ++i) {
+        EXPECT_EQ(*handles[i],numbers[i]);
+    }
+    f.decrease_key(handles[3], 5);
+    f.delete_key(handles[2]);
+    EXPECT_EQ(f.pop_min(),5);
+    EXPECT_EQ(f.pop_min(),10);
+    EXPECT_EQ(f.pop_min(),40);
+    EXPECT_EQ(f.pop_min(),50);
+    EXPECT_TRUE(f.empty());
+}
+
+TYPED_TEST(heap_engine_test, insertar_rango_con_pool){
+    vector<unsigned int> numbers(10000);
+    for (size_t i = 0; i < numbers.size(); ++i) {
+        numbers[i] = distribution(rd);
+    }
+    heap_of<TypeParam, unsigned int, less<unsigned int>, pool_allocator<unsigned int> > f;
+    size_t before = global_allocations;
+    f.insert_range(numbers.begin(), numbers.end());
+    EXPECT_LE(global_allocations - before,2 + TypeParam::extra_allocations);
+    EXPECT_EQ(f.size(),numbers.size());
+    EXPECT_EQ(f.minimum(),*min_element(numbers.begin(), numbers.end()));
+}
+
+TYPED_TEST(heap_engine_test, insertar_rango_con_excepcion){
+    vector<copia_que_falla> values;
+    for (int i = 0; i < 10; ++i) {
+        values.push_back(copia_que_falla(i));
+    }
+    heap_of<TypeParam, copia_que_falla> f;
+    f.insert(copia_que_falla(100));
+    copia_que_falla::copias_restantes = 5;
+    EXPECT_THROW(f.insert_range(values.begin(), values.end()), runtime_error);
+    EXPECT_EQ(f.size(),1);
+    EXPECT_EQ(f.minimum().valor,100);
+    copia_que_falla::copias_restantes = -1;
+}
+
+TYPED_TEST(heap_engine_test, pop_k_mismo_orden){
+    heap_of<TypeParam, unsigned int> f;
+    vector<typename heap_of<TypeParam, unsigned int>::handle> handles;
+    f.insert(0);
+    for (unsigned int i = 0; i < 2000; ++i) {
+        handles.push_back(f.insert(distribution(rd) + 1000));
+    }
+    f.extract_min();
+    for (size_t i = 0; i < handles.size(); i += 7) {
+        f.decrease_key(handles[i], *handles[i] - distribution(rd) - 1);
+    }
+    heap_of<TypeParam, unsigned int> loop(f);
+    vector<unsigned int> batch;
+    vector<unsigned int> expected;
+    while(!f.empty()){
+        size_t k = distribution(rd);
+        f.pop_k(k, back_inserter(batch));
+        for (size_t i = 0; i < k && !loop.empty(); ++i) {
+            expected.push_back(loop.pop_min());
+        }
+        EXPECT_EQ(batch,expected);
+        EXPECT_EQ(f.size(),loop.size());
+        if(!f.empty()){
+            EXPECT_EQ(f.minimum(),loop.minimum());
+        }
+        f.insert(2000);
+        loop.insert(2000);
+        f.extract_min();
+        loop.extract_min();
+    }
+    EXPECT_EQ(batch.size(),expected.size());
+    EXPECT_TRUE(loop.empty());
+    vector<unsigned int> none;
+    f.pop_k(10, back_inserter(none));
+    EXPECT_TRUE(none.empty());
+}
+
+TYPED_TEST(heap_engine_test, drain_while){
+    vector<int> numbers;
+    for (int i = 0; i < 500; ++i) {
+        numbers.push_back(distribution(rd));
+    }
+    heap_of<TypeParam, int> f(numbers.begin(), numbers.end());
+    vector<int> drained;
+    f.drain_while([](int x){ return x < 50; }, back_inserter(drained));
+    sort(numbers.begin(), numbers.end());
+    size_t below = lower_bound(numbers.begin(), numbers.end(), 50) - numbers.begin();
+    EXPECT_EQ(drained,vector<int>(numbers.begin(), numbers.begin() + below));
+    EXPECT_EQ(f.size(),numbers.size() - below);
+    for (size_t i = below; i < numbers.size(); ++i) {
+        EXPECT_EQ(f.pop_min(),numbers[i]);
+    }
+    vector<solo_mover> moved;
+    heap_of<TypeParam, solo_mover> f2;
+    f2.emplace(3);
+    f2.emplace(1);
+    f2.emplace(2);
+    f2.drain_while([](const solo_mover& x){ return *x.valor < 3; }, back_inserter(moved));
+    ASSERT_EQ(moved.size(),2);
+    EXPECT_EQ(*moved[0].valor,1);
+    EXPECT_EQ(*moved[1].valor,2);
+    EXPECT_EQ(*f2.minimum().valor,3);
+}
@@ -0,0 +1,103 @@
+#include "gtest/gtest.h"
+#include "../src/hollow_heap.h"
+#include <algorithm>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Muchos decrease_key por cada extract_min, como en Dijkstra sobre grafos densos, comparando contra un multiset.
+ * Los 16 bits bajos de cada clave son el id del elemento, así se sabe qué handle dejó de valer al sacar el minimo
+ */
+TEST(hollow_heap_test, igual_que_multiset_con_muchos_decrease_key) {
+    mt19937 gen(7);
+    uniform_int_distribution<long long> distribution(0, 100000);
+    hollow_heap<long long> f;
+    multiset<long long> esperado;
+    vector<hollow_heap<long long>::handle> handles;
+    vector<size_t> vivos;
+    for (int paso = 0; paso < 50000; ++paso) {
+        unsigned int op = gen() % 16;
+        if(op < 3 || vivos.empty()){
+            long long k = distribution(gen) << 16 | static_cast<long long>(handles.size());
+            vivos.push_back(handles.size());
+            handles.push_back(f.insert(k));
+            esperado.insert(k);
+        }else if(op < 14){
+            size_t id = vivos[gen() % vivos.size()];
+            long long viejo = *handles[id];
+            long long nuevo = viejo - ((1 + distribution(gen) % 1000) << 16);
+            f.decrease_key(handles[id], nuevo);
+            esperado.erase(viejo);
+            esperado.insert(nuevo);
+        }else{
+            size_t pos = gen() % vivos.size();
+            size_t id = vivos[pos];
+            if(op == 14){
+                esperado.erase(*handles[id]);
+                f.delete_key(handles[id]);
+            }else{
+                ASSERT_EQ(f.minimum(),*esperado.begin());
+                id = static_cast<size_t>(f.pop_min() & 0xFFFF);
+                esperado.erase(esperado.begin());
+                pos = static_cast<size_t>(find(vivos.begin(), vivos.end(), id) - vivos.begin());
+            }
+            vivos[pos] = vivos.back();
+            vivos.pop_back();
+        }
+        ASSERT_EQ(f.size(),esperado.size());
+    }
+    vector<long long> res;
+    f.pop_k(f.size(), back_inserter(res));
+    EXPECT_TRUE(equal(res.begin(), res.end(), esperado.begin()));
+}
+
+TEST(hollow_heap_test, copiar_con_nodos_huecos) {
+    hollow_heap<int> f1;
+    vector<hollow_heap<int>::handle> handles;
+    for (int i = 0; i < 1000; ++i) {
+        handles.push_back(f1.insert(i + 1000));
+    }
+    f1.extract_min();
+    // Cada decrease_key deja un nodo hueco con dos padres
+    for (int i = 999; i > 0; i -= 2) {
+        f1.decrease_key(handles[i], i - 1000);
+    }
+    for (int i = 2; i < 1000; i += 4) {
+        f1.delete_key(handles[i]);
+    }
+    hollow_heap<int> f2(f1);
+    EXPECT_EQ(f2.size(),f1.size());
+    while (!f1.empty()) {
+        ASSERT_EQ(f2.pop_min(),f1.pop_min());
+    }
+    EXPECT_TRUE(f2.empty());
+}
+
+TEST(hollow_heap_test, handles_despues_de_unir_y_decrementar) {
+    hollow_heap<int> f1;
+    hollow_heap<int> f2;
+    vector<hollow_heap<int>::handle> handles;
+    for (int i = 0; i < 500; ++i) {
+        handles.push_back(f1.insert(i * 2 + 10));
+        handles.push_back(f2.insert(i * 2 + 11));
+    }
+    f1.extract_min();
+    f2.extract_min();
+    f1.join(f2);
+    EXPECT_TRUE(f2.empty());
+    EXPECT_EQ(f1.size(),998);
+    f1.decrease_key(handles[501], 1);
+    f1.decrease_key(handles[501], 0);
+    f1.decrease_key(handles[300], 2);
+    EXPECT_EQ(*handles[501],0);
+    EXPECT_EQ(f1.pop_min(),0);
+    f1.delete_key(handles[300]);
+    EXPECT_EQ(f1.pop_min(),12);
+    EXPECT_EQ(f1.pop_min(),13);
+    EXPECT_EQ(*handles[999],1009);
+    EXPECT_EQ(f1.size(),994);
+}
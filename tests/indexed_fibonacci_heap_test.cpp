@@ -0,0 +1,109 @@
+#include "gtest/gtest.h"
+#include "../src/indexed_fibonacci_heap.h"
+#include <atomic>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+extern atomic<size_t> global_allocations;
+
+TEST(indexed_fibonacci_heap_test, por_id) {
+    indexed_fibonacci_heap<int> f(10);
+    EXPECT_TRUE(f.empty());
+    EXPECT_EQ(f.capacity(),10);
+    size_t before = global_allocations;
+    f.insert(3, 30);
+    f.insert(7, 70);
+    f.insert(0, 50);
+    f.insert(9, 20);
+    // Los nodos están en el arreglo desde la construcción
+    EXPECT_EQ(global_allocations.load(),before);
+    EXPECT_TRUE(f.contains(7));
+    EXPECT_FALSE(f.contains(1));
+    EXPECT_EQ(f.key_of(0),50);
+    EXPECT_EQ(f.min_id(),9);
+    f.decrease_key(7, 10);
+    EXPECT_EQ(f.min_id(),7);
+    EXPECT_EQ(f.minimum(),10);
+    f.erase(9);
+    EXPECT_FALSE(f.contains(9));
+    EXPECT_EQ(f.pop_min(),make_pair(size_t(7), 10));
+    f.insert(7, 40);
+    f.insert(9, 60);
+    EXPECT_EQ(f.size(),4);
+    EXPECT_EQ(f.pop_min(),make_pair(size_t(3), 30));
+    EXPECT_EQ(f.pop_min(),make_pair(size_t(7), 40));
+    f.clear();
+    EXPECT_TRUE(f.empty());
+    EXPECT_FALSE(f.contains(0));
+    EXPECT_EQ(f.capacity(),10);
+}
+
+TEST(indexed_fibonacci_heap_test, operaciones_al_azar) {
+    // Mismas operaciones en el heap y en un set de (clave, id)
+    const size_t ids = 2000;
+    mt19937 gen(5);
+    indexed_fibonacci_heap<long long> f(ids);
+    set<pair<long long, size_t> > ref;
+    vector<long long> keys(ids);
+    for (int paso = 0; paso < 100000; ++paso) {
+        size_t id = gen() % ids;
+        unsigned int op = gen() % 8;
+        if(!f.contains(id)){
+            keys[id] = static_cast<long long>(gen() % 1000000);
+            f.insert(id, keys[id]);
+            ref.insert(make_pair(keys[id], id));
+        }else if(op < 5){
+            ref.erase(make_pair(keys[id], id));
+            keys[id] -= 1 + static_cast<long long>(gen() % 1000);
+            f.decrease_key(id, keys[id]);
+            ref.insert(make_pair(keys[id], id));
+        }else if(op == 5){
+            ref.erase(make_pair(keys[id], id));
+            f.erase(id);
+        }else{
+            ASSERT_EQ(f.minimum(),ref.begin()->first);
+            pair<size_t, long long> m = f.pop_min();
+            ASSERT_EQ(m.second,ref.begin()->first);
+            ASSERT_EQ(keys[m.first],m.second);
+            ref.erase(make_pair(m.second, m.first));
+        }
+        ASSERT_EQ(f.size(),ref.size());
+    }
+    for (size_t id = 0; id < ids; ++id) {
+        ASSERT_EQ(f.contains(id),ref.count(make_pair(keys[id], id)) == 1);
+    }
+}
+
+TEST(indexed_fibonacci_heap_test, copiar_y_mover_mantiene_ids) {
+    indexed_fibonacci_heap<string> f1(100);
+    for (size_t id = 0; id < 100; id += 2) {
+        f1.insert(id, to_string(1000 + id));
+    }
+    f1.extract_min();
+    f1.decrease_key(50, "0");
+    indexed_fibonacci_heap<string> f2(f1);
+    EXPECT_EQ(f2.size(),49);
+    EXPECT_EQ(f2.min_id(),50);
+    EXPECT_EQ(f2.key_of(98),"1098");
+    EXPECT_FALSE(f2.contains(0));
+    indexed_fibonacci_heap<string> f3(3);
+    f3.insert(1, "x");
+    f3 = f2;
+    EXPECT_EQ(f3.capacity(),100);
+    EXPECT_FALSE(f3.contains(1));
+    indexed_fibonacci_heap<string> f4(std::move(f2));
+    EXPECT_EQ(f2.capacity(),0);
+    f4.swap(f3);
+    while (!f1.empty()) {
+        pair<size_t, string> a = f1.pop_min();
+        EXPECT_EQ(f3.pop_min(),a);
+        EXPECT_EQ(f4.pop_min(),a);
+    }
+    EXPECT_TRUE(f3.empty());
+    EXPECT_TRUE(f4.empty());
+}
@@ -0,0 +1,204 @@
+#include "gtest/gtest.h"
+#include "../src/intrusive_fibonacci_heap.h"
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Definido en fibonacci_heap_test.cpp
+extern atomic<size_t> global_allocations;
+
+struct tarea {
+    string nombre;
+    int prioridad;
+    fibonacci_hook hook;
+    fibonacci_hook hook_secundario;
+
+    bool operator<(const tarea& o) const {
+        return prioridad < o.prioridad;
+    }
+};
+
+struct por_nombre {
+    bool operator()(const tarea& a, const tarea& b) const {
+        return a.nombre < b.nombre;
+    }
+};
+
+using heap_tareas = intrusive_fibonacci_heap<tarea, &tarea::hook>;
+
+static bool hook_libre(const fibonacci_hook& h) {
+    return h.parent == nullptr && h.child == nullptr && h.left == &h && h.right == &h && h.degree == 0 && !h.mark;
+}
+
+TEST(intrusive_fibonacci_heap_test, vacio) {
+    heap_tareas f;
+    EXPECT_TRUE(f.empty());
+    EXPECT_EQ(f.size(),0);
+}
+
+TEST(intrusive_fibonacci_heap_test, ordena_sin_pedir_memoria) {
+    vector<tarea> tareas(1000);
+    mt19937 gen(7);
+    uniform_int_distribution<int> dist(0,100000);
+    for (size_t i = 0; i < tareas.size(); ++i) {
+        tareas[i].nombre = to_string(i);
+        tareas[i].prioridad = dist(gen);
+    }
+    vector<int> esperado;
+    for (const tarea& t : tareas) {
+        esperado.push_back(t.prioridad);
+    }
+    sort(esperado.begin(), esperado.end());
+
+    // El único pedido es el reserve de obtenido
+    size_t before = global_allocations;
+    heap_tareas f;
+    for (tarea& t : tareas) {
+        f.insert(t);
+    }
+    vector<int> obtenido;
+    obtenido.reserve(tareas.size());
+    while (!f.empty()) {
+        obtenido.push_back(f.pop_min().prioridad);
+    }
+    EXPECT_EQ(global_allocations - before,1);
+    EXPECT_EQ(obtenido,esperado);
+    for (const tarea& t : tareas) {
+        EXPECT_TRUE(hook_libre(t.hook));
+    }
+}
+
+TEST(intrusive_fibonacci_heap_test, decrementar_y_borrar) {
+    vector<tarea> tareas(200);
+    heap_tareas f;
+    for (size_t i = 0; i < tareas.size(); ++i) {
+        tareas[i].prioridad = static_cast<int>(1000 + i);
+        f.insert(tareas[i]);
+    }
+    f.extract_min();
+    EXPECT_TRUE(hook_libre(tareas[0].hook));
+
+    // Quedan árboles con hijos, así decrease_key y erase cortan
+    for (size_t i = 1; i < tareas.size(); i += 3) {
+        tareas[i].prioridad -= 500;
+        f.decrease_key(tareas[i]);
+    }
+    for (size_t i = 2; i < tareas.size(); i += 3) {
+        f.erase(tareas[i]);
+        EXPECT_TRUE(hook_libre(tareas[i].hook));
+    }
+    EXPECT_EQ(&f.minimum(),&tareas[1]);
+
+    vector<int> esperado;
+    for (size_t i = 1; i < tareas.size(); ++i) {
+        if(i % 3 != 2){
+            esperado.push_back(tareas[i].prioridad);
+        }
+    }
+    sort(esperado.begin(), esperado.end());
+    EXPECT_EQ(f.size(),esperado.size());
+    vector<int> obtenido;
+    while (!f.empty()) {
+        obtenido.push_back(f.pop_min().prioridad);
+    }
+    EXPECT_EQ(obtenido,esperado);
+}
+
+TEST(intrusive_fibonacci_heap_test, reinsertar_y_unir) {
+    vector<tarea> tareas(10);
+    heap_tareas a;
+    heap_tareas b;
+    for (size_t i = 0; i < tareas.size(); ++i) {
+        tareas[i].prioridad = static_cast<int>(i);
+        (i % 2 == 0 ? a : b).insert(tareas[i]);
+    }
+    tarea& t = a.pop_min();
+    EXPECT_EQ(&t,&tareas[0]);
+    t.prioridad = 20;
+    b.insert(t);
+
+    a.join(b);
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(a.size(),10);
+    EXPECT_EQ(&a.minimum(),&tareas[1]);
+
+    heap_tareas c(std::move(a));
+    EXPECT_TRUE(a.empty());
+    EXPECT_EQ(c.size(),10);
+    c.clear();
+    EXPECT_TRUE(c.empty());
+    for (const tarea& x : tareas) {
+        EXPECT_TRUE(hook_libre(x.hook));
+    }
+}
+
+TEST(intrusive_fibonacci_heap_test, dos_hooks_en_el_mismo_objeto) {
+    vector<tarea> tareas(3);
+    tareas[0].nombre = "c"; tareas[0].prioridad = 1;
+    tareas[1].nombre = "a"; tareas[1].prioridad = 3;
+    tareas[2].nombre = "b"; tareas[2].prioridad = 2;
+    {
+        heap_tareas por_prioridad;
+        intrusive_fibonacci_heap<tarea, &tarea::hook_secundario, por_nombre> alfabetico;
+        for (tarea& t : tareas) {
+            por_prioridad.insert(t);
+            alfabetico.insert(t);
+        }
+        EXPECT_EQ(por_prioridad.minimum().nombre,"c");
+        EXPECT_EQ(alfabetico.minimum().nombre,"a");
+        alfabetico.erase(tareas[0]);
+        EXPECT_EQ(por_prioridad.pop_min().nombre,"c");
+        EXPECT_EQ(alfabetico.size(),2);
+    }
+    // El destructor deja los hooks listos para reusar
+    for (const tarea& t : tareas) {
+        EXPECT_TRUE(hook_libre(t.hook));
+        EXPECT_TRUE(hook_libre(t.hook_secundario));
+    }
+}
+
+TEST(intrusive_fibonacci_heap_test, copias_con_hook_libre) {
+    tarea original;
+    original.nombre = "original";
+    original.prioridad = 50;
+    heap_tareas f;
+    f.insert(original);
+    // Copiar o mover un objeto que está en un heap no arrastra sus enlaces
+    vector<tarea> tareas;
+    for (int i = 0; i < 100; ++i) {
+        tarea t = original;
+        t.prioridad = 100 - i;
+        EXPECT_TRUE(hook_libre(t.hook));
+        if(i % 2 == 0){
+            tareas.push_back(t);
+        }else{
+            tareas.push_back(std::move(t));
+        }
+    }
+    // Con los push_back el vector se reubicó varias veces
+    heap_tareas g;
+    for (tarea& t : tareas) {
+        EXPECT_TRUE(hook_libre(t.hook));
+        g.insert(t);
+    }
+    // Asignar toma la clave pero tareas[0] sigue en g con su hook
+    tareas[0] = original;
+    EXPECT_EQ(tareas[0].prioridad,50);
+    g.decrease_key(tareas[0]);
+    EXPECT_EQ(&g.minimum(),&tareas.back());
+    EXPECT_EQ(g.size(),100);
+    EXPECT_EQ(&f.minimum(),&original);
+    EXPECT_EQ(f.size(),1);
+    int anterior = 0;
+    while (!g.empty()) {
+        int p = g.pop_min().prioridad;
+        EXPECT_LE(anterior,p);
+        anterior = p;
+    }
+    f.clear();
+}
@@ -0,0 +1,118 @@
+#include "gtest/gtest.h"
+#include "../src/keyed_fibonacci_heap.h"
+#include <algorithm>
+#include <array>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+struct ficha {
+    string nombre;
+    array<int, 32> datos;
+};
+
+TEST(keyed_fibonacci_heap_test, vacio) {
+    keyed_fibonacci_heap<int, string> f;
+    EXPECT_TRUE(f.empty());
+    EXPECT_EQ(f.size(),0);
+    f.clear();
+    f.extract_min();
+    keyed_fibonacci_heap<int, string> f2(f);
+    f2 = f;
+    EXPECT_TRUE(f2.empty());
+}
+
+TEST(keyed_fibonacci_heap_test, prioridad_y_dato) {
+    keyed_fibonacci_heap<int, ficha> f;
+    vector<keyed_fibonacci_heap<int, ficha>::handle> handles;
+    handles.push_back(f.insert(7, ficha{"FACUNDO", {}}));
+    handles.push_back(f.insert(24, ficha{"NICOLAS", {}}));
+    handles.push_back(f.emplace(17, ficha{"PABLO", {}}));
+    handles.push_back(f.emplace(52, ficha{"RICARDO", {}}));
+    handles[3].value().datos[5] = 42;
+    EXPECT_EQ(f.size(),4);
+    EXPECT_EQ(f.minimum(),7);
+    EXPECT_EQ(f.minimum_value().nombre,"FACUNDO");
+    f.extract_min();
+    EXPECT_EQ(f.minimum_value().nombre,"PABLO");
+    f.decrease_key(handles[3],1);
+    EXPECT_EQ(handles[3].key(),1);
+    EXPECT_EQ(handles[3].value().nombre,"RICARDO");
+    EXPECT_EQ(handles[3].value().datos[5],42);
+    EXPECT_EQ(f.minimum(),1);
+    pair<int, ficha> m = f.pop_min();
+    EXPECT_EQ(m.first,1);
+    EXPECT_EQ(m.second.nombre,"RICARDO");
+    EXPECT_EQ(m.second.datos[5],42);
+    f.delete_key(handles[2]);
+    EXPECT_EQ(f.size(),1);
+    EXPECT_EQ(f.minimum_value().nombre,"NICOLAS");
+}
+
+TEST(keyed_fibonacci_heap_test, copiar_y_unir) {
+    keyed_fibonacci_heap<double, string> f1;
+    keyed_fibonacci_heap<double, string> f2;
+    f1.insert(3.3, "c");
+    f1.insert(1.1, "a");
+    f2.insert(2.2, "b");
+    f2.insert(0.5, "z");
+    keyed_fibonacci_heap<double, string> f3(f1);
+    f1.join(f2);
+    EXPECT_TRUE(f2.empty());
+    EXPECT_EQ(f1.size(),4);
+    EXPECT_EQ(f1.minimum_value(),"z");
+    EXPECT_EQ(f3.size(),2);
+    EXPECT_EQ(f3.minimum_value(),"a");
+    f2 = std::move(f1);
+    EXPECT_EQ(f2.size(),4);
+    f3.swap(f2);
+    EXPECT_EQ(f3.size(),4);
+    vector<string> res;
+    while(!f3.empty()){
+        res.push_back(f3.pop_min().second);
+    }
+    EXPECT_EQ(res,vector<string>({"z","a","b","c"}));
+}
+
+TEST(keyed_fibonacci_heap_test, max_heap) {
+    keyed_fibonacci_heap<int, int, greater<int> > f;
+    keyed_fibonacci_heap<int, int, greater<int> >::handle h = f.insert(1, 100);
+    f.insert(5, 500);
+    f.insert(3, 300);
+    EXPECT_EQ(f.minimum(),5);
+    f.increase_key(h, 10);
+    EXPECT_EQ(f.minimum(),10);
+    EXPECT_EQ(f.minimum_value(),100);
+}
+
+TEST(keyed_fibonacci_heap_test, random_decrease) {
+    mt19937 gen(7);
+    uniform_int_distribution<int> distribution(0,1000);
+    keyed_fibonacci_heap<int, int> f;
+    vector<keyed_fibonacci_heap<int, int>::handle> handles;
+    vector<int> keys;
+    for (int i = 0; i < 500; ++i) {
+        int k = distribution(gen);
+        handles.push_back(f.insert(k, i));
+        keys.push_back(k);
+    }
+    int removed = f.pop_min().second;
+    for (int i = 0; i < 500; i += 3) {
+        if(i == removed){
+            continue;
+        }
+        keys[i] -= 1 + distribution(gen);
+        f.decrease_key(handles[i], keys[i]);
+    }
+    vector<int> res;
+    while(!f.empty()){
+        pair<int, int> p = f.pop_min();
+        EXPECT_EQ(p.first,keys[p.second]);
+        res.push_back(p.first);
+    }
+    EXPECT_EQ(res.size(),499);
+    EXPECT_TRUE(is_sorted(res.begin(),res.end()));
+}
@@ -0,0 +1,86 @@
+#include "gtest/gtest.h"
+#include "../src/instrumented_fibonacci_heap.h"
+#include "../src/latency_histogram.h"
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+TEST(latency_histogram_test, vacio) {
+    latency_histogram h;
+    EXPECT_EQ(h.count(),0);
+    EXPECT_EQ(h.max(),0);
+    EXPECT_EQ(h.percentile(50),0);
+    EXPECT_EQ(h.mean(),0.0);
+}
+
+TEST(latency_histogram_test, valores_chicos_exactos) {
+    latency_histogram h;
+    for (uint64_t i = 1; i <= 20; ++i) {
+        h.record(i);
+    }
+    EXPECT_EQ(h.count(),20);
+    EXPECT_EQ(h.percentile(50),10);
+    EXPECT_EQ(h.percentile(100),20);
+    EXPECT_EQ(h.percentile(0),1);
+    EXPECT_EQ(h.max(),20);
+    EXPECT_DOUBLE_EQ(h.mean(),10.5);
+}
+
+TEST(latency_histogram_test, error_relativo) {
+    latency_histogram h;
+    for (uint64_t i = 1; i <= 100000; ++i) {
+        h.record(i * 1000);
+    }
+    uint64_t p50 = h.percentile(50);
+    uint64_t p99 = h.percentile(99);
+    uint64_t p999 = h.percentile(99.9);
+    EXPECT_GE(p50,50000000ULL);
+    EXPECT_LE(p50,50000000ULL + 50000000ULL / 32);
+    EXPECT_GE(p99,99000000ULL);
+    EXPECT_LE(p99,99000000ULL + 99000000ULL / 32);
+    EXPECT_GE(p999,99900000ULL);
+    EXPECT_LE(p999,h.max());
+    EXPECT_EQ(h.max(),100000000ULL);
+    h.record(UINT64_MAX);
+    EXPECT_EQ(h.percentile(100),UINT64_MAX);
+    h.reset();
+    EXPECT_EQ(h.count(),0);
+    EXPECT_EQ(h.percentile(99),0);
+}
+
+TEST(latency_histogram_test, heap_instrumentado) {
+    instrumented_fibonacci_heap<int> f;
+    vector<instrumented_fibonacci_heap<int>::handle> handles;
+    for (int i = 0; i < 100; ++i) {
+        handles.push_back(f.insert(i + 100));
+    }
+    f.extract_min();
+    f.decrease_key(handles[50], 5);
+    f.delete_key(handles[60]);
+    instrumented_fibonacci_heap<int> other;
+    other.insert(1);
+    f.join(other);
+    EXPECT_EQ(f.pop_min(),1);
+    EXPECT_EQ(f.minimum(),5);
+    EXPECT_EQ(f.size(),98);
+    EXPECT_EQ(f.latencies().insert.count(),100);
+    EXPECT_EQ(f.latencies().extract_min.count(),2);
+    EXPECT_EQ(f.latencies().decrease_key.count(),1);
+    EXPECT_EQ(f.latencies().delete_key.count(),1);
+    EXPECT_EQ(f.latencies().join.count(),1);
+    EXPECT_EQ(other.latencies().insert.count(),1);
+    EXPECT_GT(f.latencies().extract_min.max(),0);
+    ostringstream text;
+    f.latencies().write_text(text);
+    EXPECT_NE(text.str().find("extract_min count=2"),string::npos);
+    ostringstream json;
+    f.latencies().write_json(json);
+    EXPECT_EQ(json.str().front(),'{');
+    EXPECT_EQ(json.str().back(),'}');
+    EXPECT_NE(json.str().find("\"decrease_key\": {\"count\": 1"),string::npos);
+    f.reset_latencies();
+    EXPECT_EQ(f.latencies().insert.count(),0);
+}
@@ -0,0 +1,82 @@
+#include "gtest/gtest.h"
+#include "../src/pairing_heap.h"
+#include <algorithm>
+#include <vector>
+
+using namespace std;
+
+// Definida en fibonacci_heap_test.cpp
+void con_pila_chica(size_t stack_size, void (*test)());
+
+TEST(pairing_heap_test, cadena_profunda_en_pila_chica) {
+    con_pila_chica(256 * 1024, []{
+        // Insertar claves decrecientes cuelga cada raíz vieja de la nueva: una cadena de profundidad n
+        const int depth = 200000;
+        pairing_heap<int> f;
+        for (int i = 0; i < depth; ++i) {
+            f.insert(-i);
+        }
+        pairing_heap<int> copy(f);
+        EXPECT_EQ(copy.size(),depth);
+        f.clear();
+        EXPECT_TRUE(f.empty());
+        f = copy;
+        for (int i = depth - 1; i > depth - 100; --i) {
+            EXPECT_EQ(copy.pop_min(),-i);
+            EXPECT_EQ(f.pop_min(),-i);
+        }
+    });
+}
+
+static size_t comparaciones_pairing = 0;
+
+struct contar_comparaciones_pairing {
+    bool operator()(int a, int b) const {
+        ++comparaciones_pairing;
+        return a < b;
+    }
+};
+
+TEST(pairing_heap_test, copiar_mantiene_forma) {
+    pairing_heap<int, contar_comparaciones_pairing> f1;
+    for (int i = 0; i < 4096; ++i) {
+        f1.insert((i * 7919) % 4096);
+    }
+    f1.extract_min();
+    comparaciones_pairing = 0;
+    pairing_heap<int, contar_comparaciones_pairing> f2(f1);
+    EXPECT_EQ(comparaciones_pairing,0);
+    f1.extract_min();
+    size_t original = comparaciones_pairing;
+    comparaciones_pairing = 0;
+    f2.extract_min();
+    EXPECT_EQ(comparaciones_pairing,original);
+    while(!f1.empty()){
+        EXPECT_EQ(f1.pop_min(),f2.pop_min());
+    }
+    EXPECT_TRUE(f2.empty());
+}
+
+TEST(pairing_heap_test, decrease_key_de_hijos_y_raiz) {
+    pairing_heap<int> f;
+    vector<pairing_heap<int>::handle> handles;
+    for (int i = 0; i < 100; ++i) {
+        handles.push_back(f.insert(i));
+    }
+    // Raíz: solo cambia la clave
+    f.decrease_key(handles[0], -1);
+    EXPECT_EQ(f.minimum(),-1);
+    f.extract_min();
+    // Después del extract_min hay árboles de varios niveles; bajar hojas, hijos del medio y la raíz
+    for (int i = 99; i > 0; i -= 3) {
+        f.decrease_key(handles[i], *handles[i] - 1000);
+    }
+    f.delete_key(handles[50]);
+    vector<int> res;
+    while(!f.empty()){
+        res.push_back(f.pop_min());
+    }
+    EXPECT_EQ(res.size(),98);
+    EXPECT_TRUE(is_sorted(res.begin(), res.end()));
+    EXPECT_EQ(res.front(),3 - 1000);
+}
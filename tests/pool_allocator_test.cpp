@@ -0,0 +1,65 @@
+#include "gtest/gtest.h"
+#include "../src/pool_allocator.h"
+#include <cstdint>
+#include <memory>
+#include <set>
+
+using namespace std;
+
+TEST(pool_allocator_test, reciclar) {
+    pool_allocator<int> a;
+    int* p1 = a.allocate(1);
+    int* p2 = a.allocate(1);
+    EXPECT_NE(p1,p2);
+    a.deallocate(p1,1);
+    int* p3 = a.allocate(1);
+    EXPECT_EQ(p1,p3);
+    a.deallocate(p2,1);
+    a.deallocate(p3,1);
+}
+
+TEST(pool_allocator_test, alineacion) {
+    pool_allocator<char> a(3);
+    pool_allocator<double> b(a);
+    for (int i = 0; i < 10; ++i) {
+        char* c = a.allocate(1);
+        double* d = b.allocate(1);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(c) % alignof(max_align_t),0);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(d) % alignof(max_align_t),0);
+    }
+}
+
+TEST(pool_allocator_test, igualdad) {
+    pool_allocator<int> a;
+    pool_allocator<int> b;
+    pool_allocator<int> c(a);
+    pool_allocator<long> d(a);
+    EXPECT_TRUE(a == c);
+    EXPECT_TRUE(a == d);
+    EXPECT_TRUE(a != b);
+    b = a;
+    EXPECT_TRUE(a == b);
+}
+
+TEST(pool_allocator_test, muchos_bloques) {
+    pool_allocator<int> a(7);
+    set<int*> vistos;
+    for (int i = 0; i < 100; ++i) {
+        int* p = a.allocate(1);
+        *p = i;
+        EXPECT_TRUE(vistos.insert(p).second);
+    }
+    for (set<int*>::iterator it = vistos.begin(); it != vistos.end(); ++it) {
+        a.deallocate(*it,1);
+    }
+}
+
+TEST(pool_allocator_test, arreglos_grandes) {
+    pool_allocator<int> a;
+    int* p = a.allocate(1000);
+    for (int i = 0; i < 1000; ++i) {
+        p[i] = i;
+    }
+    EXPECT_EQ(p[999],999);
+    a.deallocate(p,1000);
+}
@@ -0,0 +1,148 @@
+#include "gtest/gtest.h"
+#include "../src/radix_heap.h"
+#include "../src/keyed_fibonacci_heap.h"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+TEST(radix_heap_test, vacio) {
+    radix_heap<unsigned int, string> r;
+    EXPECT_TRUE(r.empty());
+    EXPECT_EQ(r.size(),0);
+    EXPECT_EQ(r.last_minimum(),0);
+    r.clear();
+    r.extract_min();
+    radix_heap<unsigned int, string> r2(r);
+    r2 = r;
+    EXPECT_TRUE(r2.empty());
+}
+
+TEST(radix_heap_test, prioridad_y_dato) {
+    radix_heap<unsigned int, string> r;
+    vector<radix_heap<unsigned int, string>::handle> handles;
+    handles.push_back(r.insert(7, "FACUNDO"));
+    handles.push_back(r.insert(24, "NICOLAS"));
+    handles.push_back(r.emplace(17, "PABLO"));
+    handles.push_back(r.emplace(52, "RICARDO"));
+    EXPECT_EQ(r.size(),4);
+    EXPECT_EQ(r.minimum(),7);
+    EXPECT_EQ(r.last_minimum(),7);
+    EXPECT_EQ(r.minimum_value(),"FACUNDO");
+    r.extract_min();
+    EXPECT_EQ(r.minimum_value(),"PABLO");
+    EXPECT_EQ(r.last_minimum(),17);
+    r.decrease_key(handles[3],17);
+    EXPECT_EQ(handles[3].key(),17);
+    EXPECT_EQ(handles[3].value(),"RICARDO");
+    r.delete_key(handles[2]);
+    EXPECT_EQ(r.size(),2);
+    pair<unsigned int, string> m = r.pop_min();
+    EXPECT_EQ(m.first,17);
+    EXPECT_EQ(m.second,"RICARDO");
+    // Después de sacar 17 se puede insertar 17 de nuevo pero no menos
+    r.insert(17, "FACUNDO");
+    EXPECT_EQ(r.pop_min().second,"FACUNDO");
+    EXPECT_EQ(r.pop_min().second,"NICOLAS");
+    EXPECT_TRUE(r.empty());
+    EXPECT_EQ(r.last_minimum(),24);
+}
+
+TEST(radix_heap_test, copiar_y_mover) {
+    radix_heap<uint16_t, string> r1;
+    r1.insert(300, "c");
+    r1.insert(100, "a");
+    r1.insert(200, "b");
+    r1.extract_min();
+    radix_heap<uint16_t, string> r2(r1);
+    EXPECT_EQ(r2.last_minimum(),100);
+    r2.insert(150, "x");
+    EXPECT_EQ(r1.size(),2);
+    EXPECT_EQ(r2.size(),3);
+    radix_heap<uint16_t, string> r3(std::move(r2));
+    EXPECT_TRUE(r2.empty());
+    r2 = r3;
+    r1.swap(r3);
+    EXPECT_EQ(r1.size(),3);
+    EXPECT_EQ(r3.size(),2);
+    vector<string> res;
+    while(!r1.empty()){
+        res.push_back(r1.pop_min().second);
+    }
+    EXPECT_EQ(res,vector<string>({"x","b","c"}));
+    r3 = std::move(r2);
+    EXPECT_EQ(r3.pop_min().second,"x");
+    r3.clear();
+    EXPECT_EQ(r3.last_minimum(),0);
+}
+
+TEST(radix_heap_test, claves_extremas) {
+    radix_heap<uint64_t, int> r;
+    const uint64_t maximo = numeric_limits<uint64_t>::max();
+    radix_heap<uint64_t, int>::handle h = r.insert(maximo, 1);
+    r.insert(maximo - 1, 2);
+    r.insert(1ULL << 63, 3);
+    r.insert(0, 4);
+    EXPECT_EQ(r.pop_min().second,4);
+    EXPECT_EQ(r.pop_min().second,3);
+    r.decrease_key(h, 1ULL << 63);
+    EXPECT_EQ(r.pop_min().second,1);
+    EXPECT_EQ(r.pop_min().first,maximo - 1);
+    radix_heap<uint8_t, int> chico;
+    for (int k = 255; k >= 0; k -= 5) {
+        chico.insert(static_cast<uint8_t>(k), k);
+    }
+    int anterior = -1;
+    while(!chico.empty()){
+        int k = chico.pop_min().second;
+        EXPECT_LT(anterior,k);
+        anterior = k;
+    }
+}
+
+TEST(radix_heap_test, igual_que_keyed_fibonacci_heap) {
+    // Carga monótona como la de Dijkstra: cada clave nueva o decrementada es \GEQ el último minimo sacado.
+    // La clave lleva el id en los bits bajos para que no haya empates y los dos heaps saquen lo mismo
+    mt19937 gen(11);
+    uniform_int_distribution<uint64_t> distribution(0,5000);
+    radix_heap<uint64_t, unsigned int> r;
+    keyed_fibonacci_heap<uint64_t, unsigned int> f;
+    vector<radix_heap<uint64_t, unsigned int>::handle> rh;
+    vector<keyed_fibonacci_heap<uint64_t, unsigned int>::handle> fh;
+    vector<bool> dentro;
+    uint64_t last = 0;
+    for (int paso = 0; paso < 20000; ++paso) {
+        unsigned int op = gen() % 4;
+        if(op == 0 && !r.empty()){
+            ASSERT_EQ(r.minimum(),f.minimum());
+            pair<uint64_t, unsigned int> a = r.pop_min();
+            pair<uint64_t, unsigned int> b = f.pop_min();
+            ASSERT_EQ(a,b);
+            last = a.first >> 20;
+            dentro[a.second] = false;
+        }else if(op == 1 && !rh.empty()){
+            unsigned int i = gen() % rh.size();
+            uint64_t actual = rh[i].key() >> 20;
+            if(dentro[i] && actual > last + 1){
+                uint64_t k = (last + 1 + gen() % (actual - last - 1)) << 20 | i;
+                r.decrease_key(rh[i], k);
+                f.decrease_key(fh[i], k);
+            }
+        }else{
+            unsigned int id = static_cast<unsigned int>(rh.size());
+            uint64_t k = (last + 1 + distribution(gen)) << 20 | id;
+            rh.push_back(r.insert(k, id));
+            fh.push_back(f.insert(k, id));
+            dentro.push_back(true);
+        }
+        ASSERT_EQ(r.size(),f.size());
+    }
+    while(!r.empty()){
+        ASSERT_EQ(r.pop_min(),f.pop_min());
+    }
+}
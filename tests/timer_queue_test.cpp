@@ -0,0 +1,112 @@
+#include "gtest/gtest.h"
+#include "../src/timer_queue.h"
+#include <vector>
+
+using namespace std;
+
+TEST(timer_queue_test, ejecuta_en_orden_de_vencimiento) {
+    timer_queue q;
+    EXPECT_TRUE(q.empty());
+    vector<int> orden;
+    q.schedule(30, [&]{ orden.push_back(3); });
+    q.schedule(10, [&]{ orden.push_back(1); });
+    q.schedule(20, [&]{ orden.push_back(2); });
+    q.schedule(10, [&]{ orden.push_back(4); });
+    EXPECT_EQ(q.size(),4);
+    EXPECT_EQ(q.next_deadline(),10);
+    EXPECT_EQ(q.run_expired(5),0);
+    EXPECT_EQ(q.run_expired(20),3);
+    EXPECT_EQ(orden,vector<int>({1, 4, 2}));
+    EXPECT_EQ(q.next_deadline(),30);
+    EXPECT_EQ(q.run_expired(100),1);
+    EXPECT_EQ(orden,vector<int>({1, 4, 2, 3}));
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(timer_queue_test, cancelar) {
+    timer_queue q;
+    int disparos = 0;
+    timer_queue::timer_id a = q.schedule(10, [&]{ ++disparos; });
+    timer_queue::timer_id b = q.schedule(20, [&]{ ++disparos; });
+    EXPECT_TRUE(q.pending(a));
+    EXPECT_TRUE(q.cancel(a));
+    EXPECT_FALSE(q.pending(a));
+    EXPECT_FALSE(q.cancel(a));
+    EXPECT_FALSE(q.reschedule(a, 5));
+    EXPECT_EQ(q.size(),1);
+    EXPECT_EQ(q.run_expired(100),1);
+    EXPECT_EQ(disparos,1);
+    EXPECT_FALSE(q.pending(b));
+    EXPECT_FALSE(q.cancel(b));
+}
+
+TEST(timer_queue_test, id_viejo_no_toca_al_que_reusa_el_lugar) {
+    timer_queue q;
+    int disparos = 0;
+    timer_queue::timer_id viejo = q.schedule(10, []{});
+    EXPECT_TRUE(q.cancel(viejo));
+    timer_queue::timer_id nuevo = q.schedule(10, [&]{ ++disparos; });
+    EXPECT_NE(viejo,nuevo);
+    EXPECT_FALSE(q.cancel(viejo));
+    EXPECT_FALSE(q.reschedule(viejo, 1000));
+    EXPECT_TRUE(q.pending(nuevo));
+    EXPECT_EQ(q.run_expired(10),1);
+    EXPECT_EQ(disparos,1);
+}
+
+TEST(timer_queue_test, reprogramar) {
+    timer_queue q;
+    vector<int> orden;
+    timer_queue::timer_id a = q.schedule(50, [&]{ orden.push_back(1); });
+    timer_queue::timer_id b = q.schedule(10, [&]{ orden.push_back(2); });
+    q.schedule(30, [&]{ orden.push_back(3); });
+    EXPECT_TRUE(q.reschedule(a, 5));
+    EXPECT_EQ(q.next_deadline(),5);
+    EXPECT_TRUE(q.reschedule(b, 30));
+    EXPECT_EQ(q.run_expired(29),1);
+    EXPECT_EQ(q.run_expired(30),2);
+    // b se reprogramó después que el de 30, así que se ejecuta después
+    EXPECT_EQ(orden,vector<int>({1, 3, 2}));
+}
+
+TEST(timer_queue_test, callbacks_que_programan_y_cancelan) {
+    timer_queue q;
+    vector<int> orden;
+    timer_queue::timer_id victima = q.schedule(20, [&]{ orden.push_back(99); });
+    q.schedule(10, [&]{
+        orden.push_back(1);
+        q.cancel(victima);
+        q.schedule(15, [&]{ orden.push_back(2); });
+        q.schedule(1000, [&]{ orden.push_back(3); });
+    });
+    EXPECT_EQ(q.run_expired(100),2);
+    EXPECT_EQ(orden,vector<int>({1, 2}));
+    EXPECT_EQ(q.size(),1);
+    q.clear();
+    EXPECT_TRUE(q.empty());
+    EXPECT_EQ(q.run_expired(5000),0);
+}
+
+TEST(timer_queue_test, muchos_timers_mayoria_cancelados) {
+    timer_queue q;
+    const int n = 10000;
+    vector<timer_queue::timer_id> ids;
+    vector<int> disparado(n, 0);
+    for (int i = 0; i < n; ++i) {
+        ids.push_back(q.schedule(static_cast<timer_queue::time_type>((i * 7919) % n), [&disparado, i]{ ++disparado[i]; }));
+    }
+    for (int i = 0; i < n; ++i) {
+        if(i % 10 != 0){
+            EXPECT_TRUE(q.cancel(ids[i]));
+        }else if(i % 20 == 0){
+            EXPECT_TRUE(q.reschedule(ids[i], 0));
+        }
+    }
+    EXPECT_EQ(q.size(),n / 10);
+    // Los reprogramados a 0 incluyen al timer 0, que ya vencia en 0
+    EXPECT_EQ(q.run_expired(0),n / 20);
+    q.run_expired(n);
+    for (int i = 0; i < n; ++i) {
+        ASSERT_EQ(disparado[i],i % 10 == 0 ? 1 : 0);
+    }
+}